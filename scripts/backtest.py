@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Evaluate the battery strategy on days recorded by the device (/history.csv).
+
+For every day it reports the actual grid cost, the cost the plain self-use
+strategy would have had with the same PV and load (battery model driven by
+the recorded energy flows), how well the plan predicted PV, load and SOC,
+and how many quarters each mode was planned for. With --quarters the
+per-quarter table is printed as well.
+
+Collect days by fetching yesterday once a day, e.g. from cron after 00:15:
+  ./scripts/backtest.py --fetch http://192.168.1.50 history/
+
+Evaluate:
+  ./scripts/backtest.py history/ --capacity 10 --min-soc 10 --max-soc 100
+
+What this does not do: it does not replay days through the resolver. The
+intelligence library is built for the device only, so there is no native
+replay of toBatteryState/toPriceData and the simulation. Because of that it
+reports no simulated cost of a changed strategy, and it measures no run
+time or memory on the host. The device reports its own run time
+(intelligence_simulation_ms) and worker stack
+(intelligence_worker_stack_free_bytes) at /metrics. The device keeps only
+today and yesterday, so a longer history has to be built up by fetching
+every day.
+"""
+
+import argparse
+import csv
+import glob
+import os
+import sys
+import time
+import urllib.request
+
+
+def fetch(host, directory):
+    url = host.rstrip("/") + "/history.csv?day=1"
+    data = urllib.request.urlopen(url, timeout=20).read().decode()
+    lines = data.splitlines()
+    if len(lines) < 2:
+        sys.exit("No recorded day at %s" % url)
+    date = lines[1].split(",")[0]
+    os.makedirs(directory, exist_ok=True)
+    path = os.path.join(directory, date + ".csv")
+    with open(path, "w") as f:
+        f.write(data)
+    print("Saved %s (%d quarters)" % (path, len(lines) - 1))
+
+
+def load_days(paths):
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            files.extend(sorted(glob.glob(os.path.join(path, "*.csv"))))
+        else:
+            files.append(path)
+    days = {}
+    for path in files:
+        with open(path) as f:
+            for row in csv.DictReader(f):
+                days.setdefault(row["date"], {})[int(row["quarter"])] = row
+    return [(date, [q[k] for k in sorted(q)]) for date, q in sorted(days.items())]
+
+
+def self_use_cost(quarters, args):
+    """Grid cost of charging from surplus and discharging on deficit only."""
+    capacity = args.capacity * 1000.0
+    soc_wh = float(quarters[0]["soc"]) / 100.0 * capacity
+    min_wh = args.min_soc / 100.0 * capacity
+    max_wh = args.max_soc / 100.0 * capacity
+    cost = 0.0
+    for row in quarters:
+        balance = float(row["pv_wh"]) - float(row["load_wh"])
+        if balance > 0:
+            stored = min(balance, max_wh - soc_wh, args.charge_kw * 250.0)
+            soc_wh += max(stored, 0.0)
+            cost -= (balance - max(stored, 0.0)) / 1000.0 * float(row["sell"])
+        else:
+            supplied = min(-balance, soc_wh - min_wh, args.discharge_kw * 250.0)
+            soc_wh -= max(supplied, 0.0)
+            cost += (-balance - max(supplied, 0.0)) / 1000.0 * float(row["buy"])
+    # Energy left in the battery is worth what it would cost to buy later
+    start_wh = float(quarters[0]["soc"]) / 100.0 * capacity
+    return cost, soc_wh - start_wh
+
+
+def evaluate(date, quarters, args):
+    actual = 0.0
+    pv_error = load_error = soc_error = 0.0
+    planned = 0
+    modes = {}
+    for row in quarters:
+        actual += float(row["grid_buy_wh"]) / 1000.0 * float(row["buy"])
+        actual -= float(row["grid_sell_wh"]) / 1000.0 * float(row["sell"])
+        modes[row["mode"]] = modes.get(row["mode"], 0) + 1
+        if int(row["plan_soc"]) >= 0:
+            planned += 1
+            pv_error += abs(float(row["plan_pv_wh"]) - float(row["pv_wh"]))
+            load_error += abs(float(row["plan_load_wh"]) - float(row["load_wh"]))
+            soc_error += abs(int(row["plan_soc"]) - int(row["soc"]))
+
+    baseline, baseline_stored_wh = self_use_cost(quarters, args)
+    actual_stored_wh = (int(quarters[-1]["soc"]) - int(quarters[0]["soc"])) / 100.0 * args.capacity * 1000.0
+    # Compare at equal final battery energy, valued at the average buy price
+    avg_buy = sum(float(r["buy"]) for r in quarters) / len(quarters)
+    adjustment = (actual_stored_wh - baseline_stored_wh) / 1000.0 * avg_buy
+
+    print("%s  %3d quarters  actual %8.2f  self-use %8.2f  savings %7.2f  (battery adj. %6.2f)"
+          % (date, len(quarters), actual, baseline, baseline - actual + adjustment, adjustment))
+    if planned > 0:
+        print("            plan error per quarter: PV %.0f Wh, load %.0f Wh, SOC %.1f %%"
+              % (pv_error / planned, load_error / planned, soc_error / planned))
+    print("            modes: " + ", ".join("%s %d" % (m, n) for m, n in sorted(modes.items())))
+    if args.quarters:
+        for row in quarters:
+            print("            %s %-20s pv %6s/%6s load %6s/%6s soc %3s/%3s buy %6s sell %6s"
+                  % (row["time"], row["mode"], row["pv_wh"], row["plan_pv_wh"], row["load_wh"],
+                     row["plan_load_wh"], row["soc"], row["plan_soc"], row["buy"], row["sell"]))
+    return actual, baseline - actual + adjustment
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("paths", nargs="*", help="recorded CSV files or directories with them")
+    parser.add_argument("--fetch", metavar="URL", help="download yesterday from the device into the first path")
+    parser.add_argument("--capacity", type=float, default=10.0, help="battery capacity, kWh")
+    parser.add_argument("--min-soc", type=float, default=10.0)
+    parser.add_argument("--max-soc", type=float, default=100.0)
+    parser.add_argument("--charge-kw", type=float, default=5.0)
+    parser.add_argument("--discharge-kw", type=float, default=5.0)
+    parser.add_argument("--quarters", action="store_true", help="print every quarter")
+    args = parser.parse_args()
+
+    if args.fetch:
+        fetch(args.fetch, args.paths[0] if args.paths else ".")
+        return
+
+    start = time.perf_counter()
+    days = load_days(args.paths)
+    if not days:
+        sys.exit("No recorded days")
+    total_actual = total_savings = 0.0
+    for date, quarters in days:
+        actual, savings = evaluate(date, quarters, args)
+        total_actual += actual
+        total_savings += savings
+    print("%d days: actual %.2f, savings vs self-use %.2f (%.0f ms)"
+          % (len(days), total_actual, total_savings, (time.perf_counter() - start) * 1000))
+
+
+if __name__ == "__main__":
+    main()
@@ -24,6 +24,10 @@ FONT_BOLD="$FONT_DIR/OpenSans-Bold.ttf"
 # 0x100-0x17F  = Latin Extended-A (includes Czech ČčŘřŠšŽžĚěĎďŤťŇňÚúŮů)
 CHAR_RANGE="0x20-0xFF,0x100-0x17F"
 
+# Large numerals on the dashboard only show numbers: space % + , - . / 0-9 ~
+# (~300 glyphs of the full range were ~80 kB of flash for 18 used glyphs)
+NUMERAL_RANGE="0x20,0x25,0x2B-0x39,0x7E"
+
 # Common options
 COMMON_OPTS="--format lvgl --no-compress --no-prefilter"
 
@@ -61,6 +65,7 @@ generate_font "OpenSansMedium" 20 "$FONT_REGULAR"
 generate_font "OpenSansMediumBold" 26 "$FONT_BOLD"
 generate_font "OpenSansLarge" 36 "$FONT_REGULAR"
 generate_font "OpenSansLargeBold" 36 "$FONT_BOLD"
+python3 "$SCRIPT_DIR/subset_font.py" "$OUTPUT_DIR/ui_font_OpenSansLargeBold.c" "$NUMERAL_RANGE"
 
 echo ""
 echo "=== Done! ==="
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+Subset an LVGL font generated by lv_font_conv (--format lvgl --no-compress)
+to a list of codepoints, without needing the original TTF.
+
+Glyph bitmaps and descriptors are copied as they are, only the bitmap
+indexes and the character mapping are rebuilt. Kerning is not supported
+(generate_fonts.sh doesn't produce any).
+
+Usage:
+  ./scripts/subset_font.py src/ui/ui_font_OpenSansLargeBold.c "0x20,0x25,0x2B-0x39,0x7E"
+"""
+
+import re
+import sys
+
+
+def parse_ranges(text):
+    codepoints = set()
+    for part in text.split(","):
+        part = part.strip()
+        if "-" in part:
+            start, end = part.split("-")
+            codepoints.update(range(int(start, 0), int(end, 0) + 1))
+        elif part:
+            codepoints.add(int(part, 0))
+    return codepoints
+
+
+def main(path, ranges):
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+
+    if not re.search(r"\.kern_dsc = NULL", source):
+        sys.exit("Fonts with kerning are not supported")
+
+    # Bitmaps: one "/* U+XXXX ... */" block per glyph, in glyph id order
+    bitmap_match = re.search(r"(glyph_bitmap\[\] = \{\n)(.*?)(\n\};)", source, re.S)
+    blocks = re.split(r"\n(?=    /\* U\+)", "\n" + bitmap_match.group(2))
+    blocks = [b for b in blocks if b.strip()]
+
+    dsc_match = re.search(r"(glyph_dsc\[\] = \{\n)(.*?)(\n\};)", source, re.S)
+    dsc_lines = [l.rstrip(",") for l in dsc_match.group(2).split("\n") if l.strip()]
+    reserved, dsc_lines = dsc_lines[0], dsc_lines[1:]
+    if len(dsc_lines) != len(blocks):
+        sys.exit("Glyph descriptors don't match bitmaps (%d vs %d)" % (len(dsc_lines), len(blocks)))
+
+    glyphs = []
+    offset = 0
+    for block, dsc in zip(blocks, dsc_lines):
+        comment, _, body = block.strip("\n").partition("\n")
+        codepoint = int(re.match(r"\s*/\* U\+([0-9A-F]+)", comment).group(1), 16)
+        size = len(re.findall(r"0x[0-9a-f]+", body))
+        if size > 0 and int(re.search(r"\.bitmap_index = (\d+)", dsc).group(1)) != offset:
+            sys.exit("Unexpected bitmap layout at U+%04X" % codepoint)
+        offset += size
+        glyphs.append((codepoint, comment, body.rstrip().rstrip(","), dsc.strip(), size))
+
+    wanted = parse_ranges(ranges)
+    kept = [g for g in glyphs if g[0] in wanted]
+    missing = wanted - set(g[0] for g in glyphs)
+    if missing:
+        print("Not in font: " + ", ".join("U+%04X" % c for c in sorted(missing)))
+
+    bitmaps = []
+    dscs = ["    " + reserved.strip()]
+    index = 0
+    for codepoint, comment, body, dsc, size in kept:
+        bitmaps.append(comment + "\n" + body + ",\n" if body else comment + "\n")
+        dscs.append("    " + re.sub(r"\.bitmap_index = \d+", ".bitmap_index = %d" % index, dsc))
+        index += size
+
+    # Contiguous codepoints form one FORMAT0_TINY range each
+    cmaps = []
+    glyph_id = 1
+    for codepoint, _, _, _, _ in kept:
+        if cmaps and cmaps[-1][0] + cmaps[-1][1] == codepoint:
+            cmaps[-1][1] += 1
+        else:
+            cmaps.append([codepoint, 1, glyph_id])
+        glyph_id += 1
+    cmap_text = ",\n".join(
+        "    {\n"
+        "        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+        "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n"
+        "    }" % (start, length, first) for start, length, first in cmaps)
+
+    source = (source[:bitmap_match.start(2)] + re.sub(r",\n$", "", "\n".join(bitmaps)) + source[bitmap_match.end(2):])
+    dsc_match = re.search(r"(glyph_dsc\[\] = \{\n)(.*?)(\n\};)", source, re.S)
+    source = source[:dsc_match.start(2)] + ",\n".join(dscs) + source[dsc_match.end(2):]
+    source = re.sub(r"(cmaps\[\] =\n\{\n)(.*?)(\n\};)", lambda m: m.group(1) + cmap_text + m.group(3), source, flags=re.S)
+    source = re.sub(r"\.cmap_num = \d+", ".cmap_num = %d" % len(cmaps), source)
+    source = re.sub(r"( \* Opts: .*)", lambda m: m.group(1) + "\n * Subset: " + ranges, source, count=1)
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(source)
+    print("%s: %d of %d glyphs, %d bitmap bytes" % (path, len(kept), len(glyphs), index))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    main(sys.argv[1], sys.argv[2])
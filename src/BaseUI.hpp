@@ -3,6 +3,8 @@
 #include <Arduino.h>
 #include <lvgl.h>
 #include <RemoteLogger.hpp>
+#include "utils/LvglPacer.hpp"
+#include "utils/Metrics.hpp"
 
 // Forward declaration
 class BaseUI;
@@ -43,6 +45,18 @@ public:
      * Get the currently active screen.
      */
     BaseUI* current() const { return currentScreen; }
+
+private:
+    static uint32_t countObjects(lv_obj_t* obj) {
+        if (obj == nullptr) {
+            return 0;
+        }
+        uint32_t count = 1;
+        for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+            count += countObjects(lv_obj_get_child(obj, i));
+        }
+        return count;
+    }
 };
 
 /**
@@ -53,7 +67,9 @@ public:
  * - update() - Updates UI with current data
  * - hide()   - Destroys UI elements, frees memory
  * 
- * Each screen owns its LVGL objects and manages their lifecycle.
+ * Each screen owns its LVGL objects and manages their lifecycle. When LVGL
+ * deletes the screen after a transition, hide() runs from the delete event
+ * so no widget pointers outlive their objects.
  */
 class BaseUI {
     friend class ScreenManager;  // Allow ScreenManager to access skipLoad
@@ -68,10 +84,9 @@ protected:
      * Call this at the beginning of show() implementation.
      */
     void createScreen() {
-        if (screen != nullptr) {
-            lv_obj_del(screen);
-        }
+        BaseUI::hide();
         screen = lv_obj_create(NULL);
+        lv_obj_add_event_cb(screen, onScreenDeleted, LV_EVENT_DELETE, this);
         initialized = true;
     }
     
@@ -107,14 +122,54 @@ protected:
      * Used when LVGL auto-deletes the screen after animation.
      */
     void markScreenDeleted() {
+        if (screen != nullptr) {
+            deletingScreen = screen;
+        }
         screen = nullptr;
         initialized = false;
     }
 
+    /**
+     * Duration of the last show(), per screen.
+     */
+    MetricGauge* buildTimeGauge() {
+        if (buildTime == nullptr) {
+            snprintf(metricLabels, sizeof(metricLabels), "screen=\"%s\"", name());
+            buildTime = Metrics::instance().gauge("ui_screen_build_ms", "Duration of the last screen build", metricLabels);
+        }
+        return buildTime;
+    }
+
+private:
+    lv_obj_t* deletingScreen = nullptr;  // Left to LVGL, still animating out
+    MetricGauge* buildTime = nullptr;
+    char metricLabels[32];                // Must outlive the metrics registry entry
+
+    /**
+     * LVGL deleted the screen (end of transition) - reset the widget pointers.
+     * Skipped when the screen was shown again meanwhile, the pointers then
+     * belong to the new object tree.
+     */
+    static void onScreenDeleted(lv_event_t* e) {
+        BaseUI* self = (BaseUI*)lv_event_get_user_data(e);
+        if (lv_event_get_target(e) != self->deletingScreen) {
+            return;
+        }
+        self->deletingScreen = nullptr;
+        if (self->screen == nullptr) {
+            self->hide();
+        }
+    }
+
 public:
     virtual ~BaseUI() {
         hide();
     }
+
+    /**
+     * Short name for logs and metrics.
+     */
+    virtual const char* name() const = 0;
     
     /**
      * Initialize and display the UI screen.
@@ -129,6 +184,14 @@ public:
      * Override in derived classes as needed.
      */
     virtual void update() {}
+
+    /**
+     * Frame rate cap while this screen is active.
+     * Screens with continuous animations can lower it to save CPU.
+     */
+    virtual uint8_t maxFrameRate() const {
+        return LVGL_PACER_DEFAULT_FPS;
+    }
     
     /**
      * Hide and destroy the UI screen.
@@ -136,8 +199,10 @@ public:
      */
     virtual void hide() {
         if (screen != nullptr) {
-            lv_obj_del(screen);
+            // Detach first, the delete event must not run hide() again
+            lv_obj_t* obj = screen;
             screen = nullptr;
+            lv_obj_del(obj);
         }
         initialized = false;
     }
@@ -177,15 +242,23 @@ inline void ScreenManager::switchTo(BaseUI* newScreen,
     newScreen->skipLoad = true;
     
     // Create new screen UI elements (but don't load yet)
+    unsigned long buildStart = millis();
     newScreen->show();
+    unsigned long buildMs = millis() - buildStart;
+    newScreen->buildTimeGauge()->set(buildMs);
+    LOGI("ScreenManager: %s built in %lu ms, %lu objects", newScreen->name(), buildMs,
+         (unsigned long)countObjects(newScreen->getScreen()));
     
     // Load with animation - LVGL will auto-delete old screen after animation
     newScreen->loadScreenAnim(anim, duration, true);
     
     // Mark old screen as deleted (LVGL will handle actual deletion)
-    if (currentScreen != nullptr) {
+    if (currentScreen != nullptr && currentScreen != newScreen) {
         currentScreen->markScreenDeleted();
     }
     
     currentScreen = newScreen;
+
+    LvglPacer::instance().setMaxFrameRate(newScreen->maxFrameRate());
+    LvglPacer::instance().wake();
 }
@@ -35,6 +35,9 @@ LV_FONT_DECLARE(ui_font_OpenSansMedium);
 LV_FONT_DECLARE(ui_font_OpenSansMediumBold);
 LV_FONT_DECLARE(ui_font_OpenSansSmall);
 #include "utils/UIBallAnimator.hpp"
+#include "utils/FrameProfiler.hpp"
+#include "utils/DashboardChangeTracker.hpp"
+#include "utils/ChartLayerCache.hpp"
 #include "Inverters/InverterResult.hpp"
 #include "Shelly/Shelly.hpp"
 #include "utils/UITextChangeAnimator.hpp"
@@ -64,6 +67,7 @@ typedef struct SpotChartData {
     ElectricityPriceTwoDays_t* priceResult;
     bool hasIntelligencePlan;                             // Zda máme platný plán
     bool hasValidPrices;                                  // Zda máme platné spotové ceny
+    ChartLayerCache *layerCache;                          // Cached bars and labels
 } SpotChartData_t;
 
 static lv_color_t getPriceLevelColor(PriceLevel_t level)
@@ -83,187 +87,233 @@ static lv_color_t getPriceLevelColor(PriceLevel_t level)
     }
 }
 
-static void electricity_price_draw_event_cb(lv_event_t *e)
+/**
+ * Draws price bars, current quarter highlight and time axis of the spot price chart.
+ * Used directly and as the painter of the cached chart layer.
+ */
+static void draw_spot_price_content(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj)
 {
-    lv_obj_draw_part_dsc_t *dsc = lv_event_get_draw_part_dsc(e);
-    lv_obj_t *obj = lv_event_get_target(e);
     SpotChartData_t *chartData = (SpotChartData_t *)lv_obj_get_user_data(obj);
     
     if (chartData == nullptr || chartData->priceResult == nullptr) return;
     ElectricityPriceTwoDays_t *electricityPriceResult = chartData->priceResult;
 
-    if (dsc->part == LV_PART_MAIN)
+    lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    lv_coord_t pad_right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
+    lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    lv_coord_t pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+    lv_coord_t w = (int32_t)lv_obj_get_content_width(obj);
+    lv_coord_t h = (int32_t)lv_obj_get_content_height(obj);
+    
+    // Determine if showing 1 or 2 days
+    bool showTwoDays = electricityPriceResult->hasTomorrowData;
+    uint32_t segmentCount = showTwoDays ? QUARTERS_TWO_DAYS : QUARTERS_OF_DAY;
+    
+    // Calculate segment width dynamically based on available width
+    int32_t segmentWidth = w / segmentCount;
+    if (segmentWidth < 1) segmentWidth = 1;
+    int32_t offset_x = (w - (segmentCount * segmentWidth)) / 2;  // Center the chart
+
+    // Scale from the zone maximum, extended by the extremes from the price index
+    float minPrice = min(0.0f, getMinimumElectricityPrice(*electricityPriceResult).electricityPrice);
+    float maxPrice = max(electricityPriceResult->scaleMaxValue, getMaximumElectricityPrice(*electricityPriceResult).electricityPrice);
+    float priceRange = maxPrice - minPrice;
+    if (priceRange < 0.1f) priceRange = 0.1f;  // Avoid division by zero
+    lv_coord_t chartHeight = h;
+
+    // Current quarter
+    time_t now = time(nullptr);
+    struct tm *timeinfo = localtime(&now);
+    int currentQuarter = (timeinfo->tm_hour * 60 + timeinfo->tm_min) / 15;
+
+    // Draw current quarter highlight
+    lv_draw_rect_dsc_t current_quarter_dsc;
+    lv_draw_rect_dsc_init(&current_quarter_dsc);
+    current_quarter_dsc.bg_opa = LV_OPA_50;
+    current_quarter_dsc.bg_color = isDarkMode ? lv_color_hex(0x555555) : lv_color_hex(0xAAAAAA);
+    lv_area_t cq_a;
+    cq_a.x1 = obj->coords.x1 + offset_x + currentQuarter * segmentWidth;
+    cq_a.x2 = cq_a.x1 + segmentWidth - 1;
+    cq_a.y1 = obj->coords.y1 + pad_top;
+    cq_a.y2 = obj->coords.y2 - pad_bottom;
+    lv_draw_rect(draw_ctx, &current_quarter_dsc, &cq_a);
+
+    // Draw price segments - merge consecutive segments with same price level
+    lv_draw_rect_dsc_t draw_rect_dsc;
+    lv_draw_rect_dsc_init(&draw_rect_dsc);
+    draw_rect_dsc.bg_opa = LV_OPA_30;
+    draw_rect_dsc.border_opa = LV_OPA_80;
+    draw_rect_dsc.border_width = 1;
+    
+    uint32_t i = 0;
+    while (i < segmentCount)
     {
-        lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
-        lv_coord_t pad_right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
-        lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
-        lv_coord_t pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
-        lv_coord_t w = (int32_t)lv_obj_get_content_width(obj);
-        lv_coord_t h = (int32_t)lv_obj_get_content_height(obj);
+        PriceLevel_t currentLevel = electricityPriceResult->prices[i].priceLevel;
+        float price = electricityPriceResult->prices[i].electricityPrice;
+        uint32_t runStart = i;
         
-        // Determine if showing 1 or 2 days
-        bool showTwoDays = electricityPriceResult->hasTomorrowData;
-        uint32_t segmentCount = showTwoDays ? QUARTERS_TWO_DAYS : QUARTERS_OF_DAY;
-        
-        // Calculate segment width dynamically based on available width
-        int32_t segmentWidth = w / segmentCount;
-        if (segmentWidth < 1) segmentWidth = 1;
-        int32_t offset_x = (w - (segmentCount * segmentWidth)) / 2;  // Center the chart
-
-        // Use pre-calculated max from the price result, calculate min on the fly (it's fast)
-        float minPrice = 0.0f;
-        float maxPrice = electricityPriceResult->scaleMaxValue;
-        for (uint32_t i = 0; i < segmentCount; i++) {
-            float price = electricityPriceResult->prices[i].electricityPrice;
-            if (price < minPrice) minPrice = price;
-            if (price > maxPrice) maxPrice = price;
+        // Find run of same price level (for merging)
+        while (i < segmentCount && electricityPriceResult->prices[i].priceLevel == currentLevel) {
+            i++;
         }
-        float priceRange = maxPrice - minPrice;
-        if (priceRange < 0.1f) priceRange = 0.1f;  // Avoid division by zero
-        lv_coord_t chartHeight = h;
-
-        // Current quarter
-        time_t now = time(nullptr);
-        struct tm *timeinfo = localtime(&now);
-        int currentQuarter = (timeinfo->tm_hour * 60 + timeinfo->tm_min) / 15;
-
-        // Draw current quarter highlight
-        lv_draw_rect_dsc_t current_quarter_dsc;
-        lv_draw_rect_dsc_init(&current_quarter_dsc);
-        current_quarter_dsc.bg_opa = LV_OPA_50;
-        current_quarter_dsc.bg_color = isDarkMode ? lv_color_hex(0x555555) : lv_color_hex(0xAAAAAA);
-        lv_area_t cq_a;
-        cq_a.x1 = obj->coords.x1 + offset_x + currentQuarter * segmentWidth;
-        cq_a.x2 = cq_a.x1 + segmentWidth - 1;
-        cq_a.y1 = obj->coords.y1 + pad_top;
-        cq_a.y2 = obj->coords.y2 - pad_bottom;
-        lv_draw_rect(dsc->draw_ctx, &current_quarter_dsc, &cq_a);
-
-        // Draw price segments - merge consecutive segments with same price level
-        lv_draw_rect_dsc_t draw_rect_dsc;
-        lv_draw_rect_dsc_init(&draw_rect_dsc);
-        draw_rect_dsc.bg_opa = LV_OPA_30;
-        draw_rect_dsc.border_opa = LV_OPA_80;
-        draw_rect_dsc.border_width = 1;
         
-        uint32_t i = 0;
-        while (i < segmentCount)
-        {
-            PriceLevel_t currentLevel = electricityPriceResult->prices[i].priceLevel;
-            float price = electricityPriceResult->prices[i].electricityPrice;
-            uint32_t runStart = i;
-            
-            // Find run of same price level (for merging)
-            while (i < segmentCount && electricityPriceResult->prices[i].priceLevel == currentLevel) {
-                i++;
-            }
-            
-            // Draw merged segment (but individual bars for price accuracy)
-            lv_color_t color = getPriceLevelColor(currentLevel);
-            draw_rect_dsc.bg_color = color;
-            draw_rect_dsc.border_color = color;
-            
-            for (uint32_t j = runStart; j < i; j++) {
-                float segPrice = electricityPriceResult->prices[j].electricityPrice;
-                lv_area_t a;
-                a.x1 = obj->coords.x1 + offset_x + j * segmentWidth;
-                a.x2 = a.x1 + segmentWidth - 1;
-                lv_coord_t barTopY = obj->coords.y1 + pad_top + (priceRange - segPrice + minPrice) * chartHeight / priceRange;
-                lv_coord_t barBottomY = obj->coords.y1 + pad_top + (priceRange + minPrice) * chartHeight / priceRange - 1;
-                a.y1 = barTopY;
-                a.y2 = barBottomY;
-                if (a.y1 > a.y2) {
-                    lv_coord_t temp = a.y1;
-                    a.y1 = a.y2;
-                    a.y2 = temp;
-                }
-                lv_draw_rect(dsc->draw_ctx, &draw_rect_dsc, &a);
+        // Draw merged segment (but individual bars for price accuracy)
+        lv_color_t color = getPriceLevelColor(currentLevel);
+        draw_rect_dsc.bg_color = color;
+        draw_rect_dsc.border_color = color;
+        
+        for (uint32_t j = runStart; j < i; j++) {
+            float segPrice = electricityPriceResult->prices[j].electricityPrice;
+            lv_area_t a;
+            a.x1 = obj->coords.x1 + offset_x + j * segmentWidth;
+            a.x2 = a.x1 + segmentWidth - 1;
+            lv_coord_t barTopY = obj->coords.y1 + pad_top + (priceRange - segPrice + minPrice) * chartHeight / priceRange;
+            lv_coord_t barBottomY = obj->coords.y1 + pad_top + (priceRange + minPrice) * chartHeight / priceRange - 1;
+            a.y1 = barTopY;
+            a.y2 = barBottomY;
+            if (a.y1 > a.y2) {
+                lv_coord_t temp = a.y1;
+                a.y1 = a.y2;
+                a.y2 = temp;
             }
+            lv_draw_rect(draw_ctx, &draw_rect_dsc, &a);
         }
+    }
 
-        // Draw x-axis time labels
-        lv_draw_label_dsc_t label_dsc;
-        label_dsc.font = &ui_font_OpenSansExtraSmall;
-        lv_draw_label_dsc_init(&label_dsc);
-        lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_dsc);
-        lv_area_t la;
-        la.y1 = obj->coords.y2 - pad_bottom + 2;
-        la.y2 = la.y1 + lv_font_get_line_height(label_dsc.font);
-        
-        if (showTwoDays)
+    // Draw x-axis time labels
+    lv_draw_label_dsc_t label_dsc;
+    label_dsc.font = &ui_font_OpenSansExtraSmall;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_dsc);
+    lv_area_t la;
+    la.y1 = obj->coords.y2 - pad_bottom + 2;
+    la.y2 = la.y1 + lv_font_get_line_height(label_dsc.font);
+    
+    if (showTwoDays)
+    {
+        // For 2 days: show 12:00, 00:00 (midnight separator), 12:00
+        int hours[] = {12, 24, 36};  // 12:00 today, 00:00 tomorrow, 12:00 tomorrow
+        for (int i = 0; i < 3; i++)
         {
-            // For 2 days: show 12:00, 00:00 (midnight separator), 12:00
-            int hours[] = {12, 24, 36};  // 12:00 today, 00:00 tomorrow, 12:00 tomorrow
-            for (int i = 0; i < 3; i++)
-            {
-                int quarter = hours[i] * 4;
-                int displayHour = hours[i] % 24;
-                String text = (displayHour < 10 ? "0" : "") + String(displayHour) + ":00";
-                lv_point_t size;
-                lv_txt_get_size(&size, text.c_str(), label_dsc.font, label_dsc.letter_space, label_dsc.line_space, LV_COORD_MAX, label_dsc.flag);
-                la.x1 = obj->coords.x1 + offset_x + quarter * segmentWidth + (segmentWidth - size.x) / 2;
-                la.x2 = la.x1 + size.x;
-                lv_draw_label(dsc->draw_ctx, &label_dsc, &la, text.c_str(), NULL);
-            }
+            int quarter = hours[i] * 4;
+            int displayHour = hours[i] % 24;
+            String text = (displayHour < 10 ? "0" : "") + String(displayHour) + ":00";
+            lv_point_t size;
+            lv_txt_get_size(&size, text.c_str(), label_dsc.font, label_dsc.letter_space, label_dsc.line_space, LV_COORD_MAX, label_dsc.flag);
+            la.x1 = obj->coords.x1 + offset_x + quarter * segmentWidth + (segmentWidth - size.x) / 2;
+            la.x2 = la.x1 + size.x;
+            lv_draw_label(draw_ctx, &label_dsc, &la, text.c_str(), NULL);
         }
-        else
+    }
+    else
+    {
+        // For 1 day: show 06:00, 12:00, 18:00
+        for (int hour = 6; hour <= 18; hour += 6)
         {
-            // For 1 day: show 06:00, 12:00, 18:00
-            for (int hour = 6; hour <= 18; hour += 6)
-            {
-                int quarter = hour * 4;
-                String text = (hour < 10 ? "0" : "") + String(hour) + ":00";
-                lv_point_t size;
-                lv_txt_get_size(&size, text.c_str(), label_dsc.font, label_dsc.letter_space, label_dsc.line_space, LV_COORD_MAX, label_dsc.flag);
-                la.x1 = obj->coords.x1 + offset_x + quarter * segmentWidth + (segmentWidth - size.x) / 2;
-                la.x2 = la.x1 + size.x;
-                lv_draw_label(dsc->draw_ctx, &label_dsc, &la, text.c_str(), NULL);
-            }
+            int quarter = hour * 4;
+            String text = (hour < 10 ? "0" : "") + String(hour) + ":00";
+            lv_point_t size;
+            lv_txt_get_size(&size, text.c_str(), label_dsc.font, label_dsc.letter_space, label_dsc.line_space, LV_COORD_MAX, label_dsc.flag);
+            la.x1 = obj->coords.x1 + offset_x + quarter * segmentWidth + (segmentWidth - size.x) / 2;
+            la.x2 = la.x1 + size.x;
+            lv_draw_label(draw_ctx, &label_dsc, &la, text.c_str(), NULL);
+        }
+    }
+}
+
+static void electricity_price_draw_event_cb(lv_event_t *e)
+{
+    lv_obj_draw_part_dsc_t *dsc = lv_event_get_draw_part_dsc(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    SpotChartData_t *chartData = (SpotChartData_t *)lv_obj_get_user_data(obj);
+
+    if (chartData == nullptr || chartData->priceResult == nullptr) return;
+
+    if (dsc->part == LV_PART_MAIN)
+    {
+        // Draw directly only until the cached layer is (re)built
+        if (chartData->layerCache == nullptr || !chartData->layerCache->draw(dsc->draw_ctx))
+        {
+            draw_spot_price_content(dsc->draw_ctx, obj);
         }
     }
 }
 
+/**
+ * Vertical line at the current quarter - drawn live, never baked into the cached layer.
+ */
+static void draw_solar_now_marker(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj)
+{
+    uint16_t pointCount = lv_chart_get_point_count(obj);
+    lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    lv_coord_t pad_right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
+    lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    lv_coord_t pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+    lv_coord_t w = lv_obj_get_content_width(obj);
+    
+    // Aktuální čtvrthodina
+    time_t now = time(nullptr);
+    struct tm *timeinfo = localtime(&now);
+    int currentQuarter = (timeinfo->tm_hour * 60 + timeinfo->tm_min) / 15;
+    
+    // Pozice čáry
+    float quarterWidth = (float)w / (float)pointCount;
+    lv_coord_t lineX = obj->coords.x1 + pad_left + (lv_coord_t)(currentQuarter * quarterWidth + quarterWidth / 2);
+    
+    // Vykreslení čáry aktuálního času
+    lv_draw_rect_dsc_t line_dsc;
+    lv_draw_rect_dsc_init(&line_dsc);
+    line_dsc.bg_opa = LV_OPA_70;
+    line_dsc.bg_color = lv_color_hex(0xFF4444);  // Červená barva pro lepší viditelnost
+    
+    lv_area_t line_a;
+    line_a.x1 = lineX - 1;
+    line_a.x2 = lineX + 1;
+    line_a.y1 = obj->coords.y1 + pad_top;
+    line_a.y2 = obj->coords.y2 - pad_bottom;
+    
+    lv_draw_rect(draw_ctx, &line_dsc, &line_a);
+}
+
+/**
+ * Painter of the cached solar chart layer - the chart's own drawing without the marker.
+ */
+static void solar_chart_layer_painter(lv_draw_ctx_t *draw_ctx, lv_obj_t *obj)
+{
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+}
+
+/**
+ * DRAW_MAIN preprocess: blit the cached layer and skip the chart's own drawing.
+ */
+static void solar_chart_layer_event_cb(lv_event_t *e)
+{
+    ChartLayerCache *layer = (ChartLayerCache *)lv_event_get_user_data(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    if (layer->draw(draw_ctx))
+    {
+        draw_solar_now_marker(draw_ctx, obj);
+        lv_event_stop_processing(e);
+    }
+}
+
 static void solar_chart_draw_event_cb(lv_event_t *e)
 {
     lv_obj_t *obj = lv_event_get_target(e);
     /*Add the faded area before the lines are drawn*/
     lv_obj_draw_part_dsc_t *dsc = lv_event_get_draw_part_dsc(e);
-    
-    // Zjistíme počet bodů v grafu (96 = 1 den, 192 = 2 dny)
-    uint16_t pointCount = lv_chart_get_point_count(obj);
-    bool showTwoDays = (pointCount > QUARTERS_OF_DAY);
+    ChartLayerCache *layer = (ChartLayerCache *)lv_event_get_user_data(e);
     
     // Vykreslení vertikální čáry aktuálního času
     if (dsc->part == LV_PART_MAIN)
     {
-        lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
-        lv_coord_t pad_right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
-        lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
-        lv_coord_t pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
-        lv_coord_t w = lv_obj_get_content_width(obj);
-        
-        // Aktuální čtvrthodina
-        time_t now = time(nullptr);
-        struct tm *timeinfo = localtime(&now);
-        int currentQuarter = (timeinfo->tm_hour * 60 + timeinfo->tm_min) / 15;
-        
-        // Pozice čáry
-        float quarterWidth = (float)w / (float)pointCount;
-        lv_coord_t lineX = obj->coords.x1 + pad_left + (lv_coord_t)(currentQuarter * quarterWidth + quarterWidth / 2);
-        
-        // Vykreslení čáry aktuálního času
-        lv_draw_rect_dsc_t line_dsc;
-        lv_draw_rect_dsc_init(&line_dsc);
-        line_dsc.bg_opa = LV_OPA_70;
-        line_dsc.bg_color = lv_color_hex(0xFF4444);  // Červená barva pro lepší viditelnost
-        
-        lv_area_t line_a;
-        line_a.x1 = lineX - 1;
-        line_a.x2 = lineX + 1;
-        line_a.y1 = obj->coords.y1 + pad_top;
-        line_a.y2 = obj->coords.y2 - pad_bottom;
-        
-        lv_draw_rect(dsc->draw_ctx, &line_dsc, &line_a);
+        if (layer == nullptr || !layer->isRendering())
+        {
+            draw_solar_now_marker(dsc->draw_ctx, obj);
+        }
     }
     else if (dsc->part == LV_PART_ITEMS)
     {
@@ -509,6 +559,9 @@ private:
     
     // Chart zoom state - which chart is currently expanded (nullptr = none)
     lv_obj_t *expandedChart = nullptr;
+
+    // Skips widget groups whose inputs did not change since last update()
+    DashboardChangeTracker changeTracker;
     
     // Intelligence plan tile
     lv_obj_t *intelligencePlanTile = nullptr;
@@ -2050,6 +2103,7 @@ public:
         spotChartData.priceResult = nullptr;
         spotChartData.hasIntelligencePlan = false;
         spotChartData.hasValidPrices = false;
+        spotChartData.layerCache = &spotChartLayer;
     }
 
     /**
@@ -2058,8 +2112,12 @@ public:
      */
     void initDashboardExtras() {
         // Register chart draw event handlers
-        lv_obj_add_event_cb(Chart1, solar_chart_draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+        lv_obj_add_event_cb(Chart1, solar_chart_draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, &solarChartLayer);
+        lv_obj_add_event_cb(Chart1, solar_chart_layer_event_cb, (lv_event_code_t)(LV_EVENT_DRAW_MAIN | LV_EVENT_PREPROCESS), &solarChartLayer);
         lv_obj_add_event_cb(spotPriceContainer, electricity_price_draw_event_cb, LV_EVENT_DRAW_PART_END, NULL);
+        // Both charts are redrawn from PSRAM layers, see ChartLayerCache
+        solarChartLayer.attach(Chart1, solar_chart_layer_painter, RightBottomContainer);
+        spotChartLayer.attach(spotPriceContainer, draw_spot_price_content, spotPriceContainer);
         lv_obj_add_event_cb(settingsButton, onSettingsShowCallback, LV_EVENT_RELEASED, NULL);
         
         // Add click handlers for chart expand/collapse
@@ -3294,12 +3352,41 @@ public:
         lv_label_set_text(intelligenceStatsConsumption, buf);
     }
 
+    /**
+     * "value unit" label text without heap allocations. An unchanged text is
+     * not set again, so the label is not invalidated.
+     */
+    static void setUnitText(lv_obj_t *label, Unit_t unit, float value, bool compact)
+    {
+        char text[24];
+        formatUnitText(text, sizeof(text), unit, lroundf(value), 1.0f, compact);
+        if (strcmp(lv_label_get_text(label), text) != 0)
+        {
+            lv_label_set_text(label, text);
+        }
+    }
+
+    /**
+     * Power flow balls animate all the time, 30 fps is smooth enough for them.
+     */
+    uint8_t maxFrameRate() const override
+    {
+        return 30;
+    }
+
+    const char* name() const override
+    {
+        return "dashboard";
+    }
+
     void show() override
     {
         hide();  // Clean up previous
         createScreen();  // Creates 'screen' from BaseUI
         createUI();  // Creates all UI elements
         initDashboardExtras();  // Create intelligence tile and setup event handlers
+        trackWithProfiler();
+        changeTracker.invalidateAll();
         
         // Clear all labels before loading screen to avoid placeholder glitch
         clearAllLabels();
@@ -3320,6 +3407,26 @@ public:
         loadScreen();
     }
 
+    /**
+     * Register the suspected expensive widgets with the frame profiler.
+     */
+    void trackWithProfiler()
+    {
+        pvAnimator.trackWithProfiler("balls.pv");
+        batteryAnimator.trackWithProfiler("balls.battery");
+        gridAnimator.trackWithProfiler("balls.grid");
+        loadAnimator.trackWithProfiler("balls.load");
+        FrameProfiler &profiler = FrameProfiler::instance();
+        profiler.track(pvLabel, "labels.power");
+        profiler.track(inverterPowerLabel, "labels.power");
+        profiler.track(loadPowerLabel, "labels.power");
+        profiler.track(feedInPowerLabel, "labels.power");
+        profiler.track(wallboxPowerLabel, "labels.power");
+        profiler.track(Chart1, "chart.solar");
+        profiler.track(spotPriceContainer, "chart.spot");
+        profiler.track(intelligencePlanTile, "intelligence.tile");
+    }
+
     void hide() override {
         // Reset all UI element pointers
         LeftContainer = nullptr;
@@ -3485,7 +3592,7 @@ public:
     void update(InverterData_t &inverterData, InverterData_t &previousInverterData, MedianPowerSampler &uiMedianPowerSampler, ShellyResult_t &shellyResult, ShellyResult_t &previousShellyResult, WallboxResult_t &wallboxResult, WallboxResult_t &previousWallboxResult, SolarChartDataProvider &solarChartDataProvider, ElectricityPriceTwoDays_t &electricityPriceResult, ElectricityPriceTwoDays_t &previousElectricityPriceResult, int wifiSignalPercent)
     {
         // hide settings and intelligence buttons after timeout from last touch
-        if (lastTouchMillis > 0 && millis() - lastTouchMillis > BUTTONS_HIDE_TIMEOUT_MS)
+        if (lastTouchMillis > 0 && millis() - lastTouchMillis > BUTTONS_HIDE_TIMEOUT_MS && !lv_obj_has_flag(settingsButton, LV_OBJ_FLAG_HIDDEN))
         {
             lv_obj_add_flag(settingsButton, LV_OBJ_FLAG_HIDDEN);
             if (intelligenceButton != nullptr && intelligenceSupported) {
@@ -3506,6 +3613,14 @@ public:
             isDarkMode = uiMedianPowerSampler.getMedianPVPower() == 0;
             uiMedianPowerSampler.resetSamples();
         }
+
+        // Only widget groups whose inputs changed are touched below - every
+        // flag, style or text set invalidates the object even if unchanged
+        time_t now = time(nullptr);
+        struct tm *timeinfo = localtime(&now);
+        uint32_t dirty = changeTracker.diff(inverterData, shellyResult, wallboxResult, electricityPriceResult, wifiSignalPercent, isDarkMode,
+                                            timeinfo->tm_hour * 4 + timeinfo->tm_min / 15);
+
         int selfUseEnergyTodayPercent = inverterData.loadToday > 0 ? ((inverterData.loadToday - inverterData.gridBuyToday) / inverterData.loadToday) * 100 : 0;
         selfUseEnergyTodayPercent = constrain(selfUseEnergyTodayPercent, 0, 100);
         int pvPower = inverterData.pv1Power + inverterData.pv2Power + inverterData.pv3Power + inverterData.pv4Power;
@@ -3535,36 +3650,42 @@ public:
         int l3PercentUsage = totalPhasePower > 0 ? (100 * max(0, inverterData.inverterOutpuPowerL3)) / totalPhasePower : 0;
         bool hasPhases = max(0, inverterData.inverterOutpuPowerL2) > 0 || max(0, inverterData.inverterOutpuPowerL3) > 0;
 
-        if (hasPhases)
+        if (dirty & DASHBOARD_DIRTY_INVERTER)
         {
-            // show inverter phase container
-            lv_obj_clear_flag(inverterPhasesContainer, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
-        {
-            lv_obj_add_flag(inverterPhasesContainer, LV_OBJ_FLAG_HIDDEN);
+            if (hasPhases)
+            {
+                // show inverter phase container
+                lv_obj_clear_flag(inverterPhasesContainer, LV_OBJ_FLAG_HIDDEN);
+            }
+            else
+            {
+                lv_obj_add_flag(inverterPhasesContainer, LV_OBJ_FLAG_HIDDEN);
+            }
         }
 
-        bool hasGridPhases = inverterData.gridPowerL2 != 0 || inverterData.gridPowerL3 != 0;
-        if (hasGridPhases)
-        {
-            // show grid phase container
-            lv_obj_clear_flag(meterPowerBarL1, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(meterPowerBarL2, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(meterPowerBarL3, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(meterPowerLabelL1, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(meterPowerLabelL2, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(meterPowerLabelL3, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
+        if (dirty & DASHBOARD_DIRTY_GRID)
         {
-            // hide grid phase container
-            lv_obj_add_flag(meterPowerBarL1, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(meterPowerBarL2, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(meterPowerBarL3, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(meterPowerLabelL1, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(meterPowerLabelL2, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(meterPowerLabelL3, LV_OBJ_FLAG_HIDDEN);
+            bool hasGridPhases = inverterData.gridPowerL2 != 0 || inverterData.gridPowerL3 != 0;
+            if (hasGridPhases)
+            {
+                // show grid phase container
+                lv_obj_clear_flag(meterPowerBarL1, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(meterPowerBarL2, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(meterPowerBarL3, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(meterPowerLabelL1, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(meterPowerLabelL2, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(meterPowerLabelL3, LV_OBJ_FLAG_HIDDEN);
+            }
+            else
+            {
+                // hide grid phase container
+                lv_obj_add_flag(meterPowerBarL1, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(meterPowerBarL2, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(meterPowerBarL3, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(meterPowerLabelL1, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(meterPowerLabelL2, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(meterPowerLabelL3, LV_OBJ_FLAG_HIDDEN);
+            }
         }
 
         lv_color_t black = lv_color_make(0, 0, 0);
@@ -3576,119 +3697,144 @@ public:
         pvPowerTextAnimator.animate(pvLabel,
                                     previousInverterData.pv1Power + previousInverterData.pv2Power + previousInverterData.pv3Power + previousInverterData.pv4Power,
                                     inverterData.pv1Power + inverterData.pv2Power + inverterData.pv3Power + inverterData.pv4Power);
-        lv_label_set_text(pv1Label, format(POWER, inverterData.pv1Power, 1.0f, true).formatted.c_str());
-        lv_label_set_text(pv2Label, format(POWER, inverterData.pv2Power, 1.0f, true).formatted.c_str());
-        lv_label_set_text(pv3Label, format(POWER, inverterData.pv3Power, 1.0f, true).formatted.c_str());
-        lv_label_set_text(pv4Label, format(POWER, inverterData.pv4Power, 1.0f, true).formatted.c_str());
-
-        if (inverterData.pv1Power == 0 || inverterData.pv2Power == 0)
-        { // hide
-            lv_obj_add_flag(pvStringsContainer, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
+        if (dirty & DASHBOARD_DIRTY_PV)
         {
-            lv_obj_clear_flag(pvStringsContainer, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (inverterData.pv3Power == 0 && inverterData.pv4Power == 0)
-        {
-            lv_obj_add_flag(pvStringsContainer1, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
-        {
-            lv_obj_clear_flag(pvStringsContainer1, LV_OBJ_FLAG_HIDDEN);
+            setUnitText(pv1Label, POWER, inverterData.pv1Power, true);
+            setUnitText(pv2Label, POWER, inverterData.pv2Power, true);
+            setUnitText(pv3Label, POWER, inverterData.pv3Power, true);
+            setUnitText(pv4Label, POWER, inverterData.pv4Power, true);
+
+            if (inverterData.pv1Power == 0 || inverterData.pv2Power == 0)
+            { // hide
+                lv_obj_add_flag(pvStringsContainer, LV_OBJ_FLAG_HIDDEN);
+            }
+            else
+            {
+                lv_obj_clear_flag(pvStringsContainer, LV_OBJ_FLAG_HIDDEN);
+            }
+            if (inverterData.pv3Power == 0 && inverterData.pv4Power == 0)
+            {
+                lv_obj_add_flag(pvStringsContainer1, LV_OBJ_FLAG_HIDDEN);
+            }
+            else
+            {
+                lv_obj_clear_flag(pvStringsContainer1, LV_OBJ_FLAG_HIDDEN);
+            }
         }
 
-        lv_label_set_text_fmt(inverterTemperatureLabel, "%d°C", inverterData.inverterTemperature);
-        if (inverterData.inverterTemperature > 50)
+        if (dirty & DASHBOARD_DIRTY_TEMPERATURE)
         {
-            lv_obj_set_style_bg_color(inverterTemperatureLabel, red, 0);
-            lv_obj_set_style_shadow_color(inverterTemperatureLabel, red, 0);
-            lv_obj_set_style_text_color(inverterTemperatureLabel, white, 0);
+            lv_label_set_text_fmt(inverterTemperatureLabel, "%d°C", inverterData.inverterTemperature);
+            if (inverterData.inverterTemperature > 50)
+            {
+                lv_obj_set_style_bg_color(inverterTemperatureLabel, red, 0);
+                lv_obj_set_style_shadow_color(inverterTemperatureLabel, red, 0);
+                lv_obj_set_style_text_color(inverterTemperatureLabel, white, 0);
+            }
+            else if (inverterData.inverterTemperature > 40)
+            {
+                lv_obj_set_style_bg_color(inverterTemperatureLabel, orange, 0);
+                lv_obj_set_style_shadow_color(inverterTemperatureLabel, orange, 0);
+                lv_obj_set_style_text_color(inverterTemperatureLabel, black, 0);
+            }
+            else
+            {
+                lv_obj_set_style_bg_color(inverterTemperatureLabel, green, 0);
+                lv_obj_set_style_shadow_color(inverterTemperatureLabel, green, 0);
+                lv_obj_set_style_text_color(inverterTemperatureLabel, white, 0);
+            }
+
+            if (inverterData.inverterTemperature == 0)
+            {
+                lv_obj_add_flag(inverterTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
+            }
+            else
+            {
+                lv_obj_clear_flag(inverterTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
+            }
         }
-        else if (inverterData.inverterTemperature > 40)
+
+        inverterPowerTextAnimator.animate(inverterPowerLabel, previousInverterPower, inverterPower);
+        pvBackgroundAnimator.animate(pvContainer, ((inverterData.pv1Power + inverterData.pv2Power + inverterData.pv3Power + inverterData.pv4Power) > 0) ? lv_color_hex(_ui_theme_color_pvColor[0]) : containerBackground);
+        if (dirty & (DASHBOARD_DIRTY_INVERTER | DASHBOARD_DIRTY_THEME))
         {
-            lv_obj_set_style_bg_color(inverterTemperatureLabel, orange, 0);
-            lv_obj_set_style_shadow_color(inverterTemperatureLabel, orange, 0);
-            lv_obj_set_style_text_color(inverterTemperatureLabel, black, 0);
+            lv_label_set_text(inverterPowerUnitLabel, format(POWER, inverterPower).unit.c_str());
+
+            // phases - záporný výkon střídače zobrazujeme jako 0
+            int displayL1Power = max(0, inverterData.inverterOutpuPowerL1);
+            int displayL2Power = max(0, inverterData.inverterOutpuPowerL2);
+            int displayL3Power = max(0, inverterData.inverterOutpuPowerL3);
+            
+            setUnitText(inverterPowerL1Label, POWER, displayL1Power, false);
+            lv_bar_set_value(inverterPowerBar1, min(2400, displayL1Power), LV_ANIM_ON);
+            lv_obj_set_style_bg_color(inverterPowerBar1, l1PercentUsage > 50 && displayL1Power > 1200 ? red : textColor, LV_PART_INDICATOR);
+            lv_obj_set_style_text_color(inverterPowerL1Label, l1PercentUsage > 50 && displayL1Power > 1200 ? red : textColor, 0);
+            setUnitText(inverterPowerL2Label, POWER, displayL2Power, false);
+            lv_bar_set_value(inverterPowerBar2, min(2400, displayL2Power), LV_ANIM_ON);
+            lv_obj_set_style_bg_color(inverterPowerBar2, l2PercentUsage > 50 && displayL2Power > 1200 ? red : textColor, LV_PART_INDICATOR);
+            lv_obj_set_style_text_color(inverterPowerL2Label, l2PercentUsage > 50 && displayL2Power > 1200 ? red : textColor, 0);
+            setUnitText(inverterPowerL3Label, POWER, displayL3Power, false);
+            lv_bar_set_value(inverterPowerBar3, min(2400, displayL3Power), LV_ANIM_ON);
+            lv_obj_set_style_bg_color(inverterPowerBar3, l3PercentUsage > 50 && displayL3Power > 1200 ? red : textColor, LV_PART_INDICATOR);
+            lv_obj_set_style_text_color(inverterPowerL3Label, l3PercentUsage > 50 && displayL3Power > 1200 ? red : textColor, 0);
         }
-        else
+
+        if (dirty & (DASHBOARD_DIRTY_GRID | DASHBOARD_DIRTY_THEME))
         {
-            lv_obj_set_style_bg_color(inverterTemperatureLabel, green, 0);
-            lv_obj_set_style_shadow_color(inverterTemperatureLabel, green, 0);
-            lv_obj_set_style_text_color(inverterTemperatureLabel, white, 0);
+            // grid phases
+            setUnitText(meterPowerLabelL1, POWER, inverterData.gridPowerL1, false);
+            lv_bar_set_value(meterPowerBarL1, max((int32_t)-2400, min((int32_t)2400, inverterData.gridPowerL1)), LV_ANIM_ON);
+            lv_obj_set_style_bg_color(meterPowerBarL1, inverterData.gridPowerL1 < 0 ? red : textColor, LV_PART_INDICATOR);
+            //lv_obj_set_style_text_color(meterPowerLabelL1, inverterData.gridPowerL1 < 0 ? red : textColor, 0);
+            setUnitText(meterPowerLabelL2, POWER, inverterData.gridPowerL2, false);
+            lv_bar_set_value(meterPowerBarL2, max((int32_t)-2400, min((int32_t)2400, inverterData.gridPowerL2)), LV_ANIM_ON);
+            lv_obj_set_style_bg_color(meterPowerBarL2, inverterData.gridPowerL2 < 0 ? red : textColor, LV_PART_INDICATOR);
+            //lv_obj_set_style_text_color(meterPowerLabelL2, inverterData.gridPowerL2 < 0 ? red : textColor, 0);
+            setUnitText(meterPowerLabelL3, POWER, inverterData.gridPowerL3, false);
+            lv_bar_set_value(meterPowerBarL3, max((int32_t)-2400, min((int32_t)2400, inverterData.gridPowerL3)), LV_ANIM_ON);
+            lv_obj_set_style_bg_color(meterPowerBarL3, inverterData.gridPowerL3 < 0 ? red : textColor, LV_PART_INDICATOR);
+            //lv_obj_set_style_text_color(meterPowerLabelL3, inverterData.gridPowerL3 < 0 ? red : textColor, 0);
         }
 
-        if (inverterData.inverterTemperature == 0)
+        loadPowerTextAnimator.animate(loadPowerLabel, previousInverterData.loadPower, inverterData.loadPower);
+        if (dirty & DASHBOARD_DIRTY_LOAD)
         {
-            lv_obj_add_flag(inverterTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
+            lv_label_set_text(loadPowerUnitLabel, format(POWER, inverterData.loadPower).unit.c_str());
         }
-        else
+        feedInPowerTextAnimator.animate(feedInPowerLabel, abs(previousGridPower), abs(gridPower));
+        if (dirty & DASHBOARD_DIRTY_GRID)
         {
-            lv_obj_clear_flag(inverterTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
+            lv_label_set_text(feedInPowerUnitLabel, format(POWER, abs(gridPower)).unit.c_str());
         }
-
-        inverterPowerTextAnimator.animate(inverterPowerLabel, previousInverterPower, inverterPower);
-        pvBackgroundAnimator.animate(pvContainer, ((inverterData.pv1Power + inverterData.pv2Power + inverterData.pv3Power + inverterData.pv4Power) > 0) ? lv_color_hex(_ui_theme_color_pvColor[0]) : containerBackground);
-        lv_label_set_text(inverterPowerUnitLabel, format(POWER, inverterPower).unit.c_str());
-
-        // phases - záporný výkon střídače zobrazujeme jako 0
-        int displayL1Power = max(0, inverterData.inverterOutpuPowerL1);
-        int displayL2Power = max(0, inverterData.inverterOutpuPowerL2);
-        int displayL3Power = max(0, inverterData.inverterOutpuPowerL3);
-        
-        lv_label_set_text(inverterPowerL1Label, format(POWER, displayL1Power, 1.0f, false).formatted.c_str());
-        lv_bar_set_value(inverterPowerBar1, min(2400, displayL1Power), LV_ANIM_ON);
-        lv_obj_set_style_bg_color(inverterPowerBar1, l1PercentUsage > 50 && displayL1Power > 1200 ? red : textColor, LV_PART_INDICATOR);
-        lv_obj_set_style_text_color(inverterPowerL1Label, l1PercentUsage > 50 && displayL1Power > 1200 ? red : textColor, 0);
-        lv_label_set_text(inverterPowerL2Label, format(POWER, displayL2Power, 1.0f, false).formatted.c_str());
-        lv_bar_set_value(inverterPowerBar2, min(2400, displayL2Power), LV_ANIM_ON);
-        lv_obj_set_style_bg_color(inverterPowerBar2, l2PercentUsage > 50 && displayL2Power > 1200 ? red : textColor, LV_PART_INDICATOR);
-        lv_obj_set_style_text_color(inverterPowerL2Label, l2PercentUsage > 50 && displayL2Power > 1200 ? red : textColor, 0);
-        lv_label_set_text(inverterPowerL3Label, format(POWER, displayL3Power, 1.0f, false).formatted.c_str());
-        lv_bar_set_value(inverterPowerBar3, min(2400, displayL3Power), LV_ANIM_ON);
-        lv_obj_set_style_bg_color(inverterPowerBar3, l3PercentUsage > 50 && displayL3Power > 1200 ? red : textColor, LV_PART_INDICATOR);
-        lv_obj_set_style_text_color(inverterPowerL3Label, l3PercentUsage > 50 && displayL3Power > 1200 ? red : textColor, 0);
-
-        // grid phases
-        lv_label_set_text(meterPowerLabelL1, format(POWER, inverterData.gridPowerL1, 1.0f, false).formatted.c_str());
-        lv_bar_set_value(meterPowerBarL1, max((int32_t)-2400, min((int32_t)2400, inverterData.gridPowerL1)), LV_ANIM_ON);
-        lv_obj_set_style_bg_color(meterPowerBarL1, inverterData.gridPowerL1 < 0 ? red : textColor, LV_PART_INDICATOR);
-        //lv_obj_set_style_text_color(meterPowerLabelL1, inverterData.gridPowerL1 < 0 ? red : textColor, 0);
-        lv_label_set_text(meterPowerLabelL2, format(POWER, inverterData.gridPowerL2, 1.0f, false).formatted.c_str());
-        lv_bar_set_value(meterPowerBarL2, max((int32_t)-2400, min((int32_t)2400, inverterData.gridPowerL2)), LV_ANIM_ON);
-        lv_obj_set_style_bg_color(meterPowerBarL2, inverterData.gridPowerL2 < 0 ? red : textColor, LV_PART_INDICATOR);
-        //lv_obj_set_style_text_color(meterPowerLabelL2, inverterData.gridPowerL2 < 0 ? red : textColor, 0);
-        lv_label_set_text(meterPowerLabelL3, format(POWER, inverterData.gridPowerL3, 1.0f, false).formatted.c_str());
-        lv_bar_set_value(meterPowerBarL3, max((int32_t)-2400, min((int32_t)2400, inverterData.gridPowerL3)), LV_ANIM_ON);
-        lv_obj_set_style_bg_color(meterPowerBarL3, inverterData.gridPowerL3 < 0 ? red : textColor, LV_PART_INDICATOR);
-        //lv_obj_set_style_text_color(meterPowerLabelL3, inverterData.gridPowerL3 < 0 ? red : textColor, 0);
-
-        loadPowerTextAnimator.animate(loadPowerLabel, previousInverterData.loadPower, inverterData.loadPower);
-        lv_label_set_text(loadPowerUnitLabel, format(POWER, inverterData.loadPower).unit.c_str());
-        feedInPowerTextAnimator.animate(feedInPowerLabel, abs(previousGridPower), abs(gridPower));
-        lv_label_set_text(feedInPowerUnitLabel, format(POWER, abs(gridPower)).unit.c_str());
         gridBackgroundAnimator.animate(gridContainer, (gridPower < 0) ? lv_color_hex(_ui_theme_color_gridColor[0]) : containerBackground);
-        lv_label_set_text_fmt(socLabel, (inverterData.socApproximated ? "~%d" : "%d"), inverterData.soc);
-
-        lv_label_set_text(batteryPowerLabel, format(POWER, abs(inverterData.batteryPower), 1.0f, true).formatted.c_str());
         batteryBackgroundAnimator.animate(batteryContainer, ((inverterData.batteryPower) < 0) ? lv_color_hex(_ui_theme_color_batteryColor[0]) : containerBackground);
-        updateBatteryIcon(inverterData.soc);
-        if (inverterData.batteryCapacityWh > 0)
+        if (dirty & DASHBOARD_DIRTY_BATTERY)
         {
-            if (abs(inverterData.batteryPower) > 100)
-            {
+            lv_label_set_text_fmt(socLabel, (inverterData.socApproximated ? "~%d" : "%d"), inverterData.soc);
 
-                if (inverterData.batteryPower < 0)
+            setUnitText(batteryPowerLabel, POWER, abs(inverterData.batteryPower), true);
+            updateBatteryIcon(inverterData.soc);
+            if (inverterData.batteryCapacityWh > 0)
+            {
+                if (abs(inverterData.batteryPower) > 100)
                 {
-                    int capacityRemainingWh = (inverterData.soc - inverterData.minSoc) * inverterData.batteryCapacityWh / 100;
-                    int secondsRemaining = (3600 * capacityRemainingWh) / abs(inverterData.batteryPower);
-                    lv_label_set_text_fmt(batteryTimeLabel, "%s - %d%%", formatTimeSpan(secondsRemaining).c_str(), inverterData.minSoc);
+
+                    if (inverterData.batteryPower < 0)
+                    {
+                        int capacityRemainingWh = (inverterData.soc - inverterData.minSoc) * inverterData.batteryCapacityWh / 100;
+                        int secondsRemaining = (3600 * capacityRemainingWh) / abs(inverterData.batteryPower);
+                        lv_label_set_text_fmt(batteryTimeLabel, "%s - %d%%", formatTimeSpan(secondsRemaining).c_str(), inverterData.minSoc);
+                    }
+                    else if (inverterData.batteryPower > 0)
+                    {
+                        int availableCapacityWh = (inverterData.maxSoc - inverterData.soc) * inverterData.batteryCapacityWh / 100;
+                        int secondsRemaining = (3600 * availableCapacityWh) / inverterData.batteryPower;
+                        lv_label_set_text_fmt(batteryTimeLabel, "%s - %d%%", formatTimeSpan(secondsRemaining).c_str(), inverterData.maxSoc);
+                    }
                 }
-                else if (inverterData.batteryPower > 0)
+                else
                 {
-                    int availableCapacityWh = (inverterData.maxSoc - inverterData.soc) * inverterData.batteryCapacityWh / 100;
-                    int secondsRemaining = (3600 * availableCapacityWh) / inverterData.batteryPower;
-                    lv_label_set_text_fmt(batteryTimeLabel, "%s - %d%%", formatTimeSpan(secondsRemaining).c_str(), inverterData.maxSoc);
+                    lv_label_set_text(batteryTimeLabel, "");
                 }
             }
             else
@@ -3696,265 +3842,282 @@ public:
                 lv_label_set_text(batteryTimeLabel, "");
             }
         }
-        else
-        {
-            lv_label_set_text(batteryTimeLabel, "");
-        }
-
-        lv_label_set_text_fmt(batteryTemperatureLabel, "%d°C", inverterData.batteryTemperature);
 
-        if (inverterData.batteryTemperature > 40)
+        if (dirty & DASHBOARD_DIRTY_TEMPERATURE)
         {
-            lv_obj_set_style_bg_color(batteryTemperatureLabel, red, 0);
-            lv_obj_set_style_shadow_color(batteryTemperatureLabel, red, 0);
-            lv_obj_set_style_text_color(batteryTemperatureLabel, white, 0);
-        }
-        else if (inverterData.batteryTemperature > 30)
-        {
-            lv_obj_set_style_bg_color(batteryTemperatureLabel, orange, 0);
-            lv_obj_set_style_shadow_color(batteryTemperatureLabel, orange, 0);
-            lv_obj_set_style_text_color(batteryTemperatureLabel, black, 0);
-        }
-        else
-        {
-            lv_obj_set_style_bg_color(batteryTemperatureLabel, green, 0);
-            lv_obj_set_style_shadow_color(batteryTemperatureLabel, green, 0);
-            lv_obj_set_style_text_color(batteryTemperatureLabel, white, 0);
-        }
+            lv_label_set_text_fmt(batteryTemperatureLabel, "%d°C", inverterData.batteryTemperature);
 
-        lv_label_set_text_fmt(selfUsePercentLabel, "%d%%", getSelfUsePowerPercent(inverterData));
-
-        if (getSelfUsePowerPercent(inverterData) > 50)
-        {
-            selfUseBackgroundAnimator.animate(selfUsePercentLabel, green);
-            // lv_obj_set_style_bg_color(selfUsePercentLabel, green, 0);
-        }
-        else if (getSelfUsePowerPercent(inverterData) > 30)
-        {
-            selfUseBackgroundAnimator.animate(selfUsePercentLabel, orange);
-            // lv_obj_set_style_bg_color(selfUsePercentLabel, orange, 0);
-        }
-        else
-        {
-            selfUseBackgroundAnimator.animate(selfUsePercentLabel, red);
-            // lv_obj_set_style_bg_color(selfUsePercentLabel, red, 0);
-        }
-        lv_label_set_text(yieldTodayLabel, format(ENERGY, inverterData.pvToday * 1000.0, 1).value.c_str());
-        lv_label_set_text(yieldTodayUnitLabel, format(ENERGY, inverterData.pvToday * 1000.0, 1).unit.c_str());
-        lv_label_set_text(yieldTotalLabel, format(ENERGY, inverterData.pvTotal * 1000.0, 1, true).value.c_str());
-        lv_label_set_text(yieldTotalUnitLabel, format(ENERGY, inverterData.pvTotal * 1000.0, 1, true).unit.c_str());
-        lv_label_set_text(gridSellTodayLabel, ("+" + format(ENERGY, inverterData.gridSellToday * 1000.0, 1).value).c_str());
-        lv_label_set_text(gridSellTodayUnitLabel, format(ENERGY, inverterData.gridSellToday * 1000.0, 1).unit.c_str());
-        lv_label_set_text(gridBuyTodayLabel, ("-" + format(ENERGY, inverterData.gridBuyToday * 1000.0, 1).value).c_str());
-        lv_obj_set_style_text_color(gridBuyTodayLabel, red, 0);
-        lv_obj_set_style_text_color(gridBuyTodayUnitLabel, red, 0);
-        lv_label_set_text(gridBuyTodayUnitLabel, format(ENERGY, inverterData.gridBuyToday * 1000.0, 1).unit.c_str());
-        lv_label_set_text(batteryChargedTodayLabel, ("+" + format(ENERGY, inverterData.batteryChargedToday * 1000.0, 1).value).c_str());
-        lv_label_set_text(batteryChargedTodayUnitLabel, (format(ENERGY, inverterData.batteryChargedToday * 1000.0, 1).unit).c_str());
-        lv_label_set_text(batteryDischargedTodayLabel, ("-" + format(ENERGY, inverterData.batteryDischargedToday * 1000.0, 1).value).c_str());
-        lv_label_set_text(batteryDischargedTodayUnitLabel, (format(ENERGY, inverterData.batteryDischargedToday * 1000.0, 1).unit).c_str());
-        lv_obj_set_style_text_color(batteryDischargedTodayLabel, red, 0);
-        lv_obj_set_style_text_color(batteryDischargedTodayUnitLabel, red, 0);
-        lv_label_set_text(loadTodayLabel, format(ENERGY, inverterData.loadToday * 1000.0, 1).value.c_str());
-        lv_label_set_text(loadTodayUnitLabel, format(ENERGY, inverterData.loadToday * 1000.0, 1).unit.c_str());
-
-        lv_label_set_text_fmt(selfUseTodayLabel, "%d", selfUseEnergyTodayPercent);
-        if (selfUseEnergyTodayPercent > 50)
-        {
-            lv_obj_set_style_text_color(selfUseTodayLabel, green, 0);
-            lv_obj_set_style_text_color(selfUseTodayUnitLabel, green, 0);
-        }
-        else if (selfUseEnergyTodayPercent > 30)
-        {
-            lv_obj_set_style_text_color(selfUseTodayLabel, orange, 0);
-            lv_obj_set_style_text_color(selfUseTodayUnitLabel, orange, 0);
-        }
-        else
-        {
-            lv_obj_set_style_text_color(selfUseTodayLabel, red, 0);
-            lv_obj_set_style_text_color(selfUseTodayUnitLabel, red, 0);
+            if (inverterData.batteryTemperature > 40)
+            {
+                lv_obj_set_style_bg_color(batteryTemperatureLabel, red, 0);
+                lv_obj_set_style_shadow_color(batteryTemperatureLabel, red, 0);
+                lv_obj_set_style_text_color(batteryTemperatureLabel, white, 0);
+            }
+            else if (inverterData.batteryTemperature > 30)
+            {
+                lv_obj_set_style_bg_color(batteryTemperatureLabel, orange, 0);
+                lv_obj_set_style_shadow_color(batteryTemperatureLabel, orange, 0);
+                lv_obj_set_style_text_color(batteryTemperatureLabel, black, 0);
+            }
+            else
+            {
+                lv_obj_set_style_bg_color(batteryTemperatureLabel, green, 0);
+                lv_obj_set_style_shadow_color(batteryTemperatureLabel, green, 0);
+                lv_obj_set_style_text_color(batteryTemperatureLabel, white, 0);
+            }
         }
 
-        if (inverterData.hasBattery)
+        if (dirty & (DASHBOARD_DIRTY_GRID | DASHBOARD_DIRTY_LOAD))
         {
-            lv_obj_clear_flag(batteryContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(batteryStatsContainer, LV_OBJ_FLAG_HIDDEN);
+            lv_label_set_text_fmt(selfUsePercentLabel, "%d%%", getSelfUsePowerPercent(inverterData));
+
+            if (getSelfUsePowerPercent(inverterData) > 50)
+            {
+                selfUseBackgroundAnimator.animate(selfUsePercentLabel, green);
+                // lv_obj_set_style_bg_color(selfUsePercentLabel, green, 0);
+            }
+            else if (getSelfUsePowerPercent(inverterData) > 30)
+            {
+                selfUseBackgroundAnimator.animate(selfUsePercentLabel, orange);
+                // lv_obj_set_style_bg_color(selfUsePercentLabel, orange, 0);
+            }
+            else
+            {
+                selfUseBackgroundAnimator.animate(selfUsePercentLabel, red);
+                // lv_obj_set_style_bg_color(selfUsePercentLabel, red, 0);
+            }
         }
-        else
+        if (dirty & DASHBOARD_DIRTY_ENERGY)
         {
-            lv_obj_add_flag(batteryContainer, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(batteryStatsContainer, LV_OBJ_FLAG_HIDDEN);
+            lv_label_set_text(yieldTodayLabel, format(ENERGY, inverterData.pvToday * 1000.0, 1).value.c_str());
+            lv_label_set_text(yieldTodayUnitLabel, format(ENERGY, inverterData.pvToday * 1000.0, 1).unit.c_str());
+            lv_label_set_text(yieldTotalLabel, format(ENERGY, inverterData.pvTotal * 1000.0, 1, true).value.c_str());
+            lv_label_set_text(yieldTotalUnitLabel, format(ENERGY, inverterData.pvTotal * 1000.0, 1, true).unit.c_str());
+            lv_label_set_text(gridSellTodayLabel, ("+" + format(ENERGY, inverterData.gridSellToday * 1000.0, 1).value).c_str());
+            lv_label_set_text(gridSellTodayUnitLabel, format(ENERGY, inverterData.gridSellToday * 1000.0, 1).unit.c_str());
+            lv_label_set_text(gridBuyTodayLabel, ("-" + format(ENERGY, inverterData.gridBuyToday * 1000.0, 1).value).c_str());
+            lv_obj_set_style_text_color(gridBuyTodayLabel, red, 0);
+            lv_obj_set_style_text_color(gridBuyTodayUnitLabel, red, 0);
+            lv_label_set_text(gridBuyTodayUnitLabel, format(ENERGY, inverterData.gridBuyToday * 1000.0, 1).unit.c_str());
+            lv_label_set_text(batteryChargedTodayLabel, ("+" + format(ENERGY, inverterData.batteryChargedToday * 1000.0, 1).value).c_str());
+            lv_label_set_text(batteryChargedTodayUnitLabel, (format(ENERGY, inverterData.batteryChargedToday * 1000.0, 1).unit).c_str());
+            lv_label_set_text(batteryDischargedTodayLabel, ("-" + format(ENERGY, inverterData.batteryDischargedToday * 1000.0, 1).value).c_str());
+            lv_label_set_text(batteryDischargedTodayUnitLabel, (format(ENERGY, inverterData.batteryDischargedToday * 1000.0, 1).unit).c_str());
+            lv_obj_set_style_text_color(batteryDischargedTodayLabel, red, 0);
+            lv_obj_set_style_text_color(batteryDischargedTodayUnitLabel, red, 0);
+            lv_label_set_text(loadTodayLabel, format(ENERGY, inverterData.loadToday * 1000.0, 1).value.c_str());
+            lv_label_set_text(loadTodayUnitLabel, format(ENERGY, inverterData.loadToday * 1000.0, 1).unit.c_str());
+
+            lv_label_set_text_fmt(selfUseTodayLabel, "%d", selfUseEnergyTodayPercent);
+            if (selfUseEnergyTodayPercent > 50)
+            {
+                lv_obj_set_style_text_color(selfUseTodayLabel, green, 0);
+                lv_obj_set_style_text_color(selfUseTodayUnitLabel, green, 0);
+            }
+            else if (selfUseEnergyTodayPercent > 30)
+            {
+                lv_obj_set_style_text_color(selfUseTodayLabel, orange, 0);
+                lv_obj_set_style_text_color(selfUseTodayUnitLabel, orange, 0);
+            }
+            else
+            {
+                lv_obj_set_style_text_color(selfUseTodayLabel, red, 0);
+                lv_obj_set_style_text_color(selfUseTodayUnitLabel, red, 0);
+            }
         }
 
-        if (shellyResult.pairedCount > 0)
+        if (dirty & DASHBOARD_DIRTY_BATTERY)
         {
-            lv_obj_clear_flag(shellyContainer, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
-        {
-            lv_obj_add_flag(shellyContainer, LV_OBJ_FLAG_HIDDEN);
+            if (inverterData.hasBattery)
+            {
+                lv_obj_clear_flag(batteryContainer, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(batteryStatsContainer, LV_OBJ_FLAG_HIDDEN);
+            }
+            else
+            {
+                lv_obj_add_flag(batteryContainer, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(batteryStatsContainer, LV_OBJ_FLAG_HIDDEN);
+            }
         }
-        lv_label_set_text(shellyPowerLabel, format(POWER, shellyResult.totalPower).formatted.c_str());
-        if (shellyResult.maxPercent > 0)
+
+        if (dirty & DASHBOARD_DIRTY_SHELLY)
         {
-            int uiPercent = shellyResult.maxPercent;
-            if (uiPercent < 60)
+            if (shellyResult.pairedCount > 0)
             {
-                uiPercent = 10;
+                lv_obj_clear_flag(shellyContainer, LV_OBJ_FLAG_HIDDEN);
             }
-            else if (uiPercent > 90)
+            else
+            {
+                lv_obj_add_flag(shellyContainer, LV_OBJ_FLAG_HIDDEN);
+            }
+            setUnitText(shellyPowerLabel, POWER, shellyResult.totalPower, false);
+            if (shellyResult.maxPercent > 0)
             {
-                uiPercent = 100;
+                int uiPercent = shellyResult.maxPercent;
+                if (uiPercent < 60)
+                {
+                    uiPercent = 10;
+                }
+                else if (uiPercent > 90)
+                {
+                    uiPercent = 100;
+                }
+                else
+                {
+                    uiPercent = map(uiPercent, 60, 90, 10, 100);
+                }
+
+                lv_label_set_text_fmt(shellyCountLabel, "%d%% / %d / %d", uiPercent, shellyResult.activeCount, shellyResult.pairedCount);
             }
             else
             {
-                uiPercent = map(uiPercent, 60, 90, 10, 100);
+                lv_label_set_text_fmt(shellyCountLabel, "%d / %d", shellyResult.activeCount, shellyResult.pairedCount);
             }
-
-            lv_label_set_text_fmt(shellyCountLabel, "%d%% / %d / %d", uiPercent, shellyResult.activeCount, shellyResult.pairedCount);
-        }
-        else
-        {
-            lv_label_set_text_fmt(shellyCountLabel, "%d / %d", shellyResult.activeCount, shellyResult.pairedCount);
         }
 
         wallboxPowerTextAnimator.animate(wallboxPowerLabel, previousWallboxResult.chargingPower, wallboxResult.chargingPower);
-        lv_label_set_text(wallboxPowerUnitLabel, format(POWER, wallboxResult.chargingPower).unit.c_str());
         wallboxBackgroundAnimator.animate(wallboxContainer, wallboxResult.chargingPower > 0 ? /*orange*/ containerBackground : containerBackground);
-        if (wallboxResult.chargingControlEnabled)
-        {
-            // show charging control
-            lv_obj_clear_flag(wallboxSmartCheckbox, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
+        if (dirty & DASHBOARD_DIRTY_WALLBOX)
         {
-            lv_obj_add_flag(wallboxSmartCheckbox, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (wallboxResult.evConnected)
-        {
-            lv_obj_clear_flag(wallboxPowerContainer, LV_OBJ_FLAG_HIDDEN);
-
-            // charged energy
-            if (wallboxResult.chargedEnergy > 0)
+            lv_label_set_text(wallboxPowerUnitLabel, format(POWER, wallboxResult.chargingPower).unit.c_str());
+            if (wallboxResult.chargingControlEnabled)
             {
-                lv_label_set_text(wallboxEnergyLabel, format(ENERGY, wallboxResult.chargedEnergy * 1000.0, 1).formatted.c_str());
-                lv_obj_clear_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                // show charging control
+                lv_obj_clear_flag(wallboxSmartCheckbox, LV_OBJ_FLAG_HIDDEN);
             }
             else
             {
-                lv_obj_add_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(wallboxSmartCheckbox, LV_OBJ_FLAG_HIDDEN);
             }
-        }
-        else
-        {
-            lv_obj_add_flag(wallboxPowerContainer, LV_OBJ_FLAG_HIDDEN);
-
-            // charged total energy
-            if (wallboxResult.totalChargedEnergy > 0)
+            if (wallboxResult.evConnected)
             {
-                lv_label_set_text(wallboxEnergyLabel, format(ENERGY, wallboxResult.totalChargedEnergy * 1000.0, 1, true).formatted.c_str());
-                lv_obj_clear_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_clear_flag(wallboxPowerContainer, LV_OBJ_FLAG_HIDDEN);
+
+                // charged energy
+                if (wallboxResult.chargedEnergy > 0)
+                {
+                    setUnitText(wallboxEnergyLabel, ENERGY, wallboxResult.chargedEnergy * 1000.0, false);
+                    lv_obj_clear_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                }
+                else
+                {
+                    lv_obj_add_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                }
             }
             else
             {
-                lv_obj_add_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
-            }
-        }
+                lv_obj_add_flag(wallboxPowerContainer, LV_OBJ_FLAG_HIDDEN);
 
-        if (wallboxResult.updated > 0)
-        {
-            // show container
-            lv_obj_clear_flag(wallboxContainer, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
-        {
-            lv_obj_add_flag(wallboxContainer, LV_OBJ_FLAG_HIDDEN);
-        }
+                // charged total energy
+                if (wallboxResult.totalChargedEnergy > 0)
+                {
+                    setUnitText(wallboxEnergyLabel, ENERGY, wallboxResult.totalChargedEnergy * 1000.0, true);
+                    lv_obj_clear_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                }
+                else
+                {
+                    lv_obj_add_flag(wallboxEnergyContainer, LV_OBJ_FLAG_HIDDEN);
+                }
+            }
 
-        // wallbox temperature
-        if (wallboxResult.temperature > 0)
-        {
-            lv_label_set_text_fmt(wallboxTemperatureLabel, "%d°C", wallboxResult.temperature);
-            if (wallboxResult.temperature > 40)
+            if (wallboxResult.updated > 0)
             {
-                lv_obj_set_style_bg_color(wallboxTemperatureLabel, red, 0);
-                lv_obj_set_style_shadow_color(wallboxTemperatureLabel, red, 0);
-                lv_obj_set_style_text_color(wallboxTemperatureLabel, white, 0);
+                // show container
+                lv_obj_clear_flag(wallboxContainer, LV_OBJ_FLAG_HIDDEN);
             }
-            else if (wallboxResult.temperature > 30)
+            else
             {
-                lv_obj_set_style_bg_color(wallboxTemperatureLabel, orange, 0);
-                lv_obj_set_style_shadow_color(wallboxTemperatureLabel, orange, 0);
-                lv_obj_set_style_text_color(wallboxTemperatureLabel, black, 0);
+                lv_obj_add_flag(wallboxContainer, LV_OBJ_FLAG_HIDDEN);
+            }
+
+            // wallbox temperature
+            if (wallboxResult.temperature > 0)
+            {
+                lv_label_set_text_fmt(wallboxTemperatureLabel, "%d°C", wallboxResult.temperature);
+                if (wallboxResult.temperature > 40)
+                {
+                    lv_obj_set_style_bg_color(wallboxTemperatureLabel, red, 0);
+                    lv_obj_set_style_shadow_color(wallboxTemperatureLabel, red, 0);
+                    lv_obj_set_style_text_color(wallboxTemperatureLabel, white, 0);
+                }
+                else if (wallboxResult.temperature > 30)
+                {
+                    lv_obj_set_style_bg_color(wallboxTemperatureLabel, orange, 0);
+                    lv_obj_set_style_shadow_color(wallboxTemperatureLabel, orange, 0);
+                    lv_obj_set_style_text_color(wallboxTemperatureLabel, black, 0);
+                }
+                else
+                {
+                    lv_obj_set_style_bg_color(wallboxTemperatureLabel, green, 0);
+                    lv_obj_set_style_shadow_color(wallboxTemperatureLabel, green, 0);
+                    lv_obj_set_style_text_color(wallboxTemperatureLabel, white, 0);
+                }
+                lv_obj_clear_flag(wallboxTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
             }
             else
             {
-                lv_obj_set_style_bg_color(wallboxTemperatureLabel, green, 0);
-                lv_obj_set_style_shadow_color(wallboxTemperatureLabel, green, 0);
-                lv_obj_set_style_text_color(wallboxTemperatureLabel, white, 0);
+                lv_obj_add_flag(wallboxTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
             }
-            lv_obj_clear_flag(wallboxTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
-        }
-        else
-        {
-            lv_obj_add_flag(wallboxTemperatureLabel, LV_OBJ_FLAG_HIDDEN);
-        }
 
-        // hide all logos
-        lv_obj_add_flag(wallboxLogoEcovolterImage, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_add_flag(wallboxLogoSolaxImage, LV_OBJ_FLAG_HIDDEN);
+            // hide all logos
+            lv_obj_add_flag(wallboxLogoEcovolterImage, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_add_flag(wallboxLogoSolaxImage, LV_OBJ_FLAG_HIDDEN);
 
-        switch (wallboxResult.type)
-        {
-        case WALLBOX_TYPE_SOLAX:
-            // show solax logo
-            lv_obj_clear_flag(wallboxLogoSolaxImage, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_shadow_color(wallboxContainer, lv_color_hex(_ui_theme_color_pvColor[0]), 0);
-            break;
-        case WALLBOX_TYPE_ECOVOLTER_PRO_V2:
-            // show ecovolter logo
-            lv_obj_clear_flag(wallboxLogoEcovolterImage, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_shadow_color(wallboxContainer, lv_color_hex(_ui_theme_color_loadColor[0]), 0);
-            break;
-        default:
-            break;
+            switch (wallboxResult.type)
+            {
+            case WALLBOX_TYPE_SOLAX:
+                // show solax logo
+                lv_obj_clear_flag(wallboxLogoSolaxImage, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_set_style_shadow_color(wallboxContainer, lv_color_hex(_ui_theme_color_pvColor[0]), 0);
+                break;
+            case WALLBOX_TYPE_ECOVOLTER_PRO_V2:
+                // show ecovolter logo
+                lv_obj_clear_flag(wallboxLogoEcovolterImage, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_set_style_shadow_color(wallboxContainer, lv_color_hex(_ui_theme_color_loadColor[0]), 0);
+                break;
+            default:
+                break;
+            }
         }
 
         updateSolarChart(inverterData, solarChartDataProvider, isDarkMode);
 
-        lv_obj_set_style_text_color(statusLabel, lv_palette_main(LV_PALETTE_DEEP_ORANGE), 0);
-
-        switch (inverterData.status)
+        if (dirty & DASHBOARD_DIRTY_STATUS)
         {
-        case DONGLE_STATUS_OK:
-            lv_obj_set_style_text_color(statusLabel, lv_palette_main(LV_PALETTE_GREY), 0);
-            lv_label_set_text_fmt(statusLabel, "%s %d%%", inverterData.sn.c_str(), wifiSignalPercent);
+            lv_obj_set_style_text_color(statusLabel, lv_palette_main(LV_PALETTE_DEEP_ORANGE), 0);
 
-            lv_label_set_text(dongleFWVersion, inverterData.dongleFWVersion.c_str());
-            if (inverterData.dongleFWVersion.isEmpty())
-            {
-                lv_obj_add_flag(dongleFWVersion, LV_OBJ_FLAG_HIDDEN);
-            }
-            else
+            switch (inverterData.status)
             {
-                lv_obj_clear_flag(dongleFWVersion, LV_OBJ_FLAG_HIDDEN);
+            case DONGLE_STATUS_OK:
+                lv_obj_set_style_text_color(statusLabel, lv_palette_main(LV_PALETTE_GREY), 0);
+                lv_label_set_text_fmt(statusLabel, "%s %d%%", inverterData.sn.c_str(), wifiSignalPercent);
+
+                lv_label_set_text(dongleFWVersion, inverterData.dongleFWVersion.c_str());
+                if (inverterData.dongleFWVersion.isEmpty())
+                {
+                    lv_obj_add_flag(dongleFWVersion, LV_OBJ_FLAG_HIDDEN);
+                }
+                else
+                {
+                    lv_obj_clear_flag(dongleFWVersion, LV_OBJ_FLAG_HIDDEN);
+                }
+                break;
+            case DONGLE_STATUS_CONNECTION_ERROR:
+                lv_label_set_text(statusLabel, TR(STR_CONNECTION_ERROR));
+                break;
+            case DONGLE_STATUS_HTTP_ERROR:
+                lv_label_set_text(statusLabel, TR(STR_HTTP_ERROR));
+                break;
+            case DONGLE_STATUS_JSON_ERROR:
+                lv_label_set_text(statusLabel, TR(STR_JSON_ERROR));
+                break;
+            case DONGLE_STATUS_WIFI_DISCONNECTED:
+                lv_label_set_text(statusLabel, TR(STR_WIFI_DISCONNECTED));
+                break;
+            default:
+                lv_label_set_text(statusLabel, TR(STR_UNKNOWN_ERROR));
+                break;
             }
-            break;
-        case DONGLE_STATUS_CONNECTION_ERROR:
-            lv_label_set_text(statusLabel, TR(STR_CONNECTION_ERROR));
-            break;
-        case DONGLE_STATUS_HTTP_ERROR:
-            lv_label_set_text(statusLabel, TR(STR_HTTP_ERROR));
-            break;
-        case DONGLE_STATUS_JSON_ERROR:
-            lv_label_set_text(statusLabel, TR(STR_JSON_ERROR));
-            break;
-        case DONGLE_STATUS_WIFI_DISCONNECTED:
-            lv_label_set_text(statusLabel, TR(STR_WIFI_DISCONNECTED));
-            break;
-        default:
-            lv_label_set_text(statusLabel, TR(STR_UNKNOWN_ERROR));
-            break;
         }
 
         // Update intelligence mode label
@@ -3963,7 +4126,8 @@ public:
         updateFlowAnimations(inverterData, shellyResult);
 
         // electricity spot price block - only update visibility if no chart is expanded
-        if (expandedChart == nullptr) {
+        bool spotPriceHidden = lv_obj_has_flag(spotPriceContainer, LV_OBJ_FLAG_HIDDEN);
+        if (expandedChart == nullptr && spotPriceHidden == (electricityPriceResult.updated > 0)) {
             if (electricityPriceResult.updated > 0)
             {
                 // show
@@ -3976,79 +4140,86 @@ public:
             }
         }
 
-        updateElectricityPriceChart(electricityPriceResult, isDarkMode);
-        updateCurrentPrice(electricityPriceResult, isDarkMode);
-
-        lv_obj_set_style_bg_color(screen, isDarkMode ? black : white, 0);
-        lv_obj_set_style_bg_color(LeftContainer, containerBackground, 0);
-        lv_obj_set_style_bg_opa(LeftContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        lv_obj_set_style_bg_color(pvStatsContainer, containerBackground, 0);
-        lv_obj_set_style_bg_opa(pvStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        lv_obj_set_style_bg_color(batteryStatsContainer, containerBackground, 0);
-        lv_obj_set_style_bg_opa(batteryStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        lv_obj_set_style_bg_color(gridStatsContainer, containerBackground, 0);
-        lv_obj_set_style_bg_opa(gridStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        lv_obj_set_style_bg_color(loadStatsContainer, containerBackground, 0);
-        lv_obj_set_style_bg_opa(loadStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        lv_obj_set_style_bg_color(RightBottomContainer, containerBackground, 0);
-        lv_obj_set_style_bg_opa(RightBottomContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        lv_obj_set_style_bg_color(inverterContainer, containerBackground, 0);
-        lv_obj_set_style_outline_color(inverterContainer, containerBackground, 0);
-        lv_obj_set_style_outline_opa(inverterContainer, LV_OPA_80, 0);
-        lv_obj_set_style_line_opa(Chart1, isDarkMode ? LV_OPA_20 : LV_OPA_COVER, LV_PART_MAIN);
-        lv_obj_set_style_bg_color(loadContainer, isDarkMode ? black : white, 0);
-        lv_obj_set_style_bg_color(spotPriceContainer, isDarkMode ? black : white, 0);
-        lv_obj_set_style_bg_opa(spotPriceContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        
-        // Intelligence plan tile dark mode
-        lv_obj_set_style_bg_color(intelligencePlanTile, isDarkMode ? black : white, 0);
-        lv_obj_set_style_bg_opa(intelligencePlanTile, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
-        if (intelligenceSummaryTitle != nullptr) {
-            lv_obj_set_style_text_color(intelligenceSummaryTitle, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
+        if (dirty & (DASHBOARD_DIRTY_PRICES | DASHBOARD_DIRTY_QUARTER | DASHBOARD_DIRTY_THEME))
+        {
+            updateElectricityPriceChart(electricityPriceResult, isDarkMode);
+            updateCurrentPrice(electricityPriceResult, isDarkMode);
         }
-        // Update detail view colors
-        for (int i = 0; i < VISIBLE_PLAN_ROWS; i++) {
-            if (intelligenceUpcomingTimes[i] != nullptr) {
-                lv_obj_set_style_text_color(intelligenceUpcomingTimes[i], isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
+
+        if (dirty & DASHBOARD_DIRTY_THEME)
+        {
+            lv_obj_set_style_bg_color(screen, isDarkMode ? black : white, 0);
+            lv_obj_set_style_bg_color(LeftContainer, containerBackground, 0);
+            lv_obj_set_style_bg_opa(LeftContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            lv_obj_set_style_bg_color(pvStatsContainer, containerBackground, 0);
+            lv_obj_set_style_bg_opa(pvStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            lv_obj_set_style_bg_color(batteryStatsContainer, containerBackground, 0);
+            lv_obj_set_style_bg_opa(batteryStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            lv_obj_set_style_bg_color(gridStatsContainer, containerBackground, 0);
+            lv_obj_set_style_bg_opa(gridStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            lv_obj_set_style_bg_color(loadStatsContainer, containerBackground, 0);
+            lv_obj_set_style_bg_opa(loadStatsContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            lv_obj_set_style_bg_color(RightBottomContainer, containerBackground, 0);
+            lv_obj_set_style_bg_opa(RightBottomContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            lv_obj_set_style_bg_color(inverterContainer, containerBackground, 0);
+            lv_obj_set_style_outline_color(inverterContainer, containerBackground, 0);
+            lv_obj_set_style_outline_opa(inverterContainer, LV_OPA_80, 0);
+            lv_obj_set_style_line_opa(Chart1, isDarkMode ? LV_OPA_20 : LV_OPA_COVER, LV_PART_MAIN);
+            solarChartLayer.invalidate();
+            lv_obj_set_style_bg_color(loadContainer, isDarkMode ? black : white, 0);
+            lv_obj_set_style_bg_color(spotPriceContainer, isDarkMode ? black : white, 0);
+            lv_obj_set_style_bg_opa(spotPriceContainer, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            
+            // Intelligence plan tile dark mode
+            lv_obj_set_style_bg_color(intelligencePlanTile, isDarkMode ? black : white, 0);
+            lv_obj_set_style_bg_opa(intelligencePlanTile, isDarkMode ? LV_OPA_80 : LV_OPA_80, 0);
+            if (intelligenceSummaryTitle != nullptr) {
+                lv_obj_set_style_text_color(intelligenceSummaryTitle, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
             }
-            if (intelligenceUpcomingReasons[i] != nullptr) {
-                lv_obj_set_style_text_color(intelligenceUpcomingReasons[i], isDarkMode ? lv_color_hex(0xAAAAAA) : lv_color_hex(0x666666), 0);
+            // Update detail view colors
+            for (int i = 0; i < VISIBLE_PLAN_ROWS; i++) {
+                if (intelligenceUpcomingTimes[i] != nullptr) {
+                    lv_obj_set_style_text_color(intelligenceUpcomingTimes[i], isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
+                }
+                if (intelligenceUpcomingReasons[i] != nullptr) {
+                    lv_obj_set_style_text_color(intelligenceUpcomingReasons[i], isDarkMode ? lv_color_hex(0xAAAAAA) : lv_color_hex(0x666666), 0);
+                }
+                // Timeline bullets and lines
+                if (intelligenceUpcomingBullets[i] != nullptr) {
+                    lv_obj_set_style_bg_color(intelligenceUpcomingBullets[i], isDarkMode ? lv_color_hex(0xAAAAAA) : lv_color_hex(0x333333), 0);
+                }
+                if (intelligenceUpcomingLines[i] != nullptr) {
+                    lv_obj_set_style_bg_color(intelligenceUpcomingLines[i], isDarkMode ? lv_color_hex(0x666666) : lv_color_hex(0x333333), 0);
+                }
             }
-            // Timeline bullets and lines
-            if (intelligenceUpcomingBullets[i] != nullptr) {
-                lv_obj_set_style_bg_color(intelligenceUpcomingBullets[i], isDarkMode ? lv_color_hex(0xAAAAAA) : lv_color_hex(0x333333), 0);
+            // Update stats colors - values and units same color
+            if (intelligenceStatsProduction != nullptr) {
+                lv_obj_set_style_text_color(intelligenceStatsProduction, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
             }
-            if (intelligenceUpcomingLines[i] != nullptr) {
-                lv_obj_set_style_bg_color(intelligenceUpcomingLines[i], isDarkMode ? lv_color_hex(0x666666) : lv_color_hex(0x333333), 0);
+            if (intelligenceStatsProductionUnit != nullptr) {
+                lv_obj_set_style_text_color(intelligenceStatsProductionUnit, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
             }
-        }
-        // Update stats colors - values and units same color
-        if (intelligenceStatsProduction != nullptr) {
-            lv_obj_set_style_text_color(intelligenceStatsProduction, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
-        }
-        if (intelligenceStatsProductionUnit != nullptr) {
-            lv_obj_set_style_text_color(intelligenceStatsProductionUnit, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
-        }
-        if (intelligenceStatsConsumption != nullptr) {
-            lv_obj_set_style_text_color(intelligenceStatsConsumption, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
-        }
-        if (intelligenceStatsConsumptionUnit != nullptr) {
-            lv_obj_set_style_text_color(intelligenceStatsConsumptionUnit, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
-        }
-        // Stats container border (separator)
-        if (intelligenceStatsContainer != nullptr) {
-            lv_obj_set_style_border_color(intelligenceStatsContainer, isDarkMode ? lv_color_hex(0x444444) : lv_color_hex(0xE0E0E0), 0);
-        }
-        // Vertical separator between stats
-        if (intelligenceStatsSeparator != nullptr) {
-            lv_obj_set_style_bg_color(intelligenceStatsSeparator, isDarkMode ? lv_color_hex(0x444444) : lv_color_hex(0xE0E0E0), 0);
-        }
-        
-        lv_obj_set_style_text_color(screen, isDarkMode ? white : black, 0);
-        lv_obj_set_style_text_color(selfUsePercentLabel, isDarkMode ? black : white, 0);
+            if (intelligenceStatsConsumption != nullptr) {
+                lv_obj_set_style_text_color(intelligenceStatsConsumption, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
+            }
+            if (intelligenceStatsConsumptionUnit != nullptr) {
+                lv_obj_set_style_text_color(intelligenceStatsConsumptionUnit, isDarkMode ? lv_color_hex(0xFFFFFF) : lv_color_hex(0x333333), 0);
+            }
+            // Stats container border (separator)
+            if (intelligenceStatsContainer != nullptr) {
+                lv_obj_set_style_border_color(intelligenceStatsContainer, isDarkMode ? lv_color_hex(0x444444) : lv_color_hex(0xE0E0E0), 0);
+            }
+            // Vertical separator between stats
+            if (intelligenceStatsSeparator != nullptr) {
+                lv_obj_set_style_bg_color(intelligenceStatsSeparator, isDarkMode ? lv_color_hex(0x444444) : lv_color_hex(0xE0E0E0), 0);
+            }
+            
+            lv_obj_set_style_text_color(screen, isDarkMode ? white : black, 0);
+            lv_obj_set_style_text_color(selfUsePercentLabel, isDarkMode ? black : white, 0);
 
-        lv_obj_set_style_bg_color(clocksLabel, containerBackground, 0);
-        lv_obj_set_style_text_color(clocksLabel, isDarkMode ? white : black, 0);
+            lv_obj_set_style_bg_color(clocksLabel, containerBackground, 0);
+            lv_obj_set_style_text_color(clocksLabel, isDarkMode ? white : black, 0);
+        }
     }
 
     void updateBatteryIcon(int soc)
@@ -4134,6 +4305,8 @@ private:
     UIBallAnimator shellyAnimator;
 
     SpotChartData_t spotChartData;  // Data pro graf spotových cen včetně plánu inteligence
+    ChartLayerCache spotChartLayer;
+    ChartLayerCache solarChartLayer;
 
     lv_chart_series_t *pvPowerSeries;
     lv_chart_series_t *acPowerSeries;
@@ -4210,6 +4383,7 @@ private:
         lv_chart_set_range(Chart1, LV_CHART_AXIS_SECONDARY_Y, 0, (lv_coord_t)maxPower);
         lv_obj_set_style_text_color(Chart1, isDarkMode ? lv_color_white() : lv_color_black(), LV_PART_TICKS);
         lv_chart_refresh(Chart1);
+        solarChartLayer.invalidate();
     }
 
     void updateCurrentPrice(ElectricityPriceTwoDays_t &electricityPriceResult, bool isDarkMode)
@@ -4240,6 +4414,7 @@ private:
         spotChartData.hasValidPrices = (electricityPriceResult.updated > 0);
         // Intelligence plan se aktualizuje separátně přes updateIntelligencePlan()
         lv_obj_set_user_data(spotPriceContainer, (void *)&spotChartData);
+        spotChartLayer.invalidate();
         lv_obj_invalidate(spotPriceContainer);
     }
 
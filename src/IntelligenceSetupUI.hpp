@@ -346,6 +346,10 @@ public:
 
     IntelligenceSetupUI() {}
 
+    const char* name() const override {
+        return "intelligence_setup";
+    }
+
     void show() override {
         hide();
         
@@ -8,6 +8,7 @@
 #include <CRC16.h>
 
 #include "ModbusResponse.hpp"
+#include "utils/Metrics.hpp"
 
 class ModbusRTU
 {
@@ -47,6 +48,8 @@ public:
     ModbusResponse sendDataRequest(IPAddress ipAddress, int port, uint16_t addr, uint8_t len)
     {
         ModbusResponse response{};
+        static MetricCounter *requestsTotal = Metrics::instance().counter("inverter_requests_total", "Read requests sent to inverter dongles");
+        requestsTotal->inc();
         udp.clear();
         if (!udp.beginPacket(ipAddress, port))
         {
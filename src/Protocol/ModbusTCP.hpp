@@ -4,6 +4,7 @@
 #include <RemoteLogger.hpp>
 #include "ModbusResponse.hpp"
 #include "utils/CustomNetworkClient.hpp"
+#include "utils/Metrics.hpp"
 
 class ModbusTCP
 {
@@ -40,6 +41,8 @@ public:
             return response;
         }
 
+        static MetricCounter *requestsTotal = Metrics::instance().counter("inverter_requests_total", "Read requests sent to inverter dongles");
+        requestsTotal->inc();
         sequenceNumber++;
 
         uint8_t request[] = {
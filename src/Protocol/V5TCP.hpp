@@ -6,6 +6,7 @@
 #include <CRC16.h>
 #include "utils/CustomNetworkClient.hpp"
 #include "Inverters/InverterResult.hpp"
+#include "utils/Metrics.hpp"
 
 // Increased timeout - dongles can be slow when busy with cloud communication
 #define V5TCP_READ_TIMEOUT_MS 5000
@@ -155,6 +156,8 @@ public:
             LOGE("SN is 0xFFFFFFFF (overflow), cannot send request. Check if SN has correct length (10 digits).");
             return false;
         }
+        static MetricCounter *requestsTotal = Metrics::instance().counter("inverter_requests_total", "Read requests sent to inverter dongles");
+        requestsTotal->inc();
         sequenceNumber++;
         lastSentSequence = sequenceNumber;  // Store for validation
         expectedSN = sn;                     // Store for validation
@@ -200,6 +200,11 @@ private:
     }
 
 public:
+    const char* name() const override
+    {
+        return "splash";
+    }
+
     void show() override
     {
         // Clean up any previous state
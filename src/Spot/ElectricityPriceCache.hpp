@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <RemoteLogger.hpp>
+#include <esp_heap_caps.h>
+#include <time.h>
+#include "ElectricityPriceResult.hpp"
+#include "utils/FlashMutex.hpp"
+
+#define PRICE_CACHE_SLOTS 3      // today, tomorrow and one spare for the day rollover
+#define PRICE_CACHE_VERSION 1
+
+/**
+ * Persistent store of day-ahead prices keyed by (bidding zone, local date).
+ *
+ * Published day-ahead prices don't change, so a day fetched once is served
+ * from here - instantly after a reboot and without HTTPS requests every
+ * refresh. Only days not yet present (mainly tomorrow after 13:00) go to
+ * the network.
+ *
+ * Raw EUR/MWh values are stored, the currency conversion is applied by
+ * ElectricityPriceLoader on every load, so new exchange rates still apply.
+ * Slots live in NVS (namespace "spotcache"), mirrored in PSRAM; writes go
+ * through FlashGuard.
+ */
+class ElectricityPriceCache
+{
+public:
+    static ElectricityPriceCache &instance()
+    {
+        static ElectricityPriceCache inst;
+        return inst;
+    }
+
+    /**
+     * Local date as YYYYMMDD, dayOffset 1 = tomorrow.
+     */
+    static uint32_t dateKey(int dayOffset)
+    {
+        time_t now = time(nullptr);
+        struct tm t;
+        localtime_r(&now, &t);
+        t.tm_mday += dayOffset;
+        t.tm_hour = 12; // away from DST transitions
+        t.tm_min = 0;
+        t.tm_sec = 0;
+        t.tm_isdst = -1;
+        mktime(&t);
+        return (t.tm_year + 1900) * 10000 + (t.tm_mon + 1) * 100 + t.tm_mday;
+    }
+
+    /**
+     * Copy cached raw prices (EUR/MWh) of the day into outPrices.
+     * @return true on a hit
+     */
+    bool get(uint8_t zone, uint32_t date, ElectricityPriceItem_t *outPrices, time_t &outFetched)
+    {
+        if (!ensureLoaded())
+        {
+            return false;
+        }
+        int slot = find(zone, date);
+        if (slot < 0)
+        {
+            return false;
+        }
+        for (int i = 0; i < QUARTERS_OF_DAY; i++)
+        {
+            outPrices[i].electricityPrice = slots[slot].raw[i];
+        }
+        outFetched = slots[slot].fetched;
+        return true;
+    }
+
+    /**
+     * Store a fetched day, replacing the slot with the oldest date.
+     */
+    void put(uint8_t zone, uint32_t date, const ElectricityPriceItem_t *prices, time_t fetched)
+    {
+        if (!ensureLoaded())
+        {
+            return;
+        }
+        int slot = find(zone, date);
+        if (slot < 0)
+        {
+            slot = 0;
+            for (int i = 1; i < PRICE_CACHE_SLOTS; i++)
+            {
+                if (slots[i].date < slots[slot].date)
+                {
+                    slot = i;
+                }
+            }
+        }
+        Slot_t &s = slots[slot];
+        s.version = PRICE_CACHE_VERSION;
+        s.zone = zone;
+        s.date = date;
+        s.fetched = fetched;
+        for (int i = 0; i < QUARTERS_OF_DAY; i++)
+        {
+            s.raw[i] = prices[i].electricityPrice;
+        }
+
+        FlashGuard guard("SpotCache:put");
+        if (!guard.isLocked())
+        {
+            return;
+        }
+        Preferences preferences;
+        preferences.begin("spotcache", false);
+        preferences.putBytes(slotKey(slot), &s, sizeof(Slot_t));
+        preferences.end();
+    }
+
+private:
+    typedef struct
+    {
+        uint8_t version;
+        uint8_t zone;
+        uint32_t date;   // YYYYMMDD, 0 = empty
+        time_t fetched;
+        float raw[QUARTERS_OF_DAY];
+    } Slot_t;
+
+    Slot_t *slots = nullptr;
+
+    ElectricityPriceCache() {}
+
+    static const char *slotKey(int slot)
+    {
+        static const char *KEYS[PRICE_CACHE_SLOTS] = {"d0", "d1", "d2"};
+        return KEYS[slot];
+    }
+
+    int find(uint8_t zone, uint32_t date) const
+    {
+        for (int i = 0; i < PRICE_CACHE_SLOTS; i++)
+        {
+            if (slots[i].date == date && slots[i].zone == zone)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    bool ensureLoaded()
+    {
+        if (slots != nullptr)
+        {
+            return true;
+        }
+        Slot_t *loaded = (Slot_t *)heap_caps_calloc(PRICE_CACHE_SLOTS, sizeof(Slot_t), MALLOC_CAP_SPIRAM);
+        if (loaded == nullptr)
+        {
+            LOGE("[PriceCache] Failed to allocate slots");
+            return false;
+        }
+        FlashGuard guard("SpotCache:load");
+        if (!guard.isLocked())
+        {
+            heap_caps_free(loaded);
+            return false;
+        }
+        Preferences preferences;
+        preferences.begin("spotcache", true);
+        for (int i = 0; i < PRICE_CACHE_SLOTS; i++)
+        {
+            if (preferences.getBytesLength(slotKey(i)) != sizeof(Slot_t) ||
+                preferences.getBytes(slotKey(i), &loaded[i], sizeof(Slot_t)) != sizeof(Slot_t) ||
+                loaded[i].version != PRICE_CACHE_VERSION)
+            {
+                memset(&loaded[i], 0, sizeof(Slot_t));
+            }
+        }
+        preferences.end();
+        slots = loaded;
+        return true;
+    }
+};
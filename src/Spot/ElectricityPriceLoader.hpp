@@ -4,6 +4,8 @@
 #include <RemoteLogger.hpp>
 #include <esp_heap_caps.h>
 #include "ElectricityPriceResult.hpp"
+#include "ElectricityPriceCache.hpp"
+#include "PriceArchive.hpp"
 #include "utils/FlashMutex.hpp"
 #include "utils/Localization.hpp"
 
@@ -230,6 +232,7 @@ public:
         
         outResult->updated = 0;
         outResult->hasTomorrowData = false;
+        memset(&outResult->prices[QUARTERS_OF_DAY], 0, sizeof(ElectricityPriceItem_t) * QUARTERS_OF_DAY);
         memset(outResult->currency, 0, CURRENCY_LENGTH);
         memset(outResult->energyUnit, 0, ENERGY_UNIT_LENGTH);
         
@@ -305,20 +308,36 @@ private:
         
         tempResult->updated = 0;
         
-        EnergyChartsAPI api;
-        api.reloadData(zoneInfo.apiCode, tomorrow, *tempResult);
-        
-        if (tempResult->updated == 0) {
-            LOGD("Failed to load electricity prices for %s", zoneInfo.apiCode);
-            delete tempResult;
-            return false;
+        // Zveřejněné ceny se nemění - den stažený jednou bereme z cache
+        ElectricityPriceCache& cache = ElectricityPriceCache::instance();
+        uint32_t date = ElectricityPriceCache::dateKey(tomorrow ? 1 : 0);
+        if (cache.get(provider, date, tempResult->prices, tempResult->updated)) {
+            LOGD("Electricity prices for %s %lu served from cache", zoneInfo.apiCode, (unsigned long)date);
+        } else {
+            EnergyChartsAPI api;
+            bool complete = false;
+            if (api.reloadData(zoneInfo.apiCode, tomorrow, *tempResult, complete) == 0) {
+                LOGD("Failed to load electricity prices for %s", zoneInfo.apiCode);
+                delete tempResult;
+                return false;
+            }
+            
+            // Partially published day (typically tomorrow around 13:00) is used as it is,
+            // but not cached - the next refresh fetches it again
+            if (complete) {
+                cache.put(provider, date, tempResult->prices, tempResult->updated);
+                PriceArchive::instance().put(provider, date, tempResult->prices);
+            } else {
+                LOGD("Electricity prices for %s %lu incomplete, not cached", zoneInfo.apiCode, (unsigned long)date);
+            }
+            
+            // Krátká pauza mezi HTTP voláními
+            delay(100);
         }
         
-        // Krátká pauza mezi HTTP voláními
-        delay(100);
-        
-        // Aktualizujeme kurzy (pokud je potřeba)
-        ExchangeRateLoader::getInstance()->updateRatesIfNeeded();
+        // Stored rates are used right away, a stale set is refreshed by the caller
+        // once the price downloads are done
+        ExchangeRateLoader::getInstance()->ensureStoredLoaded();
         
         // Získáme aktuální kurz
         float currencyRate = getCurrencyRate(zoneInfo.currCode, zoneInfo.defaultRate);
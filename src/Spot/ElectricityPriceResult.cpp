@@ -1,4 +1,5 @@
 #include "ElectricityPriceResult.hpp"
+#include <algorithm>
 
 float getTotalPrice(ElectricityPriceItem_t item)
 {
@@ -17,103 +18,155 @@ ElectricityPriceItem_t getCurrentQuarterElectricityPrice(const ElectricityPriceR
     return getQuarterElectricityPrice(result, timeinfo->tm_hour * 4 + timeinfo->tm_min / 15);
 }
 
-ElectricityPriceItem_t getMinimumElectricityPrice(const ElectricityPriceResult_t& result)
+ElectricityPriceItem_t getQuarterElectricityPriceTwoDays(const ElectricityPriceTwoDays_t& result, int quarter)
 {
-    ElectricityPriceItem_t min = result.prices[0];
-    for (int i = 1; i < QUARTERS_OF_DAY; i++)
-    {
-        if (getTotalPrice(result.prices[i]) < getTotalPrice(min))
-        {
-            min = result.prices[i];
-        }
+    if (quarter >= 0 && quarter < QUARTERS_TWO_DAYS) {
+        return result.prices[quarter];
     }
-    return min;
+    ElectricityPriceItem_t empty;
+    empty.electricityPrice = 0;
+    empty.priceLevel = PRICE_LEVEL_MEDIUM;
+    return empty;
 }
 
-ElectricityPriceItem_t getMaximumElectricityPrice(const ElectricityPriceResult_t& result)
+void buildElectricityPriceIndex(ElectricityPriceTwoDays_t& result)
 {
-    ElectricityPriceItem_t max = result.prices[0];
-    for (int i = 1; i < QUARTERS_OF_DAY; i++)
+    ElectricityPriceIndex_t& index = result.index;
+    int count = result.hasTomorrowData ? QUARTERS_TWO_DAYS : QUARTERS_OF_DAY;
+    index.count = count;
+
+    index.prefixSum[0] = 0;
+    for (int q = 0; q < count; q++)
     {
-        if (getTotalPrice(result.prices[i]) > getTotalPrice(max))
+        index.order[q] = q;
+        index.prefixSum[q + 1] = index.prefixSum[q] + result.prices[q].electricityPrice;
+    }
+
+    // Stable, so equal prices keep the order of the day
+    std::stable_sort(index.order, index.order + count, [&result](uint8_t a, uint8_t b) {
+        return result.prices[a].electricityPrice < result.prices[b].electricityPrice;
+    });
+    for (int i = 0; i < count; i++)
+    {
+        index.sorted[i] = result.prices[index.order[i]].electricityPrice;
+        bool tie = i > 0 && index.sorted[i] == index.sorted[i - 1];
+        index.rank[index.order[i]] = tie ? index.rank[index.order[i - 1]] : i + 1;
+    }
+
+    // Cheapest window of every length, earliest one on ties
+    for (int n = 1; n <= count; n++)
+    {
+        int best = 0;
+        float bestSum = index.prefixSum[n];
+        for (int start = 1; start + n <= count; start++)
         {
-            max = result.prices[i];
+            float sum = index.prefixSum[start + n] - index.prefixSum[start];
+            if (sum < bestSum)
+            {
+                bestSum = sum;
+                best = start;
+            }
         }
+        index.cheapestWindowStart[n - 1] = best;
     }
-    return max;
 }
 
-ElectricityPriceItem_t getAverageElectricityPrice(const ElectricityPriceResult_t& result)
+ElectricityPriceItem_t getMinimumElectricityPrice(const ElectricityPriceTwoDays_t& result)
+{
+    return getQuarterElectricityPriceTwoDays(result, getMinimumQuarterElectricityPrice(result));
+}
+
+ElectricityPriceItem_t getMaximumElectricityPrice(const ElectricityPriceTwoDays_t& result)
+{
+    return getQuarterElectricityPriceTwoDays(result, getMaximumQuarterElectricityPrice(result));
+}
+
+ElectricityPriceItem_t getAverageElectricityPrice(const ElectricityPriceTwoDays_t& result)
 {
     ElectricityPriceItem_t average;
-    average.electricityPrice = 0;
-    for (int i = 0; i < QUARTERS_OF_DAY; i++)
-    {
-        average.electricityPrice += result.prices[i].electricityPrice;
-    }
-    average.electricityPrice /= QUARTERS_OF_DAY;
+    average.electricityPrice = getAverageElectricityPrice(result, 0, result.index.count);
+    average.priceLevel = PRICE_LEVEL_MEDIUM;
     return average;
 }
 
-int getMinimumQuarterElectricityPrice(const ElectricityPriceResult_t& result)
+float getAverageElectricityPrice(const ElectricityPriceTwoDays_t& result, int fromQuarter, int quarters)
 {
-    ElectricityPriceItem_t min = result.prices[0];
-    int minIndex = 0;
-    for (int i = 1; i < QUARTERS_OF_DAY; i++)
+    const ElectricityPriceIndex_t& index = result.index;
+    fromQuarter = constrain(fromQuarter, 0, (int)index.count);
+    quarters = constrain(quarters, 0, index.count - fromQuarter);
+    if (quarters == 0)
     {
-        if (getTotalPrice(result.prices[i]) < getTotalPrice(min))
-        {
-            min = result.prices[i];
-            minIndex = i;
-        }
+        return 0;
     }
-    return minIndex;
+    return (index.prefixSum[fromQuarter + quarters] - index.prefixSum[fromQuarter]) / quarters;
 }
 
-int getMaximumQuarterElectricityPrice(const ElectricityPriceResult_t& result)
+int getMinimumQuarterElectricityPrice(const ElectricityPriceTwoDays_t& result)
 {
-    ElectricityPriceItem_t max = result.prices[0];
-    int maxIndex = 0;
-    for (int i = 1; i < QUARTERS_OF_DAY; i++)
-    {
-        if (getTotalPrice(result.prices[i]) > getTotalPrice(max))
-        {
-            max = result.prices[i];
-            maxIndex = i;
-        }
-    }
-    return maxIndex;
+    return result.index.count > 0 ? result.index.order[0] : -1;
+}
+
+int getMaximumQuarterElectricityPrice(const ElectricityPriceTwoDays_t& result)
+{
+    return result.index.count > 0 ? result.index.order[result.index.count - 1] : -1;
 }
 
-int getPriceRank(const ElectricityPriceResult_t& result, float price)
+int getQuarterPriceRank(const ElectricityPriceTwoDays_t& result, int quarter)
 {
-    int rank = 1;
-    for (int i = 0; i < QUARTERS_OF_DAY; i++)
+    if (quarter < 0 || quarter >= result.index.count)
     {
-        float quarterPrice = getTotalPrice(getQuarterElectricityPrice(result, i));
-        // count all prices lower than current, when same price is found, ranks same prices according to hour of day
-        if (quarterPrice < price)
-        {
-            rank++;
-        }
+        return 0;
     }
-    return rank;
+    return result.index.rank[quarter];
 }
 
-int getCurrentQuarterPriceRank(const ElectricityPriceResult_t& result)
+int getCurrentQuarterPriceRank(const ElectricityPriceTwoDays_t& result)
 {
     time_t now = time(nullptr);
     struct tm *timeinfo = localtime(&now);
-    return getPriceRank(result, timeinfo->tm_hour * 4 + timeinfo->tm_min / 15);
+    return getQuarterPriceRank(result, timeinfo->tm_hour * 4 + timeinfo->tm_min / 15);
 }
 
-ElectricityPriceItem_t getQuarterElectricityPriceTwoDays(const ElectricityPriceTwoDays_t& result, int quarter)
+int getPriceRank(const ElectricityPriceTwoDays_t& result, float price)
 {
-    if (quarter >= 0 && quarter < QUARTERS_TWO_DAYS) {
-        return result.prices[quarter];
+    // count all prices lower than given one
+    const float *sorted = result.index.sorted;
+    return (std::lower_bound(sorted, sorted + result.index.count, price) - sorted) + 1;
+}
+
+int getCheapestWindowStart(const ElectricityPriceTwoDays_t& result, int quarters)
+{
+    if (quarters < 1 || quarters > result.index.count)
+    {
+        return -1;
     }
-    ElectricityPriceItem_t empty;
-    empty.electricityPrice = 0;
-    empty.priceLevel = PRICE_LEVEL_MEDIUM;
-    return empty;
+    return result.index.cheapestWindowStart[quarters - 1];
+}
+
+int getCheapestWindowStart(const ElectricityPriceTwoDays_t& result, int quarters, int fromQuarter)
+{
+    const ElectricityPriceIndex_t& index = result.index;
+    fromQuarter = max(fromQuarter, 0);
+    if (quarters < 1 || fromQuarter + quarters > index.count)
+    {
+        return -1;
+    }
+    // The precomputed window is valid whenever it doesn't start in the past
+    int best = index.cheapestWindowStart[quarters - 1];
+    if (best >= fromQuarter)
+    {
+        return best;
+    }
+    best = fromQuarter;
+    float bestSum = index.prefixSum[fromQuarter + quarters] - index.prefixSum[fromQuarter];
+    for (int start = fromQuarter + 1; start + quarters <= index.count; start++)
+    {
+        float sum = index.prefixSum[start + quarters] - index.prefixSum[start];
+        if (sum < bestSum)
+        {
+            bestSum = sum;
+            best = start;
+        }
+    }
+    return best;
 }
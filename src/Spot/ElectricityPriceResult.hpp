@@ -32,6 +32,21 @@ typedef struct ElectricityPriceResult
     int pricesHorizontalSeparatorStep;
 } ElectricityPriceResult_t;
 
+/**
+ * Order statistics of the loaded prices, built once by buildElectricityPriceIndex()
+ * whenever the prices change, so extremes, ranks, averages and cheapest windows
+ * are answered without scanning all quarters on every call.
+ */
+typedef struct ElectricityPriceIndex
+{
+    uint16_t count;                                  // indexed quarters (96 or 192), 0 = not built
+    float sorted[QUARTERS_TWO_DAYS];                 // prices ascending
+    uint8_t order[QUARTERS_TWO_DAYS];                // quarter of sorted[i]
+    uint8_t rank[QUARTERS_TWO_DAYS];                 // 1 = cheapest, equal prices share a rank
+    float prefixSum[QUARTERS_TWO_DAYS + 1];          // prefixSum[q] = sum of prices before quarter q
+    uint8_t cheapestWindowStart[QUARTERS_TWO_DAYS];  // [n - 1] = start of the cheapest n contiguous quarters
+} ElectricityPriceIndex_t;
+
 // Rozšířená struktura pro dva dny - alokuje se v PSRAM
 typedef struct ElectricityPriceTwoDays
 {
@@ -42,6 +57,7 @@ typedef struct ElectricityPriceTwoDays
     char energyUnit[ENERGY_UNIT_LENGTH];
     float scaleMaxValue;
     int pricesHorizontalSeparatorStep;
+    ElectricityPriceIndex_t index;
 } ElectricityPriceTwoDays_t;
 
 typedef struct CurrentPrice
@@ -53,13 +69,20 @@ typedef struct CurrentPrice
 float getTotalPrice(ElectricityPriceItem_t item);
 ElectricityPriceItem_t getQuarterElectricityPrice(const ElectricityPriceResult_t& result, int quarter);
 ElectricityPriceItem_t getCurrentQuarterElectricityPrice(const ElectricityPriceResult_t& result);
-ElectricityPriceItem_t getMinimumElectricityPrice(const ElectricityPriceResult_t& result);
-ElectricityPriceItem_t getMaximumElectricityPrice(const ElectricityPriceResult_t& result);
-ElectricityPriceItem_t getAverageElectricityPrice(const ElectricityPriceResult_t& result);
-int getMinimumQuarterElectricityPrice(const ElectricityPriceResult_t& result);
-int getMaximumQuarterElectricityPrice(const ElectricityPriceResult_t& result);
-int getCurrentQuarterPriceRank(const ElectricityPriceResult_t& result);
-int getPriceRank(const ElectricityPriceResult_t& result, float price);
 
 // Funkce pro dvoudenní strukturu
-ElectricityPriceItem_t getQuarterElectricityPriceTwoDays(const ElectricityPriceTwoDays_t& result, int quarter);
\ No newline at end of file
+ElectricityPriceItem_t getQuarterElectricityPriceTwoDays(const ElectricityPriceTwoDays_t& result, int quarter);
+
+// Queries over ElectricityPriceTwoDays_t::index, all O(1) unless noted
+void buildElectricityPriceIndex(ElectricityPriceTwoDays_t& result);
+ElectricityPriceItem_t getMinimumElectricityPrice(const ElectricityPriceTwoDays_t& result);
+ElectricityPriceItem_t getMaximumElectricityPrice(const ElectricityPriceTwoDays_t& result);
+ElectricityPriceItem_t getAverageElectricityPrice(const ElectricityPriceTwoDays_t& result);
+float getAverageElectricityPrice(const ElectricityPriceTwoDays_t& result, int fromQuarter, int quarters);
+int getMinimumQuarterElectricityPrice(const ElectricityPriceTwoDays_t& result);
+int getMaximumQuarterElectricityPrice(const ElectricityPriceTwoDays_t& result);
+int getQuarterPriceRank(const ElectricityPriceTwoDays_t& result, int quarter);
+int getCurrentQuarterPriceRank(const ElectricityPriceTwoDays_t& result);
+int getPriceRank(const ElectricityPriceTwoDays_t& result, float price);  // O(log n)
+int getCheapestWindowStart(const ElectricityPriceTwoDays_t& result, int quarters);
+int getCheapestWindowStart(const ElectricityPriceTwoDays_t& result, int quarters, int fromQuarter);  // O(n) for fromQuarter > 0
\ No newline at end of file
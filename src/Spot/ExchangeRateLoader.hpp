@@ -5,13 +5,30 @@
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
+#include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include <time.h>
+#include "utils/FlashMutex.hpp"
+
+#define EXCHANGE_RATES_VERSION 1
+#define EXCHANGE_RATES_COUNT 10
+#define EXCHANGE_RATES_TASK_STACK (8 * 1024)
 
 /**
  * Loader pro směnné kurzy z Frankfurter API (ECB data)
  * https://api.frankfurter.app/
  * 
  * Kurzy se aktualizují denně a jsou cachovány.
+ *
+ * Fetched rates are stored in NVS (namespace "fxrates") with their fetch
+ * time and served from there right after boot. A stale set is still used
+ * while refreshInBackground() fetches a new one on a one-shot task, so
+ * price loading never waits for Frankfurter. getGeneration() changes only
+ * when a rate actually changed, callers reconvert prices then.
+ *
+ * Rates, lastUpdate and generation are written by the refresh task and
+ * read by the main loop, always under lock.
  */
 class ExchangeRateLoader
 {
@@ -33,9 +50,85 @@ private:
     
     // Interval aktualizace (24 hodin)
     static const unsigned long UPDATE_INTERVAL = 24 * 60 * 60;
-    
+
+    typedef struct
+    {
+        uint8_t version;
+        time_t fetched;
+        float rates[EXCHANGE_RATES_COUNT];
+    } Stored_t;
+
+    uint32_t generation = 0;
+    volatile bool refreshing = false;
+    bool storedLoaded = false;
+    mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
     ExchangeRateLoader() {}
 
+    float *rateSlots[EXCHANGE_RATES_COUNT] = {&rateCZK, &ratePLN, &rateSEK, &rateNOK, &rateDKK,
+                                              &rateHUF, &rateBGN, &rateRON, &rateCHF, &rateGBP};
+
+    /**
+     * Take a set of rates into use.
+     * @return true when any rate differs from the one in use
+     */
+    bool apply(const float *rates, time_t fetched)
+    {
+        bool changed = false;
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < EXCHANGE_RATES_COUNT; i++)
+        {
+            changed |= rates[i] != *rateSlots[i];
+            *rateSlots[i] = rates[i];
+        }
+        lastUpdate = fetched;
+        if (changed)
+        {
+            generation++;
+        }
+        portEXIT_CRITICAL(&lock);
+        return changed;
+    }
+
+    void store()
+    {
+        Stored_t stored;
+        memset(&stored, 0, sizeof(stored));
+        stored.version = EXCHANGE_RATES_VERSION;
+        portENTER_CRITICAL(&lock);
+        stored.fetched = lastUpdate;
+        for (int i = 0; i < EXCHANGE_RATES_COUNT; i++)
+        {
+            stored.rates[i] = *rateSlots[i];
+        }
+        portEXIT_CRITICAL(&lock);
+        FlashGuard guard("FxRates:store");
+        if (!guard.isLocked())
+        {
+            return;
+        }
+        Preferences preferences;
+        preferences.begin("fxrates", false);
+        preferences.putBytes("rates", &stored, sizeof(Stored_t));
+        preferences.end();
+    }
+
+    float readRate(const float &rate) const
+    {
+        portENTER_CRITICAL(&lock);
+        float value = rate;
+        portEXIT_CRITICAL(&lock);
+        return value;
+    }
+
+    static void refreshTask(void *param)
+    {
+        ExchangeRateLoader *self = (ExchangeRateLoader *)param;
+        self->fetchRates();
+        self->refreshing = false;
+        vTaskDelete(NULL);
+    }
+
 public:
     // Singleton - použití Meyers' Singleton pattern (thread-safe v C++11+)
     static ExchangeRateLoader* getInstance()
@@ -45,20 +138,63 @@ public:
     }
     
     /**
-     * Načte aktuální kurzy z API (pokud je potřeba)
-     * @return true pokud se podařilo načíst nebo jsou kurzy aktuální
+     * Serve the rates stored by the last successful fetch, once after boot.
+     * Call from the task that loads prices, before converting them.
      */
-    bool updateRatesIfNeeded()
+    void ensureStoredLoaded()
     {
-        time_t now = time(NULL);
-        
-        // Kontrola, zda je potřeba aktualizovat
-        if (lastUpdate > 0 && (now - lastUpdate) < UPDATE_INTERVAL) {
-            LOGD("ExchangeRates: Using cached rates (age: %ld seconds)", (long)(now - lastUpdate));
-            return true;
+        if (storedLoaded)
+        {
+            return;
+        }
+        storedLoaded = true;
+        Stored_t stored;
+        bool ok = false;
+        {
+            FlashGuard guard("FxRates:load");
+            if (!guard.isLocked())
+            {
+                storedLoaded = false;
+                return;
+            }
+            Preferences preferences;
+            preferences.begin("fxrates", true);
+            ok = preferences.getBytesLength("rates") == sizeof(Stored_t) &&
+                 preferences.getBytes("rates", &stored, sizeof(Stored_t)) == sizeof(Stored_t) &&
+                 stored.version == EXCHANGE_RATES_VERSION;
+            preferences.end();
+        }
+        if (!ok)
+        {
+            return;
+        }
+        apply(stored.rates, stored.fetched);
+        LOGD("ExchangeRates: Loaded stored rates (age: %ld seconds), CZK=%.2f",
+             (long)(time(NULL) - stored.fetched), stored.rates[0]);
+    }
+
+
+    /**
+     * Start a background fetch when the rates are older than a day (or
+     * missing). Never blocks on the network. The fetch opens its own TLS
+     * session, so call it when no other HTTPS download is running and wait
+     * for isRefreshing() to clear before starting one.
+     */
+    void refreshInBackground()
+    {
+        ensureStoredLoaded();
+        time_t updated = getLastUpdateTime();
+        if (updated > 0 && (time(NULL) - updated) < UPDATE_INTERVAL) {
+            return;
+        }
+        if (refreshing) {
+            return;
+        }
+        refreshing = true;
+        if (xTaskCreatePinnedToCore(refreshTask, "fxrates", EXCHANGE_RATES_TASK_STACK, this, 1, NULL, 0) != pdPASS) {
+            LOGW("ExchangeRates: Failed to start refresh task");
+            refreshing = false;
         }
-        
-        return fetchRates();
     }
     
     /**
@@ -103,22 +239,26 @@ public:
                         JsonObject rates = (*doc)["rates"];
                         
                         if (!rates.isNull()) {
-                            if (rates.containsKey("CZK")) rateCZK = rates["CZK"].as<float>();
-                            if (rates.containsKey("PLN")) ratePLN = rates["PLN"].as<float>();
-                            if (rates.containsKey("SEK")) rateSEK = rates["SEK"].as<float>();
-                            if (rates.containsKey("NOK")) rateNOK = rates["NOK"].as<float>();
-                            if (rates.containsKey("DKK")) rateDKK = rates["DKK"].as<float>();
-                            if (rates.containsKey("HUF")) rateHUF = rates["HUF"].as<float>();
-                            if (rates.containsKey("BGN")) rateBGN = rates["BGN"].as<float>();
-                            if (rates.containsKey("RON")) rateRON = rates["RON"].as<float>();
-                            if (rates.containsKey("CHF")) rateCHF = rates["CHF"].as<float>();
-                            if (rates.containsKey("GBP")) rateGBP = rates["GBP"].as<float>();
+                            static const char *CODES[EXCHANGE_RATES_COUNT] = {"CZK", "PLN", "SEK", "NOK", "DKK",
+                                                                              "HUF", "BGN", "RON", "CHF", "GBP"};
+                            // Rates missing in the response keep their current value
+                            float fetched[EXCHANGE_RATES_COUNT];
+                            portENTER_CRITICAL(&lock);
+                            for (int i = 0; i < EXCHANGE_RATES_COUNT; i++) {
+                                fetched[i] = *rateSlots[i];
+                            }
+                            portEXIT_CRITICAL(&lock);
+                            for (int i = 0; i < EXCHANGE_RATES_COUNT; i++) {
+                                if (rates.containsKey(CODES[i])) {
+                                    fetched[i] = rates[CODES[i]].as<float>();
+                                }
+                            }
                             
-                            lastUpdate = time(NULL);
+                            bool changed = apply(fetched, time(NULL));
                             success = true;
                             
-                            LOGD("ExchangeRates: Updated - CZK=%.2f, PLN=%.2f, SEK=%.2f, NOK=%.2f, DKK=%.2f",
-                                 rateCZK, ratePLN, rateSEK, rateNOK, rateDKK);
+                            LOGD("ExchangeRates: Updated - CZK=%.2f, PLN=%.2f, SEK=%.2f, NOK=%.2f, DKK=%.2f%s",
+                                 fetched[0], fetched[1], fetched[2], fetched[3], fetched[4], changed ? "" : " (unchanged)");
                         }
                         else
                         {
@@ -150,22 +290,26 @@ public:
         delete https;
         delete client;
         
+        if (success) {
+            store();
+        }
+        
         yield();
         
         return success;
     }
     
     // Gettery pro jednotlivé kurzy
-    float getCZK() const { return rateCZK; }
-    float getPLN() const { return ratePLN; }
-    float getSEK() const { return rateSEK; }
-    float getNOK() const { return rateNOK; }
-    float getDKK() const { return rateDKK; }
-    float getHUF() const { return rateHUF; }
-    float getBGN() const { return rateBGN; }
-    float getRON() const { return rateRON; }
-    float getCHF() const { return rateCHF; }
-    float getGBP() const { return rateGBP; }
+    float getCZK() const { return readRate(rateCZK); }
+    float getPLN() const { return readRate(ratePLN); }
+    float getSEK() const { return readRate(rateSEK); }
+    float getNOK() const { return readRate(rateNOK); }
+    float getDKK() const { return readRate(rateDKK); }
+    float getHUF() const { return readRate(rateHUF); }
+    float getBGN() const { return readRate(rateBGN); }
+    float getRON() const { return readRate(rateRON); }
+    float getCHF() const { return readRate(rateCHF); }
+    float getGBP() const { return readRate(rateGBP); }
     
     /**
      * Vrátí kurz pro danou měnu
@@ -174,28 +318,50 @@ public:
      */
     float getRate(const char* currencyCode) const
     {
-        if (strcmp(currencyCode, "CZK") == 0) return rateCZK;
-        if (strcmp(currencyCode, "PLN") == 0) return ratePLN;
-        if (strcmp(currencyCode, "SEK") == 0) return rateSEK;
-        if (strcmp(currencyCode, "NOK") == 0) return rateNOK;
-        if (strcmp(currencyCode, "DKK") == 0) return rateDKK;
-        if (strcmp(currencyCode, "HUF") == 0) return rateHUF;
-        if (strcmp(currencyCode, "BGN") == 0) return rateBGN;
-        if (strcmp(currencyCode, "RON") == 0) return rateRON;
-        if (strcmp(currencyCode, "CHF") == 0) return rateCHF;
-        if (strcmp(currencyCode, "GBP") == 0) return rateGBP;
+        if (strcmp(currencyCode, "CZK") == 0) return getCZK();
+        if (strcmp(currencyCode, "PLN") == 0) return getPLN();
+        if (strcmp(currencyCode, "SEK") == 0) return getSEK();
+        if (strcmp(currencyCode, "NOK") == 0) return getNOK();
+        if (strcmp(currencyCode, "DKK") == 0) return getDKK();
+        if (strcmp(currencyCode, "HUF") == 0) return getHUF();
+        if (strcmp(currencyCode, "BGN") == 0) return getBGN();
+        if (strcmp(currencyCode, "RON") == 0) return getRON();
+        if (strcmp(currencyCode, "CHF") == 0) return getCHF();
+        if (strcmp(currencyCode, "GBP") == 0) return getGBP();
         return 1.0f; // EUR nebo neznámá měna
     }
     
     /**
      * Vrátí čas poslední aktualizace
      */
-    time_t getLastUpdateTime() const { return lastUpdate; }
+    time_t getLastUpdateTime() const
+    {
+        portENTER_CRITICAL(&lock);
+        time_t updated = lastUpdate;
+        portEXIT_CRITICAL(&lock);
+        return updated;
+    }
     
     /**
      * Kontrola, zda byly kurzy někdy načteny
      */
-    bool hasValidRates() const { return lastUpdate > 0; }
+    bool hasValidRates() const { return getLastUpdateTime() > 0; }
+
+    /**
+     * Changes whenever the rates in use change (stored ones loaded, fetch with new values)
+     */
+    uint32_t getGeneration() const
+    {
+        portENTER_CRITICAL(&lock);
+        uint32_t current = generation;
+        portEXIT_CRITICAL(&lock);
+        return current;
+    }
+
+    /**
+     * True while the background fetch runs
+     */
+    bool isRefreshing() const { return refreshing; }
     
     // Zabránění kopírování
     ExchangeRateLoader(const ExchangeRateLoader&) = delete;
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <RemoteLogger.hpp>
+#include "ElectricityPriceResult.hpp"
+#include "utils/FlashMutex.hpp"
+
+#define PRICE_ARCHIVE_DIR "/prices"
+#define PRICE_ARCHIVE_LEGACY_PATH "/prices.bin" // single-file layout of version 1
+#define PRICE_ARCHIVE_SLOTS 400                 // a year and a month, ~80 kB
+#define PRICE_ARCHIVE_SLOTS_PER_FILE 20         // header + 20 records fill one 4 kB block
+#define PRICE_ARCHIVE_BLOCK_SIZE 4096           // LittleFS block on the ESP32 flash
+#define PRICE_ARCHIVE_VERSION 2
+#define PRICE_ARCHIVE_MAGIC 0x43524150          // "PARC"
+#define PRICE_ARCHIVE_MISSING INT16_MIN         // quarter without a price
+
+/**
+ * Ring archive of past days' day-ahead prices in LittleFS.
+ *
+ * Every day fetched from the network is stored as raw EUR/MWh, like in
+ * ElectricityPriceCache, so any exchange rate can be applied later. A day
+ * takes one fixed-size record: zone, date and a scale for int16 quarter
+ * prices. The slot of a date is (days since epoch) % slots, a new day
+ * overwrites the one PRICE_ARCHIVE_SLOTS days older.
+ *
+ * The slots are split into files of PRICE_ARCHIVE_SLOTS_PER_FILE records
+ * that fit a single LittleFS block. LittleFS rewrites a file from the
+ * modified block to its end, so storing a day rewrites one block instead
+ * of the rest of an 80 kB file. A file is created on the first put() into
+ * it and never grows afterwards.
+ *
+ * begin() mounts the file system once from the main loop (STATE_SPLASH),
+ * until then put() and get() do nothing. After that any task may use the
+ * archive, file access goes through FlashGuard.
+ */
+class PriceArchive
+{
+public:
+    static PriceArchive &instance()
+    {
+        static PriceArchive inst;
+        return inst;
+    }
+
+    /**
+     * Mount LittleFS (formatting it when the mount fails) and prepare the
+     * archive directory. Call once from the main loop before prices load.
+     */
+    void begin()
+    {
+        if (ready)
+        {
+            return;
+        }
+        bool mounted = false;
+        bool legacyRemoved = false;
+        {
+            FlashGuard guard("PriceArchive:begin");
+            if (!guard.isLocked())
+            {
+                return;
+            }
+            mounted = LittleFS.begin(true);
+            if (mounted && !LittleFS.exists(PRICE_ARCHIVE_DIR))
+            {
+                mounted = LittleFS.mkdir(PRICE_ARCHIVE_DIR);
+            }
+            if (mounted && LittleFS.exists(PRICE_ARCHIVE_LEGACY_PATH))
+            {
+                legacyRemoved = LittleFS.remove(PRICE_ARCHIVE_LEGACY_PATH);
+            }
+        }
+        if (!mounted)
+        {
+            LOGE("[PriceArchive] LittleFS mount failed");
+            return;
+        }
+        if (legacyRemoved)
+        {
+            LOGI("[PriceArchive] Removed %s of the old layout", PRICE_ARCHIVE_LEGACY_PATH);
+        }
+        ready = true;
+    }
+
+    /**
+     * Archive a day of raw prices (EUR/MWh).
+     */
+    void put(uint8_t zone, uint32_t date, const ElectricityPriceItem_t *prices)
+    {
+        if (!ready)
+        {
+            return;
+        }
+        Record_t record;
+        memset(&record, 0, sizeof(record));
+        record.date = date;
+        record.zone = zone;
+
+        float maxAbs = 0;
+        for (int i = 0; i < QUARTERS_OF_DAY; i++)
+        {
+            if (!isnan(prices[i].electricityPrice))
+            {
+                maxAbs = max(maxAbs, fabsf(prices[i].electricityPrice));
+            }
+        }
+        // Finest step that still fits the day's range, 0.01 EUR/MWh at least
+        record.scale = max(maxAbs / (INT16_MAX - 1), 0.01f);
+        for (int i = 0; i < QUARTERS_OF_DAY; i++)
+        {
+            float price = prices[i].electricityPrice;
+            record.quarters[i] = isnan(price) ? PRICE_ARCHIVE_MISSING : (int16_t)lroundf(price / record.scale);
+        }
+
+        char path[24];
+        int32_t slot = slotOf(date);
+        pathOf(slot, path, sizeof(path));
+        bool created = false;
+        bool ok = false;
+        {
+            FlashGuard guard("PriceArchive:put");
+            if (guard.isLocked())
+            {
+                File file = LittleFS.exists(path) ? LittleFS.open(path, "r+") : File();
+                if (!hasValidHeader(file))
+                {
+                    file.close();
+                    file = create(path);
+                    created = true;
+                }
+                ok = file && file.seek(offsetOf(slot)) && file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+                file.close();
+            }
+        }
+        if (created)
+        {
+            LOGI("[PriceArchive] Created %s", path);
+        }
+        if (ok)
+        {
+            LOGD("[PriceArchive] Stored %lu zone %d", (unsigned long)date, zone);
+        }
+        else
+        {
+            LOGW("[PriceArchive] Failed to store %lu", (unsigned long)date);
+        }
+    }
+
+    /**
+     * Read an archived day as raw EUR/MWh, NAN for quarters without a price.
+     * @return false when the date is not in the archive
+     */
+    bool get(uint32_t date, uint8_t &outZone, float *outPrices)
+    {
+        if (!ready)
+        {
+            return false;
+        }
+        char path[24];
+        int32_t slot = slotOf(date);
+        pathOf(slot, path, sizeof(path));
+        Record_t record;
+        bool ok = false;
+        {
+            FlashGuard guard("PriceArchive:get");
+            if (guard.isLocked() && LittleFS.exists(path))
+            {
+                File file = LittleFS.open(path, "r");
+                ok = hasValidHeader(file) && file.seek(offsetOf(slot)) &&
+                     file.read((uint8_t *)&record, sizeof(record)) == sizeof(record);
+                file.close();
+            }
+        }
+        if (!ok || record.date != date)
+        {
+            return false;
+        }
+        outZone = record.zone;
+        for (int i = 0; i < QUARTERS_OF_DAY; i++)
+        {
+            outPrices[i] = record.quarters[i] == PRICE_ARCHIVE_MISSING ? NAN : record.quarters[i] * record.scale;
+        }
+        return true;
+    }
+
+    /**
+     * Days since 1970-01-01 of a YYYYMMDD date, independent of the time zone.
+     */
+    static int32_t dayNumber(uint32_t date)
+    {
+        int32_t y = date / 10000;
+        int32_t m = (date / 100) % 100;
+        int32_t d = date % 100;
+        y -= m <= 2;
+        int32_t era = (y >= 0 ? y : y - 399) / 400;
+        int32_t yoe = y - era * 400;
+        int32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        int32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+private:
+    typedef struct
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t slots;
+        uint32_t recordSize;
+        uint32_t reserved;
+    } Header_t;
+
+    typedef struct
+    {
+        uint32_t date;  // YYYYMMDD, 0 = empty
+        uint8_t zone;   // ElectricityPriceProvider_t
+        uint8_t reserved[3];
+        float scale;    // EUR/MWh per unit
+        int16_t quarters[QUARTERS_OF_DAY];
+    } Record_t;
+
+    static_assert(sizeof(Header_t) + PRICE_ARCHIVE_SLOTS_PER_FILE * sizeof(Record_t) <= PRICE_ARCHIVE_BLOCK_SIZE,
+                  "an archive file has to fit one LittleFS block");
+    static_assert(PRICE_ARCHIVE_SLOTS % PRICE_ARCHIVE_SLOTS_PER_FILE == 0, "slots must fill whole files");
+
+    static const size_t FILE_SIZE = sizeof(Header_t) + PRICE_ARCHIVE_SLOTS_PER_FILE * sizeof(Record_t);
+
+    volatile bool ready = false; // set once by begin()
+
+    PriceArchive() {}
+
+    static int32_t slotOf(uint32_t date)
+    {
+        int32_t slot = dayNumber(date) % PRICE_ARCHIVE_SLOTS;
+        return slot < 0 ? slot + PRICE_ARCHIVE_SLOTS : slot;
+    }
+
+    static void pathOf(int32_t slot, char *path, size_t length)
+    {
+        snprintf(path, length, PRICE_ARCHIVE_DIR "/%02d.bin", (int)(slot / PRICE_ARCHIVE_SLOTS_PER_FILE));
+    }
+
+    static size_t offsetOf(int32_t slot)
+    {
+        return sizeof(Header_t) + (size_t)(slot % PRICE_ARCHIVE_SLOTS_PER_FILE) * sizeof(Record_t);
+    }
+
+    static Header_t expectedHeader()
+    {
+        Header_t header;
+        memset(&header, 0, sizeof(header));
+        header.magic = PRICE_ARCHIVE_MAGIC;
+        header.version = PRICE_ARCHIVE_VERSION;
+        header.slots = PRICE_ARCHIVE_SLOTS_PER_FILE;
+        header.recordSize = sizeof(Record_t);
+        return header;
+    }
+
+    /**
+     * Caller holds FlashGuard.
+     */
+    static bool hasValidHeader(File &file)
+    {
+        if (!file || file.size() != FILE_SIZE || !file.seek(0))
+        {
+            return false;
+        }
+        Header_t expected = expectedHeader();
+        Header_t header;
+        return file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+               memcmp(&header, &expected, sizeof(header)) == 0;
+    }
+
+    /**
+     * (Re)create a file with the header and empty records, left open for
+     * writing. Caller holds FlashGuard.
+     */
+    static File create(const char *path)
+    {
+        Header_t header = expectedHeader();
+        uint8_t zeros[256] = {};
+        File file = LittleFS.open(path, "w+");
+        bool ok = file && file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+        for (size_t written = sizeof(header); ok && written < FILE_SIZE; written += sizeof(zeros))
+        {
+            size_t length = min(sizeof(zeros), FILE_SIZE - written);
+            ok = file.write(zeros, length) == length;
+        }
+        if (!ok && file)
+        {
+            file.close();
+            return File();
+        }
+        return file;
+    }
+};
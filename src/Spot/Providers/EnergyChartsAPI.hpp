@@ -4,10 +4,380 @@
 #include <RemoteLogger.hpp>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
-#include <ArduinoJson.h>
 #include <math.h>
 #include <time.h>
 #include "../ElectricityPriceResult.hpp"
+#include "../../utils/Tracer.hpp"
+
+#define ENERGY_CHARTS_MAX_VALUES 256  // two days of quarters with DST, far more than one requested day
+#define ENERGY_CHARTS_READ_CHUNK 256
+
+/**
+ * Streaming parser of the Energy Charts /price response.
+ *
+ * Reads the body straight from the stream in small chunks, remembers only
+ * the local quarter of every unix_seconds entry and the price values
+ * (bounded by ENERGY_CHARTS_MAX_VALUES), and skips everything else. Values
+ * are then placed by timestamp, not by position:
+ *  - 92/100 quarter DST days map to the local hh:mm quarters the rest of the
+ *    app uses (the repeated hour overwrites, the skipped one is filled from
+ *    the previous quarter)
+ *  - hourly zones fill all four quarters of the hour
+ *  - entries of other days are ignored
+ */
+class EnergyChartsStreamParser
+{
+public:
+    /**
+     * @param year, yday local date whose quarters are wanted
+     */
+    EnergyChartsStreamParser(int year, int yday) : year(year), yday(yday) {}
+
+    /**
+     * Parse the body and write raw prices (EUR/MWh) into outPrices[QUARTERS_OF_DAY].
+     * Quarters without a value are filled from their neighbours for display,
+     * isComplete() tells whether there were any.
+     * @return number of quarters that received a value
+     */
+    int parse(Stream &stream, ElectricityPriceItem_t *outPrices)
+    {
+        this->stream = &stream;
+        if (!parseObject())
+        {
+            LOGD("EnergyChartsAPI: Malformed response");
+            return 0;
+        }
+        return place(outPrices);
+    }
+
+    /**
+     * True when every quarter existing on the day (92/96 on DST days) came from the response.
+     */
+    bool isComplete() const
+    {
+        return complete;
+    }
+
+    /**
+     * Mark the local quarters that exist on the day - all 96 except the hour skipped at DST start.
+     * @return number of them
+     */
+    static int existingQuarters(int year, int yday, bool *exists)
+    {
+        memset(exists, 0, QUARTERS_OF_DAY * sizeof(bool));
+        struct tm t = {};
+        t.tm_year = year - 1900;
+        t.tm_mday = yday + 1; // normalized by mktime
+        t.tm_isdst = -1;
+        time_t timestamp = mktime(&t);
+        int count = 0;
+        for (int step = 0; step < QUARTERS_OF_DAY + 4; step++, timestamp += 900)
+        {
+            struct tm local;
+            localtime_r(&timestamp, &local);
+            if (local.tm_year + 1900 != year || local.tm_yday != yday)
+            {
+                break;
+            }
+            int q = (local.tm_hour * 60 + local.tm_min) / 15;
+            if (!exists[q])
+            {
+                exists[q] = true;
+                count++;
+            }
+        }
+        return count;
+    }
+
+private:
+    Stream *stream = nullptr;
+    char buffer[ENERGY_CHARTS_READ_CHUNK];
+    size_t bufferLength = 0;
+    size_t bufferPos = 0;
+    int year;
+    int yday;
+    bool complete = false;
+
+    int16_t slots[ENERGY_CHARTS_MAX_VALUES];  // local quarter of the day, -1 = other day
+    uint8_t spans[ENERGY_CHARTS_MAX_VALUES];  // quarters covered (4 for hourly data)
+    float values[ENERGY_CHARTS_MAX_VALUES];   // NAN for null
+    int slotCount = 0;
+    int valueCount = 0;
+    time_t lastTimestamp = 0;
+
+    int next()
+    {
+        if (bufferPos >= bufferLength)
+        {
+            bufferLength = stream->readBytes(buffer, sizeof(buffer));
+            bufferPos = 0;
+            if (bufferLength == 0)
+            {
+                return -1;
+            }
+        }
+        return (uint8_t)buffer[bufferPos++];
+    }
+
+    int peek()
+    {
+        int c = next();
+        if (c >= 0)
+        {
+            bufferPos--;
+        }
+        return c;
+    }
+
+    int nextToken()
+    {
+        int c;
+        do
+        {
+            c = next();
+        } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+        return c;
+    }
+
+    bool parseObject()
+    {
+        if (nextToken() != '{')
+        {
+            return false;
+        }
+        char key[24];
+        for (;;)
+        {
+            int c = nextToken();
+            if (c == '}')
+            {
+                return true;
+            }
+            if (c == ',')
+            {
+                continue;
+            }
+            if (c != '"' || !readString(key, sizeof(key)) || nextToken() != ':')
+            {
+                return false;
+            }
+            bool ok;
+            if (strcmp(key, "unix_seconds") == 0)
+            {
+                ok = parseNumberArray(true);
+            }
+            else if (strcmp(key, "price") == 0)
+            {
+                ok = parseNumberArray(false);
+            }
+            else
+            {
+                ok = skipValue();
+            }
+            if (!ok)
+            {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * Read a string after the opening quote, truncated to size - 1.
+     */
+    bool readString(char *out, size_t size)
+    {
+        size_t length = 0;
+        for (;;)
+        {
+            int c = next();
+            if (c < 0)
+            {
+                return false;
+            }
+            if (c == '"')
+            {
+                break;
+            }
+            if (c == '\\')
+            {
+                c = next();
+            }
+            if (out != nullptr && length + 1 < size)
+            {
+                out[length++] = (char)c;
+            }
+        }
+        if (out != nullptr)
+        {
+            out[length] = '\0';
+        }
+        return true;
+    }
+
+    bool skipValue()
+    {
+        int c = nextToken();
+        if (c == '"')
+        {
+            return readString(nullptr, 0);
+        }
+        if (c == '{' || c == '[')
+        {
+            int depth = 1;
+            while (depth > 0)
+            {
+                c = next();
+                if (c < 0)
+                {
+                    return false;
+                }
+                if (c == '"' && !readString(nullptr, 0))
+                {
+                    return false;
+                }
+                if (c == '{' || c == '[')
+                {
+                    depth++;
+                }
+                else if (c == '}' || c == ']')
+                {
+                    depth--;
+                }
+            }
+            return true;
+        }
+        // number, true, false, null
+        while ((c = peek()) >= 0 && c != ',' && c != '}' && c != ']')
+        {
+            next();
+        }
+        return c >= 0;
+    }
+
+    bool parseNumberArray(bool timestamps)
+    {
+        if (nextToken() != '[')
+        {
+            // e.g. "price": null
+            return skipValue();
+        }
+        char number[24];
+        for (;;)
+        {
+            int c = nextToken();
+            if (c == ']')
+            {
+                return true;
+            }
+            if (c == ',')
+            {
+                continue;
+            }
+            if (c < 0)
+            {
+                return false;
+            }
+            size_t length = 0;
+            number[length++] = (char)c;
+            while ((c = peek()) >= 0 && c != ',' && c != ']' && c != ' ' && c != '\n' && c != '\r' && c != '\t')
+            {
+                next();
+                if (length + 1 < sizeof(number))
+                {
+                    number[length++] = (char)c;
+                }
+            }
+            number[length] = '\0';
+            if (timestamps)
+            {
+                addTimestamp(strtoll(number, nullptr, 10));
+            }
+            else if (valueCount < ENERGY_CHARTS_MAX_VALUES)
+            {
+                values[valueCount++] = number[0] == 'n' ? NAN : strtof(number, nullptr);
+            }
+        }
+    }
+
+    void addTimestamp(time_t timestamp)
+    {
+        if (slotCount > 0 && timestamp > lastTimestamp)
+        {
+            spans[slotCount - 1] = constrain((timestamp - lastTimestamp) / 900, 1, 4);
+        }
+        lastTimestamp = timestamp;
+        if (slotCount >= ENERGY_CHARTS_MAX_VALUES)
+        {
+            return;
+        }
+        struct tm t;
+        localtime_r(&timestamp, &t);
+        bool sameDay = t.tm_year + 1900 == year && t.tm_yday == yday;
+        slots[slotCount] = sameDay ? (t.tm_hour * 60 + t.tm_min) / 15 : -1;
+        spans[slotCount] = slotCount > 0 ? spans[slotCount - 1] : 1;
+        slotCount++;
+    }
+
+    int place(ElectricityPriceItem_t *outPrices)
+    {
+        bool filled[QUARTERS_OF_DAY] = {false};
+        int count = min(slotCount, valueCount);
+        for (int i = 0; i < count; i++)
+        {
+            if (slots[i] < 0 || isnan(values[i]))
+            {
+                continue;
+            }
+            for (int q = slots[i]; q < slots[i] + spans[i] && q < QUARTERS_OF_DAY; q++)
+            {
+                outPrices[q].electricityPrice = values[i];
+                filled[q] = true;
+            }
+        }
+
+        int filledCount = 0;
+        int first = -1;
+        for (int q = 0; q < QUARTERS_OF_DAY; q++)
+        {
+            if (filled[q])
+            {
+                filledCount++;
+                if (first < 0)
+                {
+                    first = q;
+                }
+            }
+            else if (first >= 0)
+            {
+                outPrices[q].electricityPrice = outPrices[q - 1].electricityPrice; // skipped DST hour, missing value
+            }
+        }
+        for (int q = 0; q < first; q++)
+        {
+            outPrices[q].electricityPrice = outPrices[first].electricityPrice;
+        }
+        if (count != slotCount || count != valueCount)
+        {
+            LOGW("EnergyChartsAPI: %d timestamps but %d prices", slotCount, valueCount);
+        }
+
+        bool exists[QUARTERS_OF_DAY];
+        int expected = existingQuarters(year, yday, exists);
+        complete = filledCount > 0;
+        for (int q = 0; q < QUARTERS_OF_DAY; q++)
+        {
+            if (exists[q] && !filled[q])
+            {
+                complete = false;
+            }
+        }
+        if (!complete && filledCount > 0)
+        {
+            LOGD("EnergyChartsAPI: %d of %d quarters in the response, rest filled from neighbours", filledCount, expected);
+        }
+        return filledCount;
+    }
+};
 
 /**
  * Energy Charts API Provider
@@ -28,11 +398,13 @@ public:
      * @param biddingZone Kód bidding zone (např. "CZ", "DE-LU", "AT")
      * @param tomorrow True pro zítřejší ceny, false pro dnešní
      * @param outResult Reference na strukturu pro uložení výsledku
-     * @return true pokud se podařilo načíst data
+     * @param outComplete true when every quarter of the day came from the response (not filled)
+     * @return number of quarters that received a price, 0 on failure
      */
-    bool reloadData(const char* biddingZone, bool tomorrow, ElectricityPriceResult_t& outResult)
+    int reloadData(const char* biddingZone, bool tomorrow, ElectricityPriceResult_t& outResult, bool& outComplete)
     {
         outResult.updated = 0;
+        outComplete = false;
         memset(outResult.prices, 0, sizeof(outResult.prices));
         
         // Alokujeme vše na heapu pro minimalizaci stack usage
@@ -43,7 +415,7 @@ public:
             LOGD("EnergyChartsAPI: Failed to allocate client/https");
             if (client) delete client;
             if (https) delete https;
-            return false;
+            return 0;
         }
         
         client->setInsecure();
@@ -65,11 +437,15 @@ public:
         
         LOGD("EnergyChartsAPI: Fetching URL: %s", url);
         
-        bool success = false;
+        int quarters = 0;
         
         if (https->begin(*client, url))
         {
-            int httpCode = https->GET();
+            int httpCode;
+            {
+                TRACE_SCOPE("prices.http_get");
+                httpCode = https->GET();
+            }
             
             if (httpCode == HTTP_CODE_OK)
             {
@@ -77,52 +453,31 @@ public:
                 int contentLength = https->getSize();
                 LOGD("EnergyChartsAPI: Response length: %d", contentLength);
                 
-                // Alokujeme JSON document na heapu
-                DynamicJsonDocument* doc = new DynamicJsonDocument(4096);
-                if (doc) {
-                    StaticJsonDocument<128> filter;
-                    filter["unix_seconds"] = true;
-                    filter["price"] = true;
-                    
-                    DeserializationError error = deserializeJson(*doc, *stream, DeserializationOption::Filter(filter));
+                // Parser drží jen buffery pevné velikosti, alokujeme na heapu kvůli stacku
+                EnergyChartsStreamParser* parser = new EnergyChartsStreamParser(t->tm_year + 1900, t->tm_yday);
+                if (parser) {
+                    {
+                        TRACE_SCOPE("prices.parse_json");
+                        quarters = parser->parse(*stream, outResult.prices);
+                    }
                     
-                    if (!error)
+                    if (quarters > 0)
                     {
-                        JsonArray prices = (*doc)["price"];
-                        
-                        if (prices.size() > 0)
-                        {
-                            int priceCount = prices.size();
-                            LOGD("EnergyChartsAPI: Got %d quarter-hourly prices", priceCount);
-                            
-                            for (int i = 0; i < QUARTERS_OF_DAY && i < priceCount; i++)
-                            {
-                                JsonVariant priceValue = prices[i];
-                                if (!priceValue.isNull()) {
-                                    // Uložíme surové EUR/MWh, konverze se dělá v ElectricityPriceLoader
-                                    outResult.prices[i].electricityPrice = priceValue.as<float>();
-                                }
-                            }
-                            
-                            outResult.updated = time(NULL);
-                            success = true;
-                            LOGD("EnergyChartsAPI: Successfully loaded prices for %s", biddingZone);
-                        }
-                        else
-                        {
-                            LOGD("EnergyChartsAPI: No price data available");
-                        }
+                        LOGD("EnergyChartsAPI: Got prices for %d quarters", quarters);
+                        outResult.updated = time(NULL);
+                        outComplete = parser->isComplete();
+                        LOGD("EnergyChartsAPI: Successfully loaded prices for %s", biddingZone);
                     }
                     else
                     {
-                        LOGD("EnergyChartsAPI: JSON parse error: %s", error.c_str());
+                        LOGD("EnergyChartsAPI: No price data available");
                     }
                     
-                    delete doc;
+                    delete parser;
                 }
                 else
                 {
-                    LOGD("EnergyChartsAPI: Failed to allocate JSON document");
+                    LOGD("EnergyChartsAPI: Failed to allocate parser");
                 }
             }
             else
@@ -144,6 +499,6 @@ public:
         
         yield(); // Dáme šanci RTOS
         
-        return success;
+        return quarters;
     }
 };
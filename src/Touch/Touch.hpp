@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include "TAMC_GT911.h"
 #include <Wire.h>
+#include "../consts.h"
 
 
 #define TOUCH_GT911
@@ -14,7 +15,11 @@
 #define TOUCH_GT911_SDA GPIO_NUM_15
 #endif
 
+#if DISPLAY_ROTATION == 0
+#define TOUCH_GT911_ROTATION ROTATION_NORMAL
+#else
 #define TOUCH_GT911_ROTATION ROTATION_INVERTED
+#endif
 #define TOUCH_MAP_X1 800
 #define TOUCH_MAP_X2 0
 #define TOUCH_MAP_Y1 480
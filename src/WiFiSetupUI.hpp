@@ -421,6 +421,11 @@ public:
     {
     }
 
+    const char* name() const override
+    {
+        return "wifi_setup";
+    }
+
     void show() override
     {
         // Clean up previous state
@@ -33,6 +33,17 @@
 #include "utils/IntelligenceHelpers.hpp"
 #include "utils/WebServer.hpp"
 #include "utils/FlashMutex.hpp"
+#include "utils/LiveStream.hpp"
+#include "utils/Metrics.hpp"
+#include "utils/Tracer.hpp"
+#include "utils/FrameProfiler.hpp"
+#include "utils/LvglPacer.hpp"
+#include "utils/LvglAllocator.h"
+#include "utils/UiBenchmark.hpp"
+#include "utils/LoadScheduler.hpp"
+#include "utils/SimulationGate.hpp"
+#include "utils/IntelligenceWorker.hpp"
+#include "utils/DayRecorder.hpp"
 #include <RemoteLogger.hpp>
 #include <LogCache.hpp>
 #include <LittleFS.h>
@@ -80,6 +91,8 @@ RTC_DATA_ATTR RemoteLoggerState remoteLoggerState = {LEVEL_NONE, false, 0, {0}};
 
 InverterData_t inverterData;
 InverterData_t previousInverterData;
+InverterData_t benchmarkData;         // scripted UiBenchmark scenario, replaces inverterData on the dashboard while running
+InverterData_t previousBenchmarkData;
 WallboxResult_t wallboxData;
 WallboxResult_t previousWallboxData;
 ShellyResult_t shellyResult;
@@ -109,7 +122,10 @@ SmartControlRuleResolver wallboxRuleResolver(wallboxMedianPowerSampler);
 // Intelligence components
 ConsumptionPredictor consumptionPredictor;
 ProductionPredictor productionPredictor;
+// Held by the intelligence worker for a whole simulation, the main loop only try-takes it
+SemaphoreHandle_t predictor_mutex = xSemaphoreCreateMutex();
 IntelligenceResolver intelligenceResolver(consumptionPredictor, productionPredictor);
+IntelligenceWorker intelligenceWorker(intelligenceResolver, predictor_mutex);
 
 // Local result structure for backward compatibility with SolarInverterMode_t
 struct LocalIntelligenceResult {
@@ -122,7 +138,16 @@ LocalIntelligenceResult lastIntelligenceResult;
 static SolarInverterMode_t lastSentMode = SI_MODE_UNKNOWN; // Last mode sent to inverter
 static long lastIntelligenceAttempt = 0;
 static int lastProcessedQuarter = -1;        // Track last quarter when we processed intelligence
-#define INTELLIGENCE_REFRESH_INTERVAL 300000 // 5 minutes - recalculate every 5 minutes
+#define INTELLIGENCE_REFRESH_INTERVAL 60000  // check every minute, SimulationGate skips unchanged inputs
+static SimulationGate simulationGate;
+static uint32_t predictorGeneration = 0;     // bumped when predictors finished learning a quarter
+#define PREDICTOR_CHECKPOINT_QUARTERS 4      // save one of the predictors every hour
+static int quartersSinceCheckpoint = 0;
+static bool checkpointConsumptionNext = true;
+static bool checkpointDue = false;
+static bool midnightSaveDue = false;
+static long lastLoadSchedulerAttempt = 0;
+#define LOAD_SCHEDULER_REFRESH_INTERVAL 60000
 
 // Pending mode change from UI - processed in mainUpdateTask to avoid blocking LVGL
 static volatile SolarInverterMode_t pendingModeChange = SI_MODE_UNKNOWN;
@@ -152,11 +177,130 @@ bool showIntelligenceSettings = false;
 /* Display flushing */
 static lv_disp_drv_t *flush_disp_drv = nullptr;
 
+#if CROW_PANEL_ADVANCE && LVGL_DIRECT_MODE
+#if DISPLAY_ROTATION != 0
+#error "LVGL_DIRECT_MODE needs DISPLAY_ROTATION 0 - LVGL can't rotate while rendering into the panel framebuffer"
+#endif
+#include <esp_cache.h>
+
+// A keyframe (full screen invalidation) must fit the record ring, or the viewer never catches up
+static_assert(LIVE_STREAM_RECORDS_PER_SCREEN(screenWidth, screenHeight) <= LIVE_STREAM_MAX_RECORDS,
+              "LiveStream ring can't hold a full screen keyframe");
+
+static bool lvglDirectMode = false;
+static SemaphoreHandle_t frameSwapSemaphore = nullptr;
+static lv_coord_t lastDirtyY1 = screenHeight;
+static lv_coord_t lastDirtyY2 = -1;
+
+static void IRAM_ATTR onFrameSwapped(void *arg)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xSemaphoreGiveFromISR(frameSwapSemaphore, &xHigherPriorityTaskWoken);
+    if (xHigherPriorityTaskWoken)
+    {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * Use both panel framebuffers as LVGL draw buffers. The one LVGL starts with
+ * must be the one not scanned yet.
+ */
+bool setupDirectMode()
+{
+    lv_color_t *front = (lv_color_t *)tft._bus_instance.getFrameBuffer(0);
+    lv_color_t *back = (lv_color_t *)tft._bus_instance.getFrameBuffer(1);
+    if (front == nullptr || back == nullptr)
+    {
+        LOGE("Second panel framebuffer not available, direct mode disabled");
+        return false;
+    }
+    frameSwapSemaphore = xSemaphoreCreateBinary();
+    if (frameSwapSemaphore == nullptr)
+    {
+        return false;
+    }
+    tft._bus_instance.setFrameSwapCallback(onFrameSwapped);
+    lv_disp_draw_buf_init(&draw_buf, back, front, screenWidth * screenHeight);
+    LOGD("Display direct mode: 2x %.1f KB panel framebuffers", screenWidth * screenHeight * sizeof(lv_color_t) / 1024.0f);
+    return true;
+}
+
+/**
+ * Direct mode flush. LVGL already rendered into color_p, which is one of the
+ * panel framebuffers, and calls this with the full screen area for every
+ * dirty area. Only the last call matters. It writes the rendered rows back
+ * from the cache and shows the buffer from the next VSYNC. Before the next
+ * frame, LVGL copies the dirty areas into the other buffer itself
+ * (sync areas).
+ */
+void flushDirectMode(lv_disp_drv_t *disp, lv_color_t *color_p)
+{
+    FrameProfiler::instance().onFlush();
+    if (!lv_disp_flush_is_last(disp))
+    {
+        lv_disp_flush_ready(disp);
+        return;
+    }
+
+    lv_disp_t *refreshing = _lv_refr_get_disp_refreshing();
+    bool streaming = LiveStream::instance().isActive();
+    lv_coord_t dirtyY1 = screenHeight;
+    lv_coord_t dirtyY2 = -1;
+    for (uint16_t i = 0; i < refreshing->inv_p; i++)
+    {
+        if (refreshing->inv_area_joined[i])
+        {
+            continue;
+        }
+        const lv_area_t &area = refreshing->inv_areas[i];
+        dirtyY1 = min(dirtyY1, area.y1);
+        dirtyY2 = max(dirtyY2, area.y2);
+        if (streaming)
+        {
+            LiveStream::instance().captureArea(&area, color_p + area.y1 * screenWidth + area.x1, screenWidth);
+        }
+    }
+
+    // GDMA reads PSRAM directly - write back this frame's areas and the previous
+    // frame's areas LVGL copied into this buffer before rendering
+    lv_coord_t syncY1 = min(dirtyY1, lastDirtyY1);
+    lv_coord_t syncY2 = max(dirtyY2, lastDirtyY2);
+    if (syncY2 >= syncY1)
+    {
+        esp_cache_msync(color_p + syncY1 * screenWidth, (syncY2 - syncY1 + 1) * screenWidth * sizeof(lv_color_t),
+                        ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    }
+    lastDirtyY1 = dirtyY1;
+    lastDirtyY2 = dirtyY2;
+
+    // The other buffer is scanned until the swap, LVGL renders into it next
+    xSemaphoreTake(frameSwapSemaphore, 0);
+    if (tft._bus_instance.setFrameBuffer(color_p) && xSemaphoreTake(frameSwapSemaphore, pdMS_TO_TICKS(50)) != pdTRUE)
+    {
+        LOGW("Framebuffer swap timeout");
+    }
+    lv_disp_flush_ready(disp);
+}
+#endif
+
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
 {
+    TRACE_SCOPE("lvgl.flush");
+#if CROW_PANEL_ADVANCE && LVGL_DIRECT_MODE
+    if (lvglDirectMode)
+    {
+        flushDirectMode(disp, color_p);
+        return;
+    }
+#endif
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
 
+    // Remote screen mirroring - no-op unless a /live viewer is connected
+    LiveStream::instance().capture(area, color_p);
+    FrameProfiler::instance().onFlush();
+
     // For double buffering with DMA: wait for previous transfer, then start new one
     // and signal ready immediately (LVGL can draw into other buffer)
     if (disp->draw_buf->buf1 && disp->draw_buf->buf2) {
@@ -186,6 +330,7 @@ void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
         data->point.y = touch.touchY;
 
         backlightResolver.touch();
+        LvglPacer::instance().onInput();
     }
 }
 
@@ -247,6 +392,8 @@ void lvglTimerTask(void *param)
 {
     // Subscribe this task to watchdog
     esp_task_wdt_add(NULL);
+    LvglPacer &pacer = LvglPacer::instance();
+    pacer.attach(xTaskGetCurrentTaskHandle());
 
     static uint32_t lastLvglLog = 0;
     static uint32_t lvglCallCount = 0;
@@ -254,8 +401,36 @@ void lvglTimerTask(void *param)
     static uint32_t totalLvglTime = 0;
     static uint32_t maxMutexWait = 0;
 
+    MetricHistogram *frameTimeHistogram = Metrics::instance().histogram("lvgl_timer_handler_us", "Duration of lv_timer_handler()", METRICS_BUCKETS_US, METRICS_BUCKETS_LEN(METRICS_BUCKETS_US));
+    MetricHistogram *mutexWaitHistogram = Metrics::instance().histogram("lvgl_mutex_wait_us", "Time LVGL task waited for lvgl_mutex", METRICS_BUCKETS_US, METRICS_BUCKETS_LEN(METRICS_BUCKETS_US));
+    MetricCounter *mutexTimeouts = Metrics::instance().counter("lvgl_mutex_timeouts_total", "LVGL task iterations skipped due to mutex timeout");
+    MetricGauge *framePeriodGauge = Metrics::instance().gauge("lvgl_frame_period_ms", "Last sleep period of LVGL task");
+    MetricCounter *displayOffPolls = Metrics::instance().counter("lvgl_display_off_polls_total", "LVGL task iterations skipped while display is off");
+    MetricGauge *memInternalUsed = Metrics::instance().gauge("lvgl_mem_internal_used_bytes", "LVGL allocations in the internal RAM pool");
+    MetricGauge *memInternalPeak = Metrics::instance().gauge("lvgl_mem_internal_peak_bytes", "Peak usage of the LVGL internal RAM pool");
+    MetricGauge *memInternalFragmentation = Metrics::instance().gauge("lvgl_mem_internal_fragmentation_ratio", "1 - largest free block / free bytes of the LVGL pool");
+    MetricGauge *memPsramUsed = Metrics::instance().gauge("lvgl_mem_psram_used_bytes", "LVGL allocations in PSRAM");
+    MetricGauge *memPsramPeak = Metrics::instance().gauge("lvgl_mem_psram_peak_bytes", "Peak LVGL allocations in PSRAM");
+    MetricCounter *memFallbacks = Metrics::instance().counter("lvgl_mem_pool_fallbacks_total", "Small LVGL allocations that did not fit into the internal pool");
+    uint32_t reportedFallbacks = 0;
+
     for (;;)
     {
+        // Display is off - don't render at all, only watch the touch panel to wake it up.
+        // A connected /live viewer still needs frames.
+        if (backlightResolver.isDisplayOff() && !LiveStream::instance().isActive())
+        {
+            esp_task_wdt_reset();
+            displayOffPolls->inc();
+            pacer.sleep(LVGL_PACER_DISPLAY_OFF_POLL_MS);
+            if (touch.hasTouch())
+            {
+                backlightResolver.touch();
+                pacer.onInput();
+            }
+            continue;
+        }
+
         uint32_t mutexWaitStart = micros();
 
         // Try to take mutex with timeout - if it takes too long, something is blocking
@@ -263,6 +438,7 @@ void lvglTimerTask(void *param)
         {
             // Mutex blocked - reset watchdog anyway to prevent timeout
             esp_task_wdt_reset();
+            mutexTimeouts->inc();
             static uint32_t lastMutexWarning = 0;
             if (millis() - lastMutexWarning > 5000)
             {
@@ -278,10 +454,17 @@ void lvglTimerTask(void *param)
             maxMutexWait = mutexWait;
 
         uint32_t startTime = micros();
-        lv_timer_handler();
+        uint32_t timeToNextTimer;
+        {
+            TRACE_SCOPE("lvgl.timer_handler");
+            timeToNextTimer = lv_timer_handler();
+        }
         uint32_t elapsed = micros() - startTime;
+        uint32_t period = pacer.nextPeriod(timeToNextTimer);
 
         xSemaphoreGive(lvgl_mutex);
+        frameTimeHistogram->observe(elapsed);
+        mutexWaitHistogram->observe(mutexWait);
         totalLvglTime += elapsed;
         if (elapsed > maxLvglTime)
             maxLvglTime = elapsed;
@@ -290,6 +473,17 @@ void lvglTimerTask(void *param)
         // Reset stats every 5 seconds
         if (millis() - lastLvglLog > 5000)
         {
+            lvgl_alloc_stats_t memStats;
+            lvgl_alloc_get_stats(&memStats);
+            uint32_t poolFree = memStats.internalSize - memStats.internalUsed;
+            memInternalUsed->set(memStats.internalUsed);
+            memInternalPeak->set(memStats.internalPeak);
+            memInternalFragmentation->set(poolFree > 0 ? 1.0f - (float)memStats.internalLargestFree / poolFree : 0.0f);
+            memPsramUsed->set(memStats.psramUsed);
+            memPsramPeak->set(memStats.psramPeak);
+            memFallbacks->inc(memStats.fallbacks - reportedFallbacks);
+            reportedFallbacks = memStats.fallbacks;
+
             lvglCallCount = 0;
             totalLvglTime = 0;
             maxLvglTime = 0;
@@ -299,7 +493,8 @@ void lvglTimerTask(void *param)
 
         // Reset watchdog to prevent timeout during long renders
         esp_task_wdt_reset();
-        vTaskDelay(pdMS_TO_TICKS(15)); // Match LV_DISP_DEF_REFR_PERIOD (15ms = ~66 FPS)
+        framePeriodGauge->set(period);
+        pacer.sleep(period);
     }
 }
 
@@ -340,7 +535,7 @@ void setupLVGL()
     tft.begin();
     LOGI("[MEM LVGL:tft.begin] Internal: %luKB", (unsigned long)heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024);
     tft.fillScreen(TFT_BLACK);
-    tft.setRotation(2);
+    tft.setRotation(DISPLAY_ROTATION);
     delay(200);
     LOGI("[MEM LVGL:tft] Internal: %luKB", (unsigned long)heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024);
     
@@ -370,18 +565,24 @@ void setupLVGL()
     // Larger buffers = fewer flush operations = smoother scrolling
     // Using 1/4 of screen height (120 lines) for good balance
 #if CROW_PANEL_ADVANCE
-    // CrowPanel Advance has RGB panel with PSRAM - use large PSRAM buffers
-    size_t bufferLines = screenHeight / 4; // 120 lines = ~192KB per buffer
-    size_t bufferSize = screenWidth * bufferLines * sizeof(lv_color_t);
-    
-    disp_draw_buf1 = (lv_color_t *)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM);
-    disp_draw_buf2 = (lv_color_t *)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM);
-    
-    if (!disp_draw_buf1 || !disp_draw_buf2) {
-        LOGE("Failed to allocate display buffers in PSRAM!");
+#if LVGL_DIRECT_MODE
+    lvglDirectMode = setupDirectMode();
+    if (!lvglDirectMode)
+#endif
+    {
+        // CrowPanel Advance has RGB panel with PSRAM - use large PSRAM buffers
+        size_t bufferLines = screenHeight / 4; // 120 lines = ~192KB per buffer
+        size_t bufferSize = screenWidth * bufferLines * sizeof(lv_color_t);
+
+        disp_draw_buf1 = (lv_color_t *)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM);
+        disp_draw_buf2 = (lv_color_t *)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM);
+
+        if (!disp_draw_buf1 || !disp_draw_buf2) {
+            LOGE("Failed to allocate display buffers in PSRAM!");
+        }
+        lv_disp_draw_buf_init(&draw_buf, disp_draw_buf1, disp_draw_buf2, screenWidth * bufferLines);
+        LOGD("Display buffers in PSRAM: 2x %.1f KB (%d lines)", bufferSize / 1024.0f, bufferLines);
     }
-    lv_disp_draw_buf_init(&draw_buf, disp_draw_buf1, disp_draw_buf2, screenWidth * bufferLines);
-    LOGD("Display buffers in PSRAM: 2x %.1f KB (%d lines)", bufferSize / 1024.0f, bufferLines);
 #else
     // Standard CrowPanel - try internal DMA RAM first for better performance
     size_t bufferLines = 48; // Number of lines per buffer
@@ -420,6 +621,12 @@ void setupLVGL()
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
     disp_drv.full_refresh = 0; // Only redraw dirty areas for better FPS
+#if CROW_PANEL_ADVANCE && LVGL_DIRECT_MODE
+    disp_drv.direct_mode = lvglDirectMode;
+#endif
+    // Profiler hooks - no-op until enabled via /profile
+    disp_drv.rounder_cb = FrameProfiler::rounderCb;
+    disp_drv.monitor_cb = FrameProfiler::monitorCb;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
 
@@ -447,11 +654,7 @@ void setupLVGL()
     dashboardUI = (DashboardUI*)heap_caps_malloc(sizeof(DashboardUI), MALLOC_CAP_SPIRAM);
     new (dashboardUI) DashboardUI(onSettingsShow, onIntelligenceShow);
     
-    wifiSetupUI = (WiFiSetupUI*)heap_caps_malloc(sizeof(WiFiSetupUI), MALLOC_CAP_SPIRAM);
-    new (wifiSetupUI) WiFiSetupUI(dongleDiscovery);
-    
-    intelligenceSetupUI = (IntelligenceSetupUI*)heap_caps_malloc(sizeof(IntelligenceSetupUI), MALLOC_CAP_SPIRAM);
-    new (intelligenceSetupUI) IntelligenceSetupUI();
+    // WiFiSetupUI and IntelligenceSetupUI are rarely visited, see ensureSetupScreens()
     
     LOGI("[MEM LVGL:UI allocated] Internal: %luKB", (unsigned long)heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024);
 
@@ -499,6 +702,7 @@ void logMemoryStatus(const char* label)
          (unsigned long)heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024,
          (unsigned long)heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024,
          (unsigned long)ESP.getMinFreeHeap() / 1024);
+    Metrics::instance().updateSystemGauges();
 }
 
 void setup()
@@ -520,6 +724,10 @@ void setup()
     
     logMemoryStatus("BOOT");
 
+#if TRACING
+    Tracer::instance().begin();
+#endif
+
     // Initialize localization system (load language from NVS)
     Localization::init();
     logMemoryStatus("LOCALE");
@@ -543,6 +751,9 @@ void setup()
     }
     logMemoryStatus("PRICE_ALLOC");
 
+    // Intelligence simulation runs on its own task on core 0
+    intelligenceWorker.begin();
+
     setupLVGL();
     logMemoryStatus("LVGL");
     
@@ -592,6 +803,7 @@ bool discoverDonglesTask()
     {
         run = true;
         lastWiFiScanAttempt = millis();
+        TRACE_SCOPE("task.wifi_scan");
         dongleDiscovery.scanWiFi(true);
         // SoftAP is started only when entering STATE_DASHBOARD
     }
@@ -601,6 +813,34 @@ bool discoverDonglesTask()
 // Single shared instance for read and write operations
 static GoodweDongleAPI goodweDongleAPI;
 
+/**
+ * Record poll latency, request count and failures per vendor into /metrics.
+ * Metric label strings must be static, so each vendor has its own entry.
+ */
+void recordInverterPollMetrics(ConnectionType_t type, bool ok, uint32_t durationMs, uint32_t requests)
+{
+    static const char *VENDOR_LABELS[] = {
+        "vendor=\"none\"", "vendor=\"solax\"", "vendor=\"goodwe\"", "vendor=\"sofar\"",
+        "vendor=\"victron\"", "vendor=\"deye\"", "vendor=\"growatt\""};
+    static MetricHistogram *latency[7] = {nullptr};
+    static MetricHistogram *requestsPerPoll[7] = {nullptr};
+    static MetricCounter *failures[7] = {nullptr};
+
+    int index = (type >= 0 && type < 7) ? (int)type : 0;
+    if (latency[index] == nullptr)
+    {
+        latency[index] = Metrics::instance().histogram("inverter_poll_duration_ms", "Inverter data poll duration", METRICS_BUCKETS_MS, METRICS_BUCKETS_LEN(METRICS_BUCKETS_MS), VENDOR_LABELS[index]);
+        requestsPerPoll[index] = Metrics::instance().histogram("inverter_poll_requests", "Read requests per inverter data poll", METRICS_BUCKETS_COUNT, METRICS_BUCKETS_LEN(METRICS_BUCKETS_COUNT), VENDOR_LABELS[index]);
+        failures[index] = Metrics::instance().counter("inverter_poll_failures_total", "Failed inverter data polls", VENDOR_LABELS[index]);
+    }
+    latency[index]->observe(durationMs);
+    requestsPerPoll[index]->observe(requests);
+    if (!ok)
+    {
+        failures[index]->inc();
+    }
+}
+
 InverterData_t loadInverterData(WiFiDiscoveryResult_t &discoveryResult)
 {
     static SolaxModbusDongleAPI solaxModbusDongleAPI = SolaxModbusDongleAPI();
@@ -608,7 +848,9 @@ InverterData_t loadInverterData(WiFiDiscoveryResult_t &discoveryResult)
     static DeyeDongleAPI deyeDongleAPI = DeyeDongleAPI();
     static VictronDongleAPI victronDongleAPI = VictronDongleAPI();
     static GrowattDongleAPI growattDongleAPI = GrowattDongleAPI();
+    TRACE_SCOPE("inverter.poll");
     long millisBefore = millis();
+    uint32_t requestsBefore = Metrics::instance().counter("inverter_requests_total", "Read requests sent to inverter dongles")->get();
     InverterData_t d;
     switch (discoveryResult.type)
     {
@@ -634,6 +876,8 @@ InverterData_t loadInverterData(WiFiDiscoveryResult_t &discoveryResult)
         d.status = DONGLE_STATUS_UNSUPPORTED_DONGLE;
         break;
     }
+    recordInverterPollMetrics(discoveryResult.type, d.status == DONGLE_STATUS_OK, millis() - millisBefore,
+                              Metrics::instance().counter("inverter_requests_total", "Read requests sent to inverter dongles")->get() - requestsBefore);
     return d;
 }
 
@@ -669,6 +913,35 @@ bool supportsIntelligenceForCurrentInverter(WiFiDiscoveryResult_t &discoveryResu
     }
 }
 
+/**
+ * Write one predictor to flash through FlashGuard (no display flicker)
+ * @return false when a simulation holds the predictors, try again later
+ */
+bool savePredictor(bool consumption)
+{
+    static MetricHistogram *saveTime = Metrics::instance().histogram("predictor_save_ms", "Predictor flash write time", METRICS_BUCKETS_MS, METRICS_BUCKETS_LEN(METRICS_BUCKETS_MS));
+    if (xSemaphoreTake(predictor_mutex, 0) != pdTRUE)
+    {
+        return false;
+    }
+    unsigned long start = millis();
+    {
+        FlashGuard g(consumption ? "save:cons" : "save:prod");
+        if (consumption)
+        {
+            consumptionPredictor.saveToPreferences();
+        }
+        else
+        {
+            productionPredictor.saveToPreferences();
+        }
+    }
+    xSemaphoreGive(predictor_mutex);
+    saveTime->observe(millis() - start);
+    LOGD("%s predictor saved in %lu ms", consumption ? "Consumption" : "Production", millis() - start);
+    return true;
+}
+
 // Forward declaration - defined after syncTime()
 void syncTimeFromInverter(const InverterData_t &data);
 
@@ -708,11 +981,46 @@ bool loadInverterDataTask()
 
                 // Add samples for intelligence predictors
                 int pvPower = inverterData.pv1Power + inverterData.pv2Power + inverterData.pv3Power + inverterData.pv4Power;
-                consumptionPredictor.addSample(inverterData.loadPower);
-                productionPredictor.addSample(pvPower);
+                if (xSemaphoreTake(predictor_mutex, 0) == pdTRUE)
+                {
+                    consumptionPredictor.addSample(inverterData.loadPower);
+                    productionPredictor.addSample(pvPower);
+                    xSemaphoreGive(predictor_mutex);
+                }
+                else
+                {
+                    LOGD("Simulation running, predictor sample held back");
+                }
+                static int lastSampleQuarter = -1;
+                static SolarIntelligenceSettings_t recordedTariff; // buy/sell formula, reloaded every quarter
+                time_t sampleTs = time(nullptr);
+                struct tm sampleTm;
+                localtime_r(&sampleTs, &sampleTm);
+                int sampleQuarter = (sampleTm.tm_hour * 60 + sampleTm.tm_min) / 15;
+                if (sampleQuarter != lastSampleQuarter)
+                {
+                    // Checkpoint one predictor per hour in turns, so a reboot loses at most
+                    // two hours of learning and each flash write stays one predictor long
+                    if (lastSampleQuarter >= 0 && ++quartersSinceCheckpoint >= PREDICTOR_CHECKPOINT_QUARTERS)
+                    {
+                        checkpointDue = true;
+                    }
+                    lastSampleQuarter = sampleQuarter;
+                    predictorGeneration++;
+                    recordedTariff = IntelligenceSettingsStorage::load();
+                }
+                DayRecorder::instance().addSample(pvPower, inverterData.loadPower,
+                                                  inverterData.gridPowerL1 + inverterData.gridPowerL2 + inverterData.gridPowerL3,
+                                                  inverterData.soc, electricityPriceResult, recordedTariff);
+                // A save blocked by a running simulation is retried with the next sample
+                if (checkpointDue && savePredictor(checkpointConsumptionNext))
+                {
+                    checkpointDue = false;
+                    quartersSinceCheckpoint = 0;
+                    checkpointConsumptionNext = !checkpointConsumptionNext;
+                }
 
-                // Save predictors to flash only at midnight (to avoid display flickering from SPI contention)
-                // Data stays in PSRAM during the day, saved once per day
+                // Both predictors are saved at midnight, when they finish the day
                 static int lastPredictorSaveDay = -1;
                 time_t nowTs = time(nullptr);
                 struct tm* nowTm = localtime(&nowTs);
@@ -721,10 +1029,15 @@ bool loadInverterDataTask()
                 if (lastPredictorSaveDay >= 0 && currentDay != lastPredictorSaveDay)
                 {
                     LOGD("Midnight detected (day %d -> %d), saving predictors to flash", lastPredictorSaveDay, currentDay);
-                    { FlashGuard g("save:cons"); consumptionPredictor.saveToPreferences(); }
-                    { FlashGuard g("save:prod"); productionPredictor.saveToPreferences(); }
+                    midnightSaveDue = true;
                 }
                 lastPredictorSaveDay = currentDay;
+                if (midnightSaveDue && savePredictor(true) && savePredictor(false))
+                {
+                    midnightSaveDue = false;
+                    checkpointDue = false;
+                    quartersSinceCheckpoint = 0;
+                }
 
                 // Sync system time from inverter RTC if NTP failed
                 syncTimeFromInverter(inverterData);
@@ -758,6 +1071,7 @@ bool pairShellyTask()
     bool run = false;
     if (lastShellyPairAttempt == 0 || millis() - lastShellyPairAttempt > 30000)
     {
+        TRACE_SCOPE("task.shelly_pair");
         LOGD("[ShellyPair] Scanning for Shelly devices, SoftAP running: %d, paired: %d, connected: %d", 
              softAP.isRunning(), shellyAPI.getPairedCount(), softAP.getNumberOfConnectedDevices());
         
@@ -850,8 +1164,14 @@ bool reloadShellyTask()
     bool run = false;
     if (lastShellyAttempt == 0 || millis() - lastShellyAttempt > SHELLY_REFRESH_INTERVAL)
     {
+        TRACE_SCOPE("task.shelly");
         shellyResult = shellyAPI.getState();
         RequestedSmartControlState_t state = shellyRuleResolver.resolveSmartControlState(1500, 100, 500, 100);
+        bool scheduled = LoadScheduler::instance().isScheduledNow(SCHEDULED_LOAD_SHELLY);
+        if (scheduled)
+        {
+            state = SMART_CONTROL_FULL_ON; // planned quarter, run regardless of surplus
+        }
         if (state != SMART_CONTROL_UNKNOWN)
         {
             delay(1000);
@@ -863,6 +1183,10 @@ bool reloadShellyTask()
                 shellyResult = shellyAPI.getState(); // reload state after update
             }
         }
+        if (scheduled && shellyResult.activeCount > 0)
+        {
+            LoadScheduler::instance().confirmRunning(SCHEDULED_LOAD_SHELLY);
+        }
 
         lastShellyAttempt = millis();
         run = true;
@@ -873,22 +1197,30 @@ bool reloadShellyTask()
 bool loadElectricityPriceTask()
 {
     bool run = false;
-    if (lastElectricityPriceAttempt == 0 || millis() - lastElectricityPriceAttempt > ELECTRICITY_PRICE_REFRESH_INTERVAL)
+    // Rates fetched in the background - reconvert right away, but only when a rate changed
+    static uint32_t convertedRatesGeneration = 0;
+    ExchangeRateLoader *rateLoader = ExchangeRateLoader::getInstance();
+    bool ratesChanged = rateLoader->getGeneration() != convertedRatesGeneration;
+    // One TLS download at a time - wait for the rate fetch to finish
+    if (!rateLoader->isRefreshing() &&
+        (lastElectricityPriceAttempt == 0 || ratesChanged || millis() - lastElectricityPriceAttempt > ELECTRICITY_PRICE_REFRESH_INTERVAL))
     {
+        TRACE_SCOPE("task.prices");
         LOGD("Loading electricity price data");
+        convertedRatesGeneration = rateLoader->getGeneration();
         ElectricityPriceLoader loader;
         ElectricityPriceProvider_t provider = loader.getStoredElectricityPriceProvider();
 
-        if (electricityPriceResult)
+        // Load into a scratch copy - a failed load must not wipe the shown prices
+        static ElectricityPriceTwoDays_t *loaded = (ElectricityPriceTwoDays_t *)heap_caps_calloc(1, sizeof(ElectricityPriceTwoDays_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+
+        if (electricityPriceResult && loaded)
         {
-            // Nejprve načteme dnešní data
-            if (loader.loadTodayPrices(provider, electricityPriceResult))
+            // Nejprve načteme dnešní data (z cache, pokud už byla stažena)
+            if (loader.loadTodayPrices(provider, loaded))
             {
                 LOGD("Today electricity prices loaded");
 
-                // Invalidate intelligence to recalculate with new prices
-                lastIntelligenceAttempt = 0;
-
                 // Zkusíme načíst zítřejší data (pokud je po 13h)
                 time_t now = time(nullptr);
                 struct tm timeinfoCopy;
@@ -896,35 +1228,187 @@ bool loadElectricityPriceTask()
 
                 if (timeinfoCopy.tm_hour >= 13)
                 {
-                    loader.loadTomorrowPrices(provider, electricityPriceResult);
+                    loader.loadTomorrowPrices(provider, loaded);
+                }
+
+                // Invalidate intelligence only when prices actually changed (new day, tomorrow published, new rates)
+                bool changed = loaded->hasTomorrowData != electricityPriceResult->hasTomorrowData ||
+                               strcmp(loaded->currency, electricityPriceResult->currency) != 0 ||
+                               memcmp(loaded->prices, electricityPriceResult->prices, sizeof(loaded->prices)) != 0;
+                if (changed)
+                {
+                    buildElectricityPriceIndex(*loaded);
+                    memcpy(electricityPriceResult, loaded, sizeof(ElectricityPriceTwoDays_t));
+                    electricityPriceResult->updated = time(nullptr);
+                    lastIntelligenceAttempt = 0;
+                    LOGD("Electricity prices changed, intelligence invalidated");
                 }
             }
         }
 
+        // Both days are downloaded, a stale rate set may be fetched now
+        rateLoader->refreshInBackground();
+
         lastElectricityPriceAttempt = millis();
         run = true;
     }
     return run;
 }
 
-bool runIntelligenceTask()
+/**
+ * Apply a plan published by the intelligence worker - UI, inverter mode and chart predictions
+ */
+bool applyIntelligencePlanTask()
 {
-    bool run = false;
     static SolarInverterMode_t intelligencePlan[QUARTERS_TWO_DAYS]; // Plan for today + tomorrow
+    static IntelligencePlan_t *planBuffer = (IntelligencePlan_t *)heap_caps_calloc(1, sizeof(IntelligencePlan_t), MALLOC_CAP_SPIRAM);
+    static uint32_t appliedGeneration = 0;
+
+    if (planBuffer == nullptr || !intelligenceWorker.takePlan(*planBuffer, appliedGeneration))
+    {
+        return false;
+    }
+    TRACE_SCOPE("task.intelligence_apply");
+    const IntelligencePlan_t &plan = *planBuffer;
+    simulationGate.recordRun(plan.change, plan.elapsedMs, plan.stackFreeBytes);
+    DayRecorder::instance().setPlan(plan);
+
+    lastIntelligenceResult.command = plan.command;
+    lastIntelligenceResult.reason = plan.reason;
+    lastIntelligenceResult.expectedSavings = plan.totalSavings;
+
+    // The plan may have been simulated in the previous quarter
+    time_t now = time(nullptr);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    int currentQuarter = (timeinfo.tm_hour * 60 + timeinfo.tm_min) / 15;
+    int totalQuarters = plan.totalQuarters;
+    bool hasSpotPrices = electricityPriceResult && electricityPriceResult->updated > 0;
+
+    memcpy(intelligencePlan, plan.decisions, sizeof(intelligencePlan));
+    for (int q = 0; q < currentQuarter; q++)
+    {
+        intelligencePlan[q] = SI_MODE_UNKNOWN;
+    }
+
+    // Update UI with intelligence state - split into small chunks to avoid blocking LVGL
+    if (dashboardUI != nullptr)
+    {
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        dashboardUI->setIntelligenceState(plan.settings.enabled, plan.settings.enabled, hasSpotPrices);
+        xSemaphoreGive(lvgl_mutex);
+
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        dashboardUI->updateIntelligencePlanSummary(lastIntelligenceResult.command, intelligencePlan, currentQuarter, totalQuarters, plan.totalSavings, electricityPriceResult ? electricityPriceResult->currency : nullptr);
+        xSemaphoreGive(lvgl_mutex);
+
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        dashboardUI->updateIntelligenceUpcomingPlans(intelligencePlan, currentQuarter, totalQuarters, electricityPriceResult, &plan.settings);
+        xSemaphoreGive(lvgl_mutex);
+
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        dashboardUI->updateIntelligenceStats(plan.totalProductionKwh, plan.totalConsumptionKwh);
+        xSemaphoreGive(lvgl_mutex);
+    }
+
+    // Send command to inverter ONLY if intelligence is enabled
+    if (plan.settings.enabled)
+    {
+        bool quarterChanged = (currentQuarter != lastProcessedQuarter);
+        // Check if mode needs update: compare with lastSentMode AND actual inverter mode
+        // This handles cases where someone changed mode manually in inverter app
+        bool modeNeedsUpdate = (lastIntelligenceResult.command != SI_MODE_UNKNOWN &&
+                                (lastIntelligenceResult.command != lastSentMode && lastSentMode != SI_MODE_UNKNOWN ||
+                                 lastIntelligenceResult.command != inverterData.inverterMode));
+
+        if (quarterChanged || (modeNeedsUpdate && lastProcessedQuarter == -1))
+        {
+            LOGD("Quarter changed (%d -> %d) or first run, checking if mode update needed",
+                  lastProcessedQuarter, currentQuarter);
+            lastProcessedQuarter = currentQuarter;
+
+            if (modeNeedsUpdate)
+            {
+                LOGD("Mode update needed: command=%s, lastSent=%s, inverterMode=%s",
+                      IntelligenceResolver::commandToString(lastIntelligenceResult.command).c_str(),
+                      IntelligenceResolver::commandToString(lastSentMode).c_str(),
+                      IntelligenceResolver::commandToString(inverterData.inverterMode).c_str());
+
+                bool success = false;
+                if (wifiDiscoveryResult.type == CONNECTION_TYPE_SOLAX)
+                {
+                    static SolaxModbusDongleAPI solaxAPI;
+                    // Použij Power Control místo Work Mode - bezpečnější s automatickým timeoutem
+                    success = solaxAPI.setWorkModeViaPowerControl(
+                        wifiDiscoveryResult.inverterIP, 
+                        lastIntelligenceResult.command,
+                        (int32_t)(plan.settings.maxChargePowerKw * 1000),
+                        (int32_t)(plan.settings.maxDischargePowerKw * 1000),
+                        1200);  // 20 minut timeout (přepočítává se každých 15 min)
+                }
+                else if (wifiDiscoveryResult.type == CONNECTION_TYPE_GOODWE)
+                {
+                    success = goodweDongleAPI.setWorkMode(wifiDiscoveryResult.inverterIP, lastIntelligenceResult.command,
+                                                    plan.settings.minSocPercent, plan.settings.maxSocPercent);
+                }
+                else if (wifiDiscoveryResult.type == CONNECTION_TYPE_SOFAR)
+                {
+                    static SofarSolarDongleAPI sofarAPI;
+                    success = sofarAPI.setWorkMode(wifiDiscoveryResult.inverterIP, wifiDiscoveryResult.sn, lastIntelligenceResult.command);
+                }
+                else
+                {
+                    LOGD("Work mode control not implemented for inverter type %d", wifiDiscoveryResult.type);
+                }
+                
+                if (success)
+                {
+                    LOGI("Successfully sent work mode %s to inverter",
+                          IntelligenceResolver::commandToString(lastIntelligenceResult.command).c_str());
+                    lastSentMode = lastIntelligenceResult.command;
+                }
+                else if (wifiDiscoveryResult.type == CONNECTION_TYPE_SOLAX || wifiDiscoveryResult.type == CONNECTION_TYPE_GOODWE)
+                {
+                    LOGW("Failed to send work mode to inverter");
+                }
+            }
+            else
+            {
+                LOGD("Mode unchanged (%s), no update sent",
+                      IntelligenceResolver::commandToString(lastSentMode).c_str());
+            }
+        }
+    }
+    else
+    {
+        // Intelligence disabled - reset tracking
+        lastSentMode = SI_MODE_UNKNOWN;
+        lastProcessedQuarter = -1;
+    }
 
-    // Check if current time is aligned to 5-minute boundary (0, 5, 10, 15, 20, ...)
-    time_t now_check = time(nullptr);
-    struct tm *tm_check = localtime(&now_check);
-    int currentMinute = tm_check->tm_min;
-    bool is5MinuteAligned = (currentMinute % 5 == 0);
+    // Update chart predictions from simulation results (with SOC)
+    solarChartDataProvider.clearPredictions(true);
+    for (int q = plan.firstQuarter; q < totalQuarters; q++)
+    {
+        if (plan.soc[q] >= 0)
+        {
+            solarChartDataProvider.setPrediction(q, plan.productionWh[q], plan.consumptionWh[q], plan.soc[q]);
+        }
+    }
+    return true;
+}
 
-    // Run immediately if invalidated (lastIntelligenceAttempt == 0), otherwise only on 5-minute boundaries
-    bool shouldRun = (lastIntelligenceAttempt == 0) ||
-                     (is5MinuteAligned && millis() - lastIntelligenceAttempt > INTELLIGENCE_REFRESH_INTERVAL);
+bool runIntelligenceTask()
+{
+    bool run = false;
+
+    // Run immediately if invalidated (lastIntelligenceAttempt == 0), otherwise check every minute
+    bool forced = lastIntelligenceAttempt == 0;
+    bool shouldRun = forced || millis() - lastIntelligenceAttempt > INTELLIGENCE_REFRESH_INTERVAL;
 
     if (shouldRun)
     {
-        LOGD("Running intelligence resolver");
+        TRACE_SCOPE("task.intelligence");
 
         SolarIntelligenceSettings_t settings = IntelligenceSettingsStorage::load();
         bool hasSpotPrices = electricityPriceResult && electricityPriceResult->updated > 0;
@@ -933,6 +1417,20 @@ bool runIntelligenceTask()
         // Run simulation only if intelligence is enabled and we have all data
         if (canSimulate)
         {
+            time_t now_gate = time(nullptr);
+            struct tm timeinfo_gate;
+            localtime_r(&now_gate, &timeinfo_gate);
+            SolarPriceData_t priceData = toPriceData(*electricityPriceResult);
+            SimulationChange_t change = simulationGate.check(forced, inverterData.soc, priceData, settings, predictorGeneration,
+                                                             (timeinfo_gate.tm_hour * 60 + timeinfo_gate.tm_min) / 15);
+            if (change == SIMULATION_UNCHANGED)
+            {
+                // Inputs same as in the last run, plan and sent mode still hold
+                lastIntelligenceAttempt = millis();
+                return false;
+            }
+            LOGD("Running intelligence resolver");
+
             // Log input values
             time_t now_log = time(nullptr);
             struct tm *timeinfo_log = localtime(&now_log);
@@ -950,210 +1448,8 @@ bool runIntelligenceTask()
             LOGI("Battery: %.1f kWh capacity, min SOC: %d%%, max SOC: %d%%",
                   inverterData.batteryCapacityWh / 1000.0f, settings.minSocPercent, settings.maxSocPercent);
 
-            // Run simulation to get all quarter decisions at once
-            SolarBatteryState_t batteryState = toBatteryState(inverterData);
-            SolarPriceData_t priceData = toPriceData(*electricityPriceResult);
-            const auto &simResults = intelligenceResolver.runSimulation(batteryState, priceData, settings, true);
-            const auto &summary = intelligenceResolver.getLastSummary();
-
-            // Get current quarter result
-            if (!simResults.empty())
-            {
-                lastIntelligenceResult.command = simResults[0].decision;
-                lastIntelligenceResult.reason = simResults[0].reason;
-                lastIntelligenceResult.expectedSavings = summary.totalSavingsCzk;
-            }
-
-            LOGI("Recommended action: %s - %s",
-                  IntelligenceResolver::commandToString(lastIntelligenceResult.command).c_str(),
-                  lastIntelligenceResult.reason.c_str());
-
-            // Generate plan for all future quarters (for chart display)
-            time_t now = time(nullptr);
-            struct tm *timeinfo = localtime(&now);
-            int currentQuarter = (timeinfo->tm_hour * 60 + timeinfo->tm_min) / 15;
-
-            // Determine how many quarters to plan (today only or today + tomorrow)
-            int totalQuarters = electricityPriceResult->hasTomorrowData ? QUARTERS_TWO_DAYS : QUARTERS_OF_DAY;
-
-            // Fill intelligencePlan from simulation results
-            for (int q = 0; q < currentQuarter; q++)
-            {
-                intelligencePlan[q] = SI_MODE_UNKNOWN;
-            }
-
-            for (size_t i = 0; i < simResults.size(); i++)
-            {
-                int q = simResults[i].quarter;
-                if (q < QUARTERS_TWO_DAYS)
-                {
-                    intelligencePlan[q] = simResults[i].decision;
-                }
-            }
-
-            // Log simulation summary
-            LOGI("=== SIMULATION SUMMARY ===");
-            LOGI("Total production: %.1f kWh, consumption: %.1f kWh",
-                  summary.totalProductionKwh, summary.totalConsumptionKwh);
-            LOGI("Grid: bought %.1f kWh, sold %.1f kWh",
-                  summary.totalFromGridKwh, summary.totalToGridKwh);
-            LOGI("Intelligent: cost %.1f CZK, final SOC %.0f%%",
-                  summary.totalCostCzk, summary.finalBatterySoc);
-            LOGI("Baseline (dumb): cost %.1f CZK, final SOC %.0f%%",
-                  summary.baselineCostCzk, summary.baselineFinalSoc);
-            
-            // Detailní info o arbitráži
-            if (summary.chargedFromGridKwh > 0) {
-                float avgChargeCost = summary.chargedFromGridCost / summary.chargedFromGridKwh;
-                float potentialSavings = summary.chargedFromGridKwh * (summary.maxBuyPrice - avgChargeCost);
-                LOGI("Arbitrage: charged %.1f kWh @ avg %.1f CZK, max buy %.1f CZK, potential savings %.1f CZK",
-                      summary.chargedFromGridKwh, avgChargeCost, summary.maxBuyPrice, potentialSavings);
-            }
-            
-            LOGI("Battery value adjustment: %.1f CZK (diff %.1f kWh @ %.1f CZK)",
-                  summary.batteryValueAdjustment,
-                  (summary.finalBatterySoc - summary.baselineFinalSoc) / 100.0f * settings.batteryCapacityKwh,
-                  summary.maxBuyPrice - settings.batteryCostPerKwh);
-            LOGI("Savings vs dumb Self-Use: %.1f CZK", summary.totalSavingsCzk);
-
-            // Log summary of mode changes only
-            LOGI("=== MODE CHANGES ===");
-            int lastMode = -1;
-            for (int q = currentQuarter; q < totalQuarters; q++)
-            {
-                if (intelligencePlan[q] != lastMode)
-                {
-                    int hour = (q % QUARTERS_OF_DAY) / 4;
-                    int minute = ((q % QUARTERS_OF_DAY) % 4) * 15;
-                    const char *modeName = IntelligenceResolver::commandToString((SolarInverterMode_t)intelligencePlan[q]).c_str();
-                    float spotPrice = (q < (electricityPriceResult->hasTomorrowData ? 192 : 96))
-                                          ? electricityPriceResult->prices[q].electricityPrice
-                                          : 0;
-                    LOGI("  Q%d (%02d:%02d): %s (spot: %.2f %s)",
-                          q, hour, minute, modeName, spotPrice, electricityPriceResult->currency);
-                    lastMode = intelligencePlan[q];
-                }
-            }
-
-            // Fill remaining quarters with UNKNOWN if no tomorrow data
-            for (int q = totalQuarters; q < QUARTERS_TWO_DAYS; q++)
-            {
-                intelligencePlan[q] = SI_MODE_UNKNOWN;
-            }
-
-            // Use simulation summary for stats
-            float remainingProduction = summary.totalProductionKwh;
-            float remainingConsumption = summary.totalConsumptionKwh;
-            float totalSavings = summary.totalSavingsCzk;
-
-            // Update UI with intelligence state - split into small chunks to avoid blocking LVGL
-            if (dashboardUI != nullptr)
-            {
-                xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-                dashboardUI->setIntelligenceState(settings.enabled, settings.enabled, hasSpotPrices);
-                xSemaphoreGive(lvgl_mutex);
-
-                xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-                dashboardUI->updateIntelligencePlanSummary(lastIntelligenceResult.command, intelligencePlan, currentQuarter, totalQuarters, totalSavings, electricityPriceResult ? electricityPriceResult->currency : nullptr);
-                xSemaphoreGive(lvgl_mutex);
-
-                xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-                dashboardUI->updateIntelligenceUpcomingPlans(intelligencePlan, currentQuarter, totalQuarters, electricityPriceResult, &settings);
-                xSemaphoreGive(lvgl_mutex);
-
-                xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-                dashboardUI->updateIntelligenceStats(remainingProduction, remainingConsumption);
-                xSemaphoreGive(lvgl_mutex);
-            }
-
-            // Send command to inverter ONLY if intelligence is enabled
-            if (settings.enabled)
-            {
-                bool quarterChanged = (currentQuarter != lastProcessedQuarter);
-                // Check if mode needs update: compare with lastSentMode AND actual inverter mode
-                // This handles cases where someone changed mode manually in inverter app
-                bool modeNeedsUpdate = (lastIntelligenceResult.command != SI_MODE_UNKNOWN &&
-                                        (lastIntelligenceResult.command != lastSentMode && lastSentMode != SI_MODE_UNKNOWN ||
-                                         lastIntelligenceResult.command != inverterData.inverterMode));
-
-                if (quarterChanged || (modeNeedsUpdate && lastProcessedQuarter == -1))
-                {
-                    LOGD("Quarter changed (%d -> %d) or first run, checking if mode update needed",
-                          lastProcessedQuarter, currentQuarter);
-                    lastProcessedQuarter = currentQuarter;
-
-                    if (modeNeedsUpdate)
-                    {
-                        LOGD("Mode update needed: command=%s, lastSent=%s, inverterMode=%s",
-                              IntelligenceResolver::commandToString(lastIntelligenceResult.command).c_str(),
-                              IntelligenceResolver::commandToString(lastSentMode).c_str(),
-                              IntelligenceResolver::commandToString(inverterData.inverterMode).c_str());
-
-                        bool success = false;
-                        if (wifiDiscoveryResult.type == CONNECTION_TYPE_SOLAX)
-                        {
-                            static SolaxModbusDongleAPI solaxAPI;
-                            // Použij Power Control místo Work Mode - bezpečnější s automatickým timeoutem
-                            success = solaxAPI.setWorkModeViaPowerControl(
-                                wifiDiscoveryResult.inverterIP, 
-                                lastIntelligenceResult.command,
-                                (int32_t)(settings.maxChargePowerKw * 1000),
-                                (int32_t)(settings.maxDischargePowerKw * 1000),
-                                1200);  // 20 minut timeout (přepočítává se každých 15 min)
-                        }
-                        else if (wifiDiscoveryResult.type == CONNECTION_TYPE_GOODWE)
-                        {
-                            success = goodweDongleAPI.setWorkMode(wifiDiscoveryResult.inverterIP, lastIntelligenceResult.command,
-                                                            settings.minSocPercent, settings.maxSocPercent);
-                        }
-                        else if (wifiDiscoveryResult.type == CONNECTION_TYPE_SOFAR)
-                        {
-                            static SofarSolarDongleAPI sofarAPI;
-                            success = sofarAPI.setWorkMode(wifiDiscoveryResult.inverterIP, wifiDiscoveryResult.sn, lastIntelligenceResult.command);
-                        }
-                        else
-                        {
-                            LOGD("Work mode control not implemented for inverter type %d", wifiDiscoveryResult.type);
-                        }
-                        
-                        if (success)
-                        {
-                            LOGI("Successfully sent work mode %s to inverter",
-                                  IntelligenceResolver::commandToString(lastIntelligenceResult.command).c_str());
-                            lastSentMode = lastIntelligenceResult.command;
-                        }
-                        else if (wifiDiscoveryResult.type == CONNECTION_TYPE_SOLAX || wifiDiscoveryResult.type == CONNECTION_TYPE_GOODWE)
-                        {
-                            LOGW("Failed to send work mode to inverter");
-                        }
-                    }
-                    else
-                    {
-                        LOGD("Mode unchanged (%s), no update sent",
-                              IntelligenceResolver::commandToString(lastSentMode).c_str());
-                    }
-                }
-            }
-            else
-            {
-                // Intelligence disabled - reset tracking
-                lastSentMode = SI_MODE_UNKNOWN;
-                lastProcessedQuarter = -1;
-            }
-
-            // Update chart predictions from simulation results (with SOC)
-            solarChartDataProvider.clearPredictions(true);
-            for (const auto &sim : simResults)
-            {
-                int q = sim.quarter;
-                if (q < QUARTERS_TWO_DAYS)
-                {
-                    float predProductionWh = sim.productionKwh * 1000.0f;
-                    float predConsumptionWh = sim.consumptionKwh * 1000.0f;
-                    int predSoc = (int)sim.batterySoc;
-                    solarChartDataProvider.setPrediction(q, predProductionWh, predConsumptionWh, predSoc);
-                }
-            }
+            // Simulated by the worker, applied by applyIntelligencePlanTask() when published
+            intelligenceWorker.submit(inverterData.soc, priceData, settings, change);
         }
         else if (inverterData.status == DONGLE_STATUS_OK)
         {
@@ -1172,25 +1468,30 @@ bool runIntelligenceTask()
             localtime_r(&tomorrowTime, &tomorrowInfoCopy);
             int tomorrowMonth = tomorrowInfoCopy.tm_mon;
 
-            solarChartDataProvider.clearPredictions(true);
-
-            // Predictions for rest of today (SOC = -1 means don't show)
-            for (int q = currentQuarter + 1; q < QUARTERS_OF_DAY; q++)
+            // A cancelled simulation may still be reading the predictors, keep the old chart then
+            if (xSemaphoreTake(predictor_mutex, 0) == pdTRUE)
             {
-                float predProductionWh = productionPredictor.predictQuarterlyProduction(currentMonth, q);
-                float predConsumptionWh = consumptionPredictor.predictQuarterlyConsumption(currentDay, q);
-                solarChartDataProvider.setPrediction(q, predProductionWh, predConsumptionWh, -1); // -1 = no SOC
-            }
+                solarChartDataProvider.clearPredictions(true);
 
-            // Predictions for tomorrow - only if we have spot prices for tomorrow
-            if (electricityPriceResult != nullptr && electricityPriceResult->hasTomorrowData)
-            {
-                for (int q = 0; q < QUARTERS_OF_DAY; q++)
+                // Predictions for rest of today (SOC = -1 means don't show)
+                for (int q = currentQuarter + 1; q < QUARTERS_OF_DAY; q++)
                 {
-                    float predProductionWh = productionPredictor.predictQuarterlyProduction(tomorrowMonth, q);
-                    float predConsumptionWh = consumptionPredictor.predictQuarterlyConsumption(tomorrowDay, q);
-                    solarChartDataProvider.setPrediction(QUARTERS_OF_DAY + q, predProductionWh, predConsumptionWh, -1);
+                    float predProductionWh = productionPredictor.predictQuarterlyProduction(currentMonth, q);
+                    float predConsumptionWh = consumptionPredictor.predictQuarterlyConsumption(currentDay, q);
+                    solarChartDataProvider.setPrediction(q, predProductionWh, predConsumptionWh, -1); // -1 = no SOC
                 }
+
+                // Predictions for tomorrow - only if we have spot prices for tomorrow
+                if (electricityPriceResult != nullptr && electricityPriceResult->hasTomorrowData)
+                {
+                    for (int q = 0; q < QUARTERS_OF_DAY; q++)
+                    {
+                        float predProductionWh = productionPredictor.predictQuarterlyProduction(tomorrowMonth, q);
+                        float predConsumptionWh = consumptionPredictor.predictQuarterlyConsumption(tomorrowDay, q);
+                        solarChartDataProvider.setPrediction(QUARTERS_OF_DAY + q, predProductionWh, predConsumptionWh, -1);
+                    }
+                }
+                xSemaphoreGive(predictor_mutex);
             }
 
             // Update UI state
@@ -1216,12 +1517,54 @@ bool runIntelligenceTask()
             xSemaphoreGive(lvgl_mutex);
         }
 
+        if (!canSimulate)
+        {
+            // Don't apply a plan still being simulated for the old state
+            intelligenceWorker.cancel();
+            // Its inputs were never applied, simulate them again once possible
+            simulationGate.invalidate();
+        }
+
         lastIntelligenceAttempt = millis();
         run = true;
     }
     return run;
 }
 
+bool runLoadSchedulerTask()
+{
+    bool run = false;
+    LoadScheduler &scheduler = LoadScheduler::instance();
+    if (scheduler.isActive() && electricityPriceResult &&
+        (lastLoadSchedulerAttempt == 0 || scheduler.hasPendingRequest() || millis() - lastLoadSchedulerAttempt > LOAD_SCHEDULER_REFRESH_INTERVAL))
+    {
+        // Predictors busy with a simulation - try again on the next pass
+        if (xSemaphoreTake(predictor_mutex, 0) != pdTRUE)
+        {
+            return false;
+        }
+        TRACE_SCOPE("task.load_scheduler");
+        SolarIntelligenceSettings_t settings = IntelligenceSettingsStorage::load();
+        scheduler.update(*electricityPriceResult, settings, productionPredictor, consumptionPredictor);
+        xSemaphoreGive(predictor_mutex);
+        lastLoadSchedulerAttempt = millis();
+        run = true;
+    }
+    return run;
+}
+
+/**
+ * Charging current for the current quarter when the wallbox is scheduled, 0 otherwise
+ */
+int scheduledWallboxCurrent()
+{
+    if (!LoadScheduler::instance().isScheduledNow(SCHEDULED_LOAD_WALLBOX) || wallboxData.phases == 0)
+    {
+        return 0;
+    }
+    return constrain(LoadScheduler::instance().getRequest(SCHEDULED_LOAD_WALLBOX).maxPowerW / (wallboxData.phases * 230), 6, 16);
+}
+
 bool loadEcoVolterTask()
 {
     bool run = false;
@@ -1229,6 +1572,7 @@ bool loadEcoVolterTask()
     int period = ecoVolterAPI.isDiscovered() ? WALLBOX_STATUS_REFRESH_INTERVAL : WALLBOX_DISCOVERY_REFRESH_INTERVAL;
     if (lastEcoVolterAttempt == 0 || millis() - lastEcoVolterAttempt > period)
     {
+        TRACE_SCOPE("task.ecovolter");
         if (!ecoVolterAPI.isDiscovered())
         {
             ecoVolterAPI.queryMDNS();
@@ -1266,7 +1610,20 @@ void resolveEcoVolterSmartCharge()
 
     if (ecoVolterAPI.isDiscovered() && wallboxData.type == WALLBOX_TYPE_ECOVOLTER_PRO_V2 && wallboxData.evConnected)
     {
-        if (smartEnabled)
+        int scheduledCurrent = scheduledWallboxCurrent();
+        if (smartEnabled && scheduledCurrent > 0)
+        {
+            if (wallboxData.targetChargingCurrent != scheduledCurrent)
+            {
+                LOGD("EcoVolter: scheduled → %dA", scheduledCurrent);
+                ecoVolterAPI.setTargetCurrent(scheduledCurrent);
+            }
+            if (wallboxData.chargingPower > 0)
+            {
+                LoadScheduler::instance().confirmRunning(SCHEDULED_LOAD_WALLBOX);
+            }
+        }
+        else if (smartEnabled)
         {
             RequestedSmartControlState_t state = wallboxRuleResolver.resolveSmartControlState(wallboxData.phases * 230 * 6, wallboxData.phases * 230 * 1, wallboxData.phases * 230 * 6, wallboxData.phases * 230 * 1);
             if (state != SMART_CONTROL_UNKNOWN)
@@ -1320,6 +1677,7 @@ bool loadSolaxWallboxTask()
     int period = solaxWallboxAPI.isDiscovered() ? WALLBOX_STATUS_REFRESH_INTERVAL : WALLBOX_DISCOVERY_REFRESH_INTERVAL;
     if (lastWallboxStatusAttempt == 0 || millis() - lastWallboxStatusAttempt > period)
     {
+        TRACE_SCOPE("task.solax_wallbox");
         if (!solaxWallboxAPI.isDiscovered())
         {
             solaxWallboxAPI.discoverWallbox();
@@ -1344,7 +1702,21 @@ void resolveSolaxSmartCharge()
 
     if (solaxWallboxAPI.isDiscovered() && wallboxData.type == WALLBOX_TYPE_SOLAX && wallboxData.evConnected)
     {
-        if (smartEnabled)
+        int scheduledCurrent = scheduledWallboxCurrent();
+        if (smartEnabled && scheduledCurrent > 0)
+        {
+            if (wallboxData.chargingCurrent == 0 || wallboxData.targetChargingCurrent != scheduledCurrent)
+            {
+                LOGD("Solax: scheduled → %dA", scheduledCurrent);
+                solaxWallboxAPI.setMaxCurrent(scheduledCurrent);
+                solaxWallboxAPI.setCharging(true);
+            }
+            if (wallboxData.chargingPower > 0)
+            {
+                LoadScheduler::instance().confirmRunning(SCHEDULED_LOAD_WALLBOX);
+            }
+        }
+        else if (smartEnabled)
         {
             RequestedSmartControlState_t state = wallboxRuleResolver.resolveSmartControlState(wallboxData.phases * 230 * 6, wallboxData.phases * 230 * 1, wallboxData.phases * 230 * 6, wallboxData.phases * 230 * 1);
             if (state != SMART_CONTROL_UNKNOWN)
@@ -1500,6 +1872,24 @@ void logMemory()
     // Use remoteLogger debug level if needed
 }
 
+/**
+ * Allocate the setup screens on first use instead of at boot. Their widgets
+ * are built by show() and deleted by LVGL when the screen is left.
+ */
+void ensureSetupScreens()
+{
+    if (wifiSetupUI == NULL)
+    {
+        wifiSetupUI = (WiFiSetupUI*)heap_caps_malloc(sizeof(WiFiSetupUI), MALLOC_CAP_SPIRAM);
+        new (wifiSetupUI) WiFiSetupUI(dongleDiscovery);
+    }
+    if (intelligenceSetupUI == NULL)
+    {
+        intelligenceSetupUI = (IntelligenceSetupUI*)heap_caps_malloc(sizeof(IntelligenceSetupUI), MALLOC_CAP_SPIRAM);
+        new (intelligenceSetupUI) IntelligenceSetupUI();
+    }
+}
+
 void onEntering(state_t newState)
 {
     LOGD("Entering state %d", newState);
@@ -1524,17 +1914,21 @@ void onEntering(state_t newState)
                 LOGD("Initializing LittleFS and loading predictors...");
                 { FlashGuard g("load:cons"); consumptionPredictor.loadFromPreferences(); }
                 { FlashGuard g("load:prod"); productionPredictor.loadFromPreferences(); }
+                // Mount (or format) now, not on the first archived day or /prices.csv request
+                PriceArchive::instance().begin();
                 predictorsLoaded = true;
                 LOGD("Predictors loaded successfully");
             }
         }
         break;
     case STATE_WIFI_SETUP:
+        ensureSetupScreens();
         xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
         screenMgr.switchTo(wifiSetupUI, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300);
         xSemaphoreGive(lvgl_mutex);
         break;
     case STATE_INTELLIGENCE_SETUP:
+        ensureSetupScreens();
         xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
         screenMgr.switchTo(intelligenceSetupUI, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300);
         xSemaphoreGive(lvgl_mutex);
@@ -1810,8 +2204,10 @@ void updateState()
             // If reset was requested, clear all prediction data
             if (intelligenceSetupUI->requestClearPredictions)
             {
+                xSemaphoreTake(predictor_mutex, portMAX_DELAY);
                 consumptionPredictor.clearAllData();
                 productionPredictor.clearAllData();
+                xSemaphoreGive(predictor_mutex);
                 intelligenceSetupUI->requestClearPredictions = false;
                 LOGI("Prediction data cleared by user request");
             }
@@ -1835,11 +2231,21 @@ void updateState()
             // Intelligence not supported for this inverter, ignore request
             showIntelligenceSettings = false;
         }
-        else if ((millis() - previousInverterData.millis) > UI_REFRESH_INTERVAL && electricityPriceResult && previousElectricityPriceResult)
+        else if (electricityPriceResult && previousElectricityPriceResult && UiBenchmark::instance().step(benchmarkData, previousBenchmarkData))
         {
+            TRACE_SCOPE("dashboard.benchmark");
+            xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+            dashboardUI->update(benchmarkData, previousBenchmarkData, uiMedianPowerSampler, shellyResult, shellyResult, wallboxData, wallboxData, solarChartDataProvider, *electricityPriceResult, *previousElectricityPriceResult, wifiSignalPercent());
+            xSemaphoreGive(lvgl_mutex);
+            LvglPacer::instance().wake();
+        }
+        else if ((millis() - previousInverterData.millis) > UI_REFRESH_INTERVAL && electricityPriceResult && previousElectricityPriceResult && !UiBenchmark::instance().isRunning())
+        {
+            TRACE_SCOPE("dashboard.update");
             xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
             dashboardUI->update(inverterData, previousInverterData.status == DONGLE_STATUS_OK ? previousInverterData : inverterData, uiMedianPowerSampler, shellyResult, previousShellyResult, wallboxData, previousWallboxData, solarChartDataProvider, *electricityPriceResult, *previousElectricityPriceResult, wifiSignalPercent());
             xSemaphoreGive(lvgl_mutex);
+            LvglPacer::instance().wake();
 
             previousShellyResult = shellyResult;
             previousInverterData = inverterData;
@@ -1855,6 +2261,7 @@ void updateState()
             if (pendingModeChangeRequest)
             {
                 pendingModeChangeRequest = false;
+                TRACE_SCOPE("inverter.set_mode");
                 SolarInverterMode_t mode = pendingModeChange;
                 LOGD("Processing pending mode change: %d", mode);
 
@@ -1901,10 +2308,18 @@ void updateState()
             {
                 break;
             }
+            if (applyIntelligencePlanTask())
+            {
+                break;
+            }
             if (runIntelligenceTask())
             {
                 break;
             }
+            if (runLoadSchedulerTask())
+            {
+                break;
+            }
             if (discoverDonglesTask())
             {
                 break;
@@ -1937,6 +2352,7 @@ void updateState()
             
             // Flush remote logs when cache is nearly full (>80%)
             if (remoteLogger.needsFlush()) {
+                TRACE_SCOPE("remote_log.flush");
                 int sent = remoteLogger.flush();
                 if (sent > 0) {
                     LOGD("Remote logs flushed: %d entries sent (cache was nearly full)", sent);
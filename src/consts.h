@@ -4,4 +4,19 @@
 
 #ifndef VERSION_NUMBER
 #define VERSION_NUMBER 0
-#endif
\ No newline at end of file
+#endif
+#ifndef TRACING
+#define TRACING 0
+#endif
+
+// tft rotation, touch panel follows it (0 = native panel orientation)
+#ifndef DISPLAY_ROTATION
+#define DISPLAY_ROTATION 2
+#endif
+// CrowPanel Advance: LVGL renders straight into two panel framebuffers swapped at VSYNC.
+// Needs DISPLAY_ROTATION 0 (LVGL can't rotate into the framebuffer), which is upside down
+// on the default mount - only for panels mounted the other way round. Building it with
+// another rotation stops with an #error in app.cpp.
+#ifndef LVGL_DIRECT_MODE
+#define LVGL_DIRECT_MODE 0
+#endif
@@ -5,6 +5,7 @@
 // Použij patchnutou verzi Bus_RGB s VSYNC callbackem
 #include "lgfx_patch/Bus_RGB.hpp"
 #include <driver/i2c.h>
+#include "consts.h"
 
 /*******************************************************************************
  * Please define the corresponding macros based on the board you have purchased.
@@ -78,6 +79,7 @@ public:
             cfg.vsync_pulse_width = 4;
             cfg.vsync_back_porch = 8;
             cfg.pclk_idle_high = 1;
+            cfg.double_frame_buffer = LVGL_DIRECT_MODE;
 
             _bus_instance.config(cfg);
             _panel_instance.setBus(&_bus_instance);
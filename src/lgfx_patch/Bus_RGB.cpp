@@ -71,15 +71,23 @@ namespace lgfx
     uint32_t intr_status = dev->lc_dma_int_st.val & 0x03;
     dev->lc_dma_int_clr.val = intr_status;
     if (intr_status & LCD_LL_EVENT_VSYNC_END) {
+      // PATCH: přepnutí framebufferu - DMA se restartuje od začátku jiného bufferu
+      uint8_t index = me->_next_fb_index;
+      bool swapped = index != me->_fb_index;
+      me->_fb_index = index;
+
       GDMA.channel[me->_dma_ch].out.conf0.out_rst = 1;
       GDMA.channel[me->_dma_ch].out.conf0.out_rst = 0;
-      GDMA.channel[me->_dma_ch].out.link.addr = (uintptr_t)&(me->_dmadesc_restart);
+      GDMA.channel[me->_dma_ch].out.link.addr = (uintptr_t)&(me->_dmadesc_restart[index]);
       GDMA.channel[me->_dma_ch].out.link.start = 1;
 
       // PATCH: Volat user VSYNC callback
       if (me->_vsync_callback) {
         me->_vsync_callback(me->_vsync_user_ctx);
       }
+      if (swapped && me->_swap_callback) {
+        me->_swap_callback(me->_swap_user_ctx);
+      }
     }
   }
 
@@ -187,37 +195,29 @@ namespace lgfx
 
 
     size_t fb_len = (_cfg.panel->width() * pixel_bytes) * _cfg.panel->height();
-    auto data = (uint8_t*)heap_alloc_psram(fb_len);
-    _frame_buffer = data;
-    static constexpr size_t MAX_DMA_LEN = (4096-64);
-    size_t dmadesc_size = (fb_len - 1) / MAX_DMA_LEN + 1;
-    auto dmadesc = (dma_descriptor_t*)heap_caps_malloc(sizeof(dma_descriptor_t) * dmadesc_size, MALLOC_CAP_DMA);
-    _dmadesc = dmadesc;
-
-    size_t len = fb_len;
-    while (len > MAX_DMA_LEN)
+    uint8_t fb_count = _cfg.double_frame_buffer ? 2 : 1;
+    for (uint8_t i = 0; i < fb_count; ++i)
     {
-      len -= MAX_DMA_LEN;
-      dmadesc->buffer = (uint8_t *)data;
-      data += MAX_DMA_LEN;
-      *(uint32_t*)dmadesc = MAX_DMA_LEN | MAX_DMA_LEN << 12 | 0x80000000;
-      dmadesc->next = dmadesc + 1;
-      dmadesc++;
+      auto data = (uint8_t*)heap_alloc_psram(fb_len);
+      if (data == nullptr || !initDescriptors(i, data, fb_len, pixel_bytes))
+      {
+        ESP_LOGE("Bus_RGB", "Frame buffer %d allocation failed", i);
+        if (data) { heap_free(data); }
+        break;
+      }
+      _frame_buffers[i] = data;
     }
-    *(uint32_t*)dmadesc = ((len + 3) & ( ~3 )) | len << 12 | 0xC0000000;
-    dmadesc->buffer = (uint8_t *)data;
-    dmadesc->next = _dmadesc;
-    GDMA.channel[_dma_ch].out.link.addr = (uintptr_t)&(_dmadesc);
+    if (_frame_buffers[0] == nullptr)
+    {
+      // Without the first buffer the DMA would scan from a null descriptor
+      esp_lcd_del_i80_bus(_i80_bus);
+      _i80_bus = nullptr;
+      return false;
+    }
+    GDMA.channel[_dma_ch].out.link.addr = (uintptr_t)_dmadesc[0];
     GDMA.channel[_dma_ch].out.link.start = 1;
     //////////////////////////////////////////////
 
-    memcpy(&_dmadesc_restart, _dmadesc, sizeof(_dmadesc_restart));
-    int skip_bytes = (GDMA_LL_L2FIFO_BASE_SIZE + 1) * pixel_bytes;
-    auto p = (uint8_t*)(_dmadesc_restart.buffer);
-    _dmadesc_restart.buffer = &p[skip_bytes];
-    _dmadesc_restart.dw0.length -= skip_bytes;
-    _dmadesc_restart.dw0.size -= skip_bytes;
-
 
     uint32_t hsw = _cfg.hsync_pulse_width;
     uint32_t hbp = _cfg.hsync_back_porch;
@@ -316,9 +316,43 @@ namespace lgfx
     return true;
   }
 
+  bool Bus_RGB_Patched::initDescriptors(uint8_t index, uint8_t* data, size_t fb_len, uint8_t pixel_bytes)
+  {
+    static constexpr size_t MAX_DMA_LEN = (4096-64);
+    size_t dmadesc_size = (fb_len - 1) / MAX_DMA_LEN + 1;
+    auto dmadesc = (dma_descriptor_t*)heap_caps_malloc(sizeof(dma_descriptor_t) * dmadesc_size, MALLOC_CAP_DMA);
+    if (dmadesc == nullptr)
+    {
+      return false;
+    }
+    _dmadesc[index] = dmadesc;
+
+    size_t len = fb_len;
+    while (len > MAX_DMA_LEN)
+    {
+      len -= MAX_DMA_LEN;
+      dmadesc->buffer = (uint8_t *)data;
+      data += MAX_DMA_LEN;
+      *(uint32_t*)dmadesc = MAX_DMA_LEN | MAX_DMA_LEN << 12 | 0x80000000;
+      dmadesc->next = dmadesc + 1;
+      dmadesc++;
+    }
+    *(uint32_t*)dmadesc = ((len + 3) & ( ~3 )) | len << 12 | 0xC0000000;
+    dmadesc->buffer = (uint8_t *)data;
+    dmadesc->next = _dmadesc[index];
+
+    memcpy(&_dmadesc_restart[index], _dmadesc[index], sizeof(dma_descriptor_t));
+    int skip_bytes = (GDMA_LL_L2FIFO_BASE_SIZE + 1) * pixel_bytes;
+    auto p = (uint8_t*)(_dmadesc_restart[index].buffer);
+    _dmadesc_restart[index].buffer = &p[skip_bytes];
+    _dmadesc_restart[index].dw0.length -= skip_bytes;
+    _dmadesc_restart[index].dw0.size -= skip_bytes;
+    return true;
+  }
+
   uint8_t* Bus_RGB_Patched::getDMABuffer(uint32_t length)
   {
-    return _frame_buffer;
+    return _frame_buffers[0];
     // return _rgb_panel->fb;
   }
 
@@ -330,11 +364,20 @@ namespace lgfx
     if (_i80_bus)
     {
       esp_lcd_del_i80_bus(_i80_bus);
+      _i80_bus = nullptr;
     }
-    if (_dmadesc)
+    for (uint8_t i = 0; i < 2; ++i)
     {
-      heap_caps_free(_dmadesc);
-      _dmadesc = nullptr;
+      if (_dmadesc[i])
+      {
+        heap_caps_free(_dmadesc[i]);
+        _dmadesc[i] = nullptr;
+      }
+      if (_frame_buffers[i])
+      {
+        heap_free(_frame_buffers[i]);
+        _frame_buffers[i] = nullptr;
+      }
     }
   }
 
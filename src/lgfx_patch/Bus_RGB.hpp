@@ -97,6 +97,9 @@ namespace lgfx
       bool pclk_active_neg = 1;
       bool de_idle_high = 0;
       bool pclk_idle_high = 0;
+
+      // PATCH: druhý framebuffer pro LVGL direct mode, přepíná se při VSYNC
+      bool double_frame_buffer = false;
     };
 
     const config_t& config(void) const { return _cfg; }
@@ -136,6 +139,28 @@ namespace lgfx
       _vsync_user_ctx = user_ctx;
     }
 
+    // Framebuffer 0 nebo 1 (nullptr pokud není alokován)
+    uint8_t* getFrameBuffer(uint8_t index) const {
+      return index < 2 ? _frame_buffers[index] : nullptr;
+    }
+
+    // Zobrazit daný framebuffer od příštího VSYNC
+    bool setFrameBuffer(const void* frame_buffer) {
+      for (uint8_t i = 0; i < 2; ++i) {
+        if (_frame_buffers[i] != nullptr && _frame_buffers[i] == frame_buffer) {
+          _next_fb_index = i;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Voláno z ISR, když VSYNC přepnul na framebuffer nastavený přes setFrameBuffer
+    void setFrameSwapCallback(vsync_callback_t callback, void* user_ctx = nullptr) {
+      _swap_callback = callback;
+      _swap_user_ctx = user_ctx;
+    }
+
   private:
     config_t _cfg;
     
@@ -143,16 +168,22 @@ namespace lgfx
     vsync_callback_t _vsync_callback = nullptr;
     void* _vsync_user_ctx = nullptr;
 
-    dma_descriptor_t _dmadesc_restart;
-    dma_descriptor_t* _dmadesc = nullptr;
+    vsync_callback_t _swap_callback = nullptr;
+    void* _swap_user_ctx = nullptr;
+
+    dma_descriptor_t _dmadesc_restart[2];
+    dma_descriptor_t* _dmadesc[2] = { nullptr, nullptr };
     esp_lcd_i80_bus_handle_t _i80_bus = nullptr;
     int32_t _dma_ch;
 
     esp_lcd_panel_handle_t _panel_handle = nullptr;
 
-    uint8_t *_frame_buffer = nullptr;
+    uint8_t *_frame_buffers[2] = { nullptr, nullptr };
+    volatile uint8_t _fb_index = 0;       // právě zobrazovaný framebuffer
+    volatile uint8_t _next_fb_index = 0;  // framebuffer pro příští VSYNC
     intr_handle_t _intr_handle;
     static void lcd_default_isr_handler(void *args);
+    bool initDescriptors(uint8_t index, uint8_t* data, size_t fb_len, uint8_t pixel_bytes);
   };
 
 //----------------------------------------------------------------------------
@@ -2,6 +2,7 @@
  * Size: 36 px
  * Bpp: 4
  * Opts: --bpp 4 --size 36 --font SquareLine/assets/OpenSans-Bold.ttf -r 0x20-0xFF,0x100-0x17F --format lvgl --no-compress --no-prefilter -o src/ui/ui_font_OpenSansLargeBold.c
+ * Subset: 0x20,0x25,0x2B-0x39,0x7E
  ******************************************************************************/
 
 #include "ui.h"
@@ -21,109 +22,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0xdf, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xf2, 0xbf,
-    0xff, 0xff, 0x1b, 0xff, 0xff, 0xf0, 0xaf, 0xff,
-    0xff, 0x9, 0xff, 0xff, 0xe0, 0x8f, 0xff, 0xfd,
-    0x7, 0xff, 0xff, 0xd0, 0x6f, 0xff, 0xfc, 0x6,
-    0xff, 0xff, 0xb0, 0x5f, 0xff, 0xfa, 0x4, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xf8, 0x2, 0xff, 0xff,
-    0x80, 0x1f, 0xff, 0xf7, 0x0, 0xff, 0xff, 0x60,
-    0xf, 0xff, 0xf5, 0x0, 0x22, 0x22, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xef,
-    0xb2, 0xa, 0xff, 0xff, 0xe0, 0xef, 0xff, 0xff,
-    0x2e, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xfe, 0x0,
-    0x9e, 0xfb, 0x20,
-
-    /* U+0022 "\"" */
-    0x9f, 0xff, 0xf3, 0x3, 0xff, 0xff, 0x98, 0xff,
-    0xff, 0x20, 0x2f, 0xff, 0xf8, 0x7f, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0x76, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xf6, 0x4f, 0xff, 0xe0, 0x0, 0xef, 0xff,
-    0x43, 0xff, 0xfd, 0x0, 0xd, 0xff, 0xf3, 0x2f,
-    0xff, 0xb0, 0x0, 0xbf, 0xff, 0x21, 0xff, 0xfa,
-    0x0, 0xa, 0xff, 0xf1, 0xf, 0xff, 0x90, 0x0,
-    0x9f, 0xff, 0x0, 0x44, 0x42, 0x0, 0x2, 0x44,
-    0x40,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40, 0x4,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf1, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0xa, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x50,
-    0x3, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x0, 0x6f, 0xff, 0x60, 0x0,
-    0x0, 0xa, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xad,
-    0xff, 0xfc, 0xaa, 0xa5, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x9, 0xff, 0xf3, 0x0, 0x5f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x0,
-    0x8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x0, 0xe,
-    0xff, 0xe0, 0x0, 0x0, 0x2, 0xaa, 0xaa, 0xbf,
-    0xff, 0xda, 0xaa, 0xff, 0xfe, 0xaa, 0xaa, 0x20,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0,
-    0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x80, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x4f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x20, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xe0, 0x0, 0xaf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfb,
-    0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0xef,
-    0xa4, 0x31, 0x0, 0x0, 0x0, 0x0, 0x7, 0xcf,
-    0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x4, 0xff, 0xff, 0xfa, 0x3e, 0xf8,
-    0x25, 0x8d, 0xf8, 0x0, 0x6f, 0xff, 0xfe, 0x0,
-    0xef, 0x80, 0x0, 0x2, 0x10, 0x6, 0xff, 0xff,
-    0xf0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xb1, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfb, 0xdf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0xaf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x2, 0xff, 0xff, 0xf3, 0x6b, 0x50,
-    0x0, 0x0, 0xef, 0x80, 0x5f, 0xff, 0xff, 0x16,
-    0xff, 0xfb, 0x74, 0x3e, 0xfa, 0x8f, 0xff, 0xff,
-    0xd0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x3, 0x7b,
-    0xdf, 0xff, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x63, 0x0, 0x0, 0x0, 0x0,
-
     /* U+0025 "%" */
     0x0, 0x8, 0xdf, 0xfe, 0x92, 0x0, 0x0, 0x0,
     0x0, 0x1, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
@@ -177,126 +75,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff,
     0xea, 0x20, 0x0,
 
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x93, 0x38, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x0, 0xbf,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf9, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0x0,
-    0x1, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x60, 0x2d, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x9, 0xcc, 0xcc,
-    0xa0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0x40, 0x0, 0x6f,
-    0xff, 0xff, 0x30, 0xd, 0xff, 0xff, 0xf6, 0x1d,
-    0xff, 0xff, 0xf4, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x90, 0x1, 0xdf, 0xff, 0xff,
-    0x55, 0xff, 0xff, 0xf5, 0x0, 0x7f, 0xff, 0xff,
-    0x20, 0x0, 0x1c, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xc0, 0x0, 0x8f, 0xff, 0xff, 0x10, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x8f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xb8, 0x79, 0xdf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x52, 0xef, 0xff, 0xff, 0x80, 0x0, 0x0, 0x6,
-    0xad, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x2e, 0xff,
-    0xff, 0xf8,
-
-    /* U+0027 "'" */
-    0x9f, 0xff, 0xf3, 0x8f, 0xff, 0xf2, 0x7f, 0xff,
-    0xf0, 0x6f, 0xff, 0xf0, 0x4f, 0xff, 0xe0, 0x3f,
-    0xff, 0xd0, 0x2f, 0xff, 0xb0, 0x1f, 0xff, 0xa0,
-    0xf, 0xff, 0x90, 0x4, 0x44, 0x20,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x20, 0x0, 0x1, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x2f,
-    0xff, 0xf8, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x5f,
-    0xff, 0xf6, 0x0, 0x0, 0x9, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x1f,
-    0xff, 0xfa, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x8f, 0xff, 0xf2,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x8f, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x60, 0x0, 0x0, 0x2f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xc, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x25, 0x55, 0x50,
-
-    /* U+0029 ")" */
-    0x9f, 0xff, 0xd0, 0x0, 0x0, 0xe, 0xff, 0xf9,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xcf, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xf5,
-    0x0, 0x0, 0xe, 0xff, 0xfc, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x30, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0xaf,
-    0xff, 0xf1, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x2f, 0xff,
-    0xf9, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0x0, 0x0, 0xe, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xfb, 0x0, 0x0, 0x1f, 0xff, 0xfa, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x5f, 0xff,
-    0xf6, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0,
-    0xcf, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0xb0,
-    0x0, 0x5, 0xff, 0xff, 0x60, 0x0, 0xb, 0xff,
-    0xff, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xf1, 0x0, 0x1, 0xff, 0xff, 0x80,
-    0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x4f, 0xff,
-    0xf3, 0x0, 0x0, 0x45, 0x55, 0x30, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0x10, 0x5f, 0xc7, 0x20,
-    0xe, 0xff, 0x70, 0x4, 0x8d, 0xf0, 0x7f, 0xff,
-    0xfe, 0x9e, 0xff, 0xbb, 0xff, 0xff, 0xf2, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x45, 0x78, 0x9b, 0xff, 0xff, 0xfd, 0x88,
-    0x88, 0x83, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xef,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0x4c, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0x5, 0xff, 0xff, 0x60, 0x0, 0x0, 0x7f,
-    0xff, 0xf6, 0x0, 0xcf, 0xff, 0xf2, 0x0, 0x0,
-    0x29, 0xff, 0xf0, 0x0, 0x5f, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x2a, 0x80, 0x0, 0xc, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
     /* U+002B "+" */
     0x0, 0x0, 0x0, 0x4, 0x77, 0x71, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0,
@@ -689,2096 +467,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0xe, 0xff,
     0xff, 0xec, 0x94, 0x0, 0x0, 0x0, 0x0,
 
-    /* U+003A ":" */
-    0x1a, 0xff, 0xb2, 0xa, 0xff, 0xff, 0xe0, 0xef,
-    0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xfd, 0x0, 0x9e, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xef, 0xb2, 0xa, 0xff, 0xff, 0xe0,
-    0xef, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2, 0x9f,
-    0xff, 0xfe, 0x0, 0x9e, 0xfb, 0x20,
-
-    /* U+003B ";" */
-    0x1, 0xaf, 0xfb, 0x20, 0xa, 0xff, 0xff, 0xe0,
-    0xe, 0xff, 0xff, 0xf2, 0xe, 0xff, 0xff, 0xf2,
-    0x9, 0xff, 0xff, 0xd0, 0x0, 0x9e, 0xfb, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x5, 0xff, 0xff, 0xc0,
-    0x8, 0xff, 0xff, 0x70, 0xb, 0xff, 0xff, 0x10,
-    0xe, 0xff, 0xfc, 0x0, 0x2f, 0xff, 0xf6, 0x0,
-    0x5f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0x80, 0x0,
-    0xad, 0xdd, 0x20, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xfa, 0x30, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff,
-    0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3,
-
-    /* U+003D "=" */
-    0x5d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-
-    /* U+003E ">" */
-    0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff,
-    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xdf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x39,
-    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x6c,
-    0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x2, 0x9f,
-    0xff, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x4, 0x8b, 0xef, 0xff, 0xda, 0x40, 0x0,
-    0x1, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0xb, 0xff, 0xea, 0x75, 0x58, 0xef,
-    0xff, 0xff, 0x10, 0x3c, 0x50, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0xfd, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9c, 0xef,
-    0xff, 0xda, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xc8, 0x65, 0x45, 0x8c, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf7, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x12, 0x21, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x10, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x2, 0x9e,
-    0xff, 0xff, 0xfd, 0xa7, 0x10, 0xbf, 0xff, 0x80,
-    0x0, 0xbf, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x2f, 0xff, 0xe0, 0x2,
-    0xff, 0xfe, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0xc, 0xff, 0xf2, 0x7, 0xff,
-    0xf8, 0x0, 0x5f, 0xff, 0xfb, 0x30, 0x1, 0xef,
-    0xff, 0x10, 0x8, 0xff, 0xf5, 0xb, 0xff, 0xf3,
-    0x0, 0xef, 0xff, 0xa0, 0x0, 0x0, 0xef, 0xff,
-    0x10, 0x6, 0xff, 0xf7, 0xf, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x5, 0xff, 0xf7, 0x1f, 0xff, 0xd0, 0x7, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x5,
-    0xff, 0xf7, 0x2f, 0xff, 0xb0, 0x8, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x6, 0xff,
-    0xf6, 0x3f, 0xff, 0xb0, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0x4, 0xff, 0xfe, 0x0, 0x9, 0xff, 0xf3,
-    0x2f, 0xff, 0xb0, 0x7, 0xff, 0xfa, 0x0, 0x0,
-    0x8, 0xff, 0xfd, 0x0, 0xc, 0xff, 0xf0, 0x1f,
-    0xff, 0xd0, 0x3, 0xff, 0xff, 0x10, 0x0, 0xe,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xa0, 0xf, 0xff,
-    0xf0, 0x0, 0xdf, 0xff, 0xd5, 0x35, 0xcf, 0xff,
-    0xff, 0x84, 0xdf, 0xff, 0x30, 0xc, 0xff, 0xf4,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x8, 0xff, 0xf9, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xfe, 0x44, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x2, 0xff, 0xff, 0x20, 0x0,
-    0x29, 0xdf, 0xfd, 0x81, 0x0, 0x4c, 0xff, 0xc6,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x27, 0xc4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xfb, 0x76, 0x55, 0x68,
-    0xbe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x8b, 0xdf, 0xff, 0xfd, 0xb8, 0x51, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xcf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf4, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0xe, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x9f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf3, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x90, 0x0, 0xbf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x0,
-    0x6, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0xaf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x2,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x5d, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfa,
-
-    /* U+0042 "B" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa7, 0x20,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x30, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x9e, 0xff, 0xff,
-    0xff, 0x50, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x80, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xa0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x90,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x70, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xfc, 0x55,
-    0x55, 0x7c, 0xff, 0xff, 0xfa, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x15, 0xcf, 0xff, 0xff, 0xa0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xfd, 0x88, 0x88, 0x9c,
-    0xff, 0xff, 0xff, 0xb0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xc9, 0x30, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xb9, 0x8a, 0xef,
-    0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x3, 0x9f, 0x30, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x27, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xbe, 0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
-    0xfe, 0xda, 0x62, 0x0,
-
-    /* U+0044 "D" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x84, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xcf, 0xff, 0xfd, 0x77,
-    0x78, 0xae, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xfc, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0x40, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xb0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf6, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf8, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x90, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x1, 0x8f, 0xff, 0xff, 0xfa, 0x0, 0xcf,
-    0xff, 0xfd, 0x88, 0x89, 0xcf, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe,
-    0xda, 0x62, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0046 "F" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xfc, 0x77, 0x77, 0x77, 0x77, 0x7c, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc7, 0x77, 0x77,
-    0x77, 0x72, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfc, 0x98, 0x9a, 0xdf, 0xfe, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x2,
-    0x76, 0x0, 0x8, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfe,
-    0x0, 0x0, 0x8, 0x88, 0x89, 0xff, 0xff, 0xf3,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf3, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xb9, 0x89, 0xad, 0xff,
-    0xff, 0xf3, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xff, 0xed, 0xa8, 0x41, 0x0,
-
-    /* U+0048 "H" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfd, 0x88, 0x88, 0x88, 0x88, 0x89, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-
-    /* U+0049 "I" */
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf,
-    0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf,
-    0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf,
-    0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf9, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4,
-    0x9b, 0x99, 0xef, 0xff, 0xff, 0xe0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x7d, 0xff, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x7c, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xa0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf2, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x2, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0xdf, 0xff, 0xff, 0x30, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0xaf, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xce, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x6b, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfe, 0x20, 0x2f, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x8f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x30, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf7, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xb0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x50, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x1c, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf9,
-
-    /* U+004C "L" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xd8, 0x88, 0x88,
-    0x88, 0x88, 0x80, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1,
-
-    /* U+004D "M" */
-    0xcf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb, 0xcf, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xfb,
-    0xcf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff,
-    0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xef, 0xff, 0xfb, 0xcf, 0xff, 0xdc, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x9f,
-    0xff, 0xfb, 0xcf, 0xff, 0xe8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x5f, 0xff, 0xfb,
-    0xcf, 0xff, 0xe3, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x3f, 0xff, 0xfb, 0xcf, 0xff,
-    0xf0, 0xef, 0xff, 0x90, 0x0, 0x0, 0xc, 0xff,
-    0xf7, 0x4f, 0xff, 0xfb, 0xcf, 0xff, 0xf0, 0x9f,
-    0xff, 0xd0, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0x5f,
-    0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x4f, 0xff, 0xf2,
-    0x0, 0x0, 0x6f, 0xff, 0xd0, 0x5f, 0xff, 0xfb,
-    0xcf, 0xff, 0xf1, 0xf, 0xff, 0xf7, 0x0, 0x0,
-    0xcf, 0xff, 0x80, 0x5f, 0xff, 0xfb, 0xcf, 0xff,
-    0xf1, 0xa, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0x20, 0x6f, 0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x6,
-    0xff, 0xff, 0x10, 0x6, 0xff, 0xfd, 0x0, 0x6f,
-    0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x1, 0xff, 0xff,
-    0x60, 0xb, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0xfb,
-    0xcf, 0xff, 0xf1, 0x0, 0xcf, 0xff, 0xb0, 0x1f,
-    0xff, 0xf3, 0x0, 0x6f, 0xff, 0xfb, 0xcf, 0xff,
-    0xf1, 0x0, 0x7f, 0xff, 0xf0, 0x6f, 0xff, 0xd0,
-    0x0, 0x6f, 0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x0,
-    0x2f, 0xff, 0xf5, 0xbf, 0xff, 0x80, 0x0, 0x6f,
-    0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x0, 0xd, 0xff,
-    0xfb, 0xff, 0xff, 0x30, 0x0, 0x6f, 0xff, 0xfb,
-    0xcf, 0xff, 0xf1, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x6f, 0xff, 0xfb, 0xcf, 0xff,
-    0xf1, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x6f, 0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x6f,
-    0xff, 0xfb, 0xcf, 0xff, 0xf1, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x6f, 0xff, 0xfb, 0xcf, 0xff,
-    0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x6f, 0xff, 0xfb,
-
-    /* U+004E "N" */
-    0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xde, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xd6, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xe0, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xe0, 0x4f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0x2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff, 0x40,
-    0x0, 0xdf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x1e, 0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x6, 0xff, 0xff, 0xf6,
-    0x0, 0xcf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xdf, 0xff, 0xfe, 0x10, 0xcf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x90, 0xbf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfb, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xff, 0xeb,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x4f,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xfe, 0x0, 0xb, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf6, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x6f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x9, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x6d, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0xef, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x8e, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0xdf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x36, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfb, 0x0, 0xbf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0x60, 0x4, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x3, 0xdf, 0xff, 0xff, 0xd0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xfc, 0x99, 0xad, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xfd,
-    0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x82, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0xcf, 0xff, 0xfd, 0x77,
-    0x79, 0xdf, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfe, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x1c, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xfd, 0x77,
-    0x8b, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xff, 0xeb,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x4f,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xfe, 0x0, 0xb, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf6, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x6f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x19, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x6d, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0xef, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x8e, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0xdf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x46, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfc, 0x0, 0xbf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0x60, 0x4, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x3, 0xdf, 0xff, 0xff, 0xe0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xfc, 0x99, 0xad, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xe1,
-
-    /* U+0052 "R" */
-    0xcf, 0xff, 0xff, 0xff, 0xfe, 0xda, 0x72, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xcf, 0xff, 0xfd, 0x77, 0x8a, 0xef,
-    0xff, 0xff, 0xf6, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xc0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf7, 0x0, 0xc, 0xff, 0xff, 0xd6, 0x67,
-    0x9e, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x2f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x8f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x60, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf6,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff, 0xfe,
-    0xa8, 0x9b, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x4, 0xab, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf6, 0x23, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf5, 0x5f, 0xc7, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xfd,
-    0xa8, 0x79, 0xdf, 0xff, 0xff, 0xd0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe, 0xc9, 0x40,
-    0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x28, 0x88, 0x88, 0x8a, 0xff, 0xff,
-    0xf9, 0x88, 0x88, 0x88, 0x10, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+0055 "U" */
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xdf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf3, 0x8f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe0,
-    0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x80, 0xd, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x30,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf8, 0x0,
-    0x0, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x7f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x20, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xbf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfb, 0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x10, 0xa, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x50, 0xf, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x90, 0x4f, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xe0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf2, 0xbf, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf6, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xef, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xba, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf7, 0x6f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x31, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xe0, 0xd, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfa, 0x0,
-    0x9f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x60, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xd,
-    0xff, 0xfe, 0xff, 0xfa, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf2, 0x0, 0x1f, 0xff, 0xff, 0x10, 0x0,
-    0x1, 0xff, 0xff, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x4f, 0xff, 0xfe, 0x0, 0x0, 0xdf, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xff, 0xf4, 0xff, 0xff, 0x20,
-    0x0, 0x8, 0xff, 0xff, 0xa0, 0x0, 0x9, 0xff,
-    0xff, 0x90, 0x0, 0x9, 0xff, 0xfd, 0xf, 0xff,
-    0xf6, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0,
-    0x5f, 0xff, 0xfc, 0x0, 0x0, 0xdf, 0xff, 0xa0,
-    0xdf, 0xff, 0xb0, 0x0, 0xf, 0xff, 0xff, 0x20,
-    0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xf6, 0xa, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x6,
-    0xff, 0xff, 0x20, 0x6f, 0xff, 0xf3, 0x0, 0x7f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
-    0x0, 0xaf, 0xff, 0xe0, 0x2, 0xff, 0xff, 0x70,
-    0xa, 0xff, 0xff, 0x60, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xb0, 0xe, 0xff, 0xfa, 0x0, 0xe, 0xff,
-    0xfb, 0x0, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfe, 0x2, 0xff, 0xff, 0x60, 0x0,
-    0xaf, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf2, 0x5f, 0xff, 0xf2,
-    0x0, 0x5, 0xff, 0xff, 0x24, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x58, 0xff,
-    0xfe, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x7f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8,
-    0xbf, 0xff, 0xa0, 0x0, 0x0, 0xdf, 0xff, 0x8b,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xae, 0xff, 0xf6, 0x0, 0x0, 0x9, 0xff,
-    0xfb, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfe, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x5f, 0xff, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf1, 0x0, 0x8f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xc0, 0x0, 0xa, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x60, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x10, 0xdf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x6f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xfa, 0xef, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfe, 0x16, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x60, 0xc,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xc0, 0x0, 0x2f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf5, 0x0, 0x1f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xe1,
-    0xa, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xa0,
-
-    /* U+0059 "Y" */
-    0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x33, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xa0, 0xa,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf2, 0x0, 0x2f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x10, 0x0, 0x1, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf3, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x3, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x30, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x3f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x6, 0x77, 0x77, 0x77, 0x77, 0x77, 0x8f, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x87, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+005B "[" */
-    0x7f, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xfb, 0xbb, 0xb0, 0x7f, 0xff, 0xf1, 0x0,
-    0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f,
-    0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0,
-    0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f,
-    0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0,
-    0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x7f,
-    0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xf0, 0x5b, 0xbb, 0xbb, 0xbb, 0xb0,
-
-    /* U+005C "\\" */
-    0x9f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf7,
-
-    /* U+005D "]" */
-    0x1f, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xff, 0xf6, 0x1b,
-    0xbb, 0xcf, 0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff,
-    0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f,
-    0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff,
-    0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f,
-    0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff,
-    0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x3f,
-    0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x3f, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xff, 0xff, 0xf6, 0x1b, 0xbb, 0xbb, 0xbb, 0xb4,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0xcf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x4f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xb0, 0xc, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x4,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfd,
-    0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x9,
-    0xff, 0xf6, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0xb, 0xff,
-    0xf6, 0x0, 0x0, 0x8f, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x70, 0x7, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf8,
-
-    /* U+005F "_" */
-    0x7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0060 "`" */
-    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x3e, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x1c, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf7,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x26, 0xad, 0xff, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x5,
-    0xfd, 0x73, 0x0, 0x17, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf0, 0x0, 0x1, 0x6a, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0x83, 0x0, 0x4, 0xff,
-    0xff, 0xf0, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x5, 0xff,
-    0xff, 0xfa, 0x10, 0x4, 0xdf, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xaf, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xfa, 0x3, 0xff, 0xff, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0xa4, 0x0, 0xe, 0xff, 0xf0,
-
-    /* U+0062 "b" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x4a, 0xef, 0xfc, 0x70, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x85, 0x5a, 0xff, 0xff, 0xff, 0x40,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xd0, 0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x90, 0x3f, 0xff, 0xff, 0xff,
-    0x95, 0x5a, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x3f, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xfd, 0x20, 0x0, 0x3f, 0xff, 0xf2, 0x1,
-    0x8d, 0xff, 0xfc, 0x60, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xa6, 0x56,
-    0xaf, 0xf2, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x4, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x49, 0x0,
-    0x6f, 0xff, 0xff, 0xfb, 0x65, 0x69, 0xdf, 0xc0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x49, 0xcf, 0xff, 0xec,
-    0x93, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf0, 0x0, 0x1, 0x8d, 0xff, 0xea,
-    0x30, 0x5f, 0xff, 0xff, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0x93, 0xff, 0xff, 0xf0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xf9, 0x56, 0x9f, 0xff,
-    0xff, 0xff, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0xdf, 0xff, 0xff, 0x30, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0x84, 0x47, 0xef,
-    0xff, 0xff, 0xf0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xf0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xf7, 0xa, 0xff, 0xff, 0x0,
-    0x0, 0x18, 0xdf, 0xfe, 0x93, 0x0, 0x5f, 0xff,
-    0xf0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xdd, 0xff, 0xff, 0xff, 0x60, 0x3, 0xff,
-    0xff, 0xf9, 0x10, 0x1, 0xaf, 0xff, 0xfe, 0x0,
-    0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf5, 0xf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x82, 0xff, 0xff, 0xfa, 0x99, 0x99,
-    0x99, 0xbf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x14, 0x0, 0x2f,
-    0xff, 0xff, 0xf8, 0x20, 0x1, 0x36, 0xbf, 0x90,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfe, 0xda, 0x61, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xeb, 0x82,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x54, 0x57, 0x30,
-    0x0, 0x5, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f,
-    0xff, 0xfe, 0x74, 0x5d, 0xff, 0xff, 0xfb, 0x73,
-    0x1, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xef, 0xff,
-    0xf2, 0x0, 0x4, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x9f, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x6, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0,
-    0x4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xf8, 0x0, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x1,
-    0xef, 0xff, 0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x74, 0x5d, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xfd,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf8, 0x55, 0x55, 0x54, 0x30, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb3, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x6, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xfe, 0x51, 0x0, 0x0, 0x14, 0xdf,
-    0xff, 0xfa, 0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfa, 0xdf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf9, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6,
-    0xbf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x18, 0xff,
-    0xff, 0xf1, 0x6f, 0xff, 0xff, 0xe9, 0x88, 0x9c,
-    0xff, 0xff, 0xff, 0x60, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
-    0x0, 0x2, 0x8b, 0xef, 0xff, 0xed, 0xa7, 0x20,
-    0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x3, 0xae,
-    0xff, 0xda, 0x40, 0x0, 0x3f, 0xff, 0xff, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x43, 0xff, 0xff, 0xff, 0xfa, 0x54, 0x7e, 0xff,
-    0xff, 0xf9, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf0,
-
-    /* U+0069 "i" */
-    0x7, 0xef, 0xe7, 0x3, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0x64, 0xff, 0xff, 0xf4, 0xa, 0xff,
-    0xfa, 0x0, 0x1, 0x31, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x7e, 0xfe, 0x70, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf1, 0x27, 0x55, 0x9f, 0xff, 0xff, 0xe0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x4f, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x4f, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x2b, 0xef, 0xfe, 0xc7, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x70, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x90,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x6f, 0xff,
-    0xff, 0xb0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x3f, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf1, 0x2e, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x1d, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x6, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x1e, 0xff, 0xff, 0xe1,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x30, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x10,
-
-    /* U+006C "l" */
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20,
-
-    /* U+006D "m" */
-    0x3f, 0xff, 0xf0, 0x0, 0x5b, 0xef, 0xfd, 0x92,
-    0x0, 0x0, 0x4a, 0xef, 0xfe, 0xa4, 0x0, 0x3,
-    0xff, 0xff, 0x41, 0xcf, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x3f,
-    0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0x95, 0x5a, 0xff, 0xff, 0xff, 0xff,
-    0xb5, 0x48, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x9, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x5, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x60, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xa3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x60, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xa3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfa, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xa3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfa,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xb, 0xff, 0xff, 0xa3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfa, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xb, 0xff, 0xff, 0xa3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfa,
-
-    /* U+006E "n" */
-    0x3f, 0xff, 0xf0, 0x0, 0x5a, 0xef, 0xfe, 0xa4,
-    0x0, 0x3, 0xff, 0xff, 0x41, 0xcf, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x3f, 0xff, 0xfa, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff,
-    0xff, 0xff, 0xa5, 0x47, 0xef, 0xff, 0xff, 0xa3,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x95, 0x58, 0xef, 0xff,
-    0xff, 0x60, 0xa, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf9, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x2f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf7, 0xe, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff,
-    0xff, 0xff, 0x95, 0x57, 0xef, 0xff, 0xff, 0x70,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x3f, 0xff, 0xf4, 0x0, 0x4a, 0xef, 0xfc, 0x70,
-    0x0, 0x0, 0x3f, 0xff, 0xf9, 0x9, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x3f, 0xff, 0xfd, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x85, 0x59, 0xff, 0xff,
-    0xff, 0x40, 0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x90, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x3f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1,
-    0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x90, 0x3f, 0xff,
-    0xff, 0xff, 0x96, 0x5a, 0xff, 0xff, 0xff, 0x30,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x3f, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x3f, 0xff, 0xff, 0x1b,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x5b, 0xef, 0xfc, 0x60, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x18, 0xdf, 0xfe, 0xa4, 0x0, 0xaf,
-    0xff, 0xf0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfa,
-    0xc, 0xff, 0xff, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xf0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0xff,
-    0xff, 0xff, 0x95, 0x69, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0x40, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xd, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xe7, 0x33, 0x6d, 0xff, 0xff, 0xff,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xf0, 0x0, 0x1, 0x8d,
-    0xff, 0xea, 0x20, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf0,
-
-    /* U+0072 "r" */
-    0x3f, 0xff, 0xf0, 0x0, 0x18, 0xdf, 0xf8, 0x3f,
-    0xff, 0xf3, 0x5, 0xff, 0xff, 0xf7, 0x3f, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xb4,
-    0x10, 0x10, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x38, 0xef, 0x10,
-    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x4f, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x23, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x5f, 0xd8, 0x41, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x2, 0x7b, 0xdf, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x42, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc5, 0x46, 0x96, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x7,
-    0xce, 0xff, 0xdb, 0x71,
-
-    /* U+0075 "u" */
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xd0, 0xff,
-    0xff, 0xff, 0xb5, 0x46, 0xcf, 0xff, 0xff, 0xfd,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9e, 0xff, 0xfd, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xaf, 0xff, 0xd0, 0x0, 0x7, 0xce,
-    0xff, 0xd9, 0x30, 0x6, 0xff, 0xfd,
-
-    /* U+0076 "v" */
-    0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x47, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf8, 0x0,
-    0xbf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x5, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xc0, 0x0, 0xe, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0xef, 0xff, 0xf6, 0x0, 0x0,
-    0x9f, 0xff, 0xfc, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x0, 0x9,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x70, 0x0, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfc, 0x0, 0x4f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf1, 0x9, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x70, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xfb, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xe7, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x8f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xe, 0xff, 0xff, 0x53,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0xe,
-    0xff, 0xff, 0x50, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0xaf,
-    0xff, 0xf9, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0x70, 0x6, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xfb, 0xff, 0xf7,
-    0x0, 0x0, 0xff, 0xff, 0xf3, 0x0, 0x1f, 0xff,
-    0xff, 0x10, 0x0, 0xef, 0xff, 0x4f, 0xff, 0xb0,
-    0x0, 0x4f, 0xff, 0xfe, 0x0, 0x0, 0xdf, 0xff,
-    0xf5, 0x0, 0x2f, 0xff, 0xc0, 0xff, 0xff, 0x0,
-    0x8, 0xff, 0xff, 0xa0, 0x0, 0x8, 0xff, 0xff,
-    0xa0, 0x6, 0xff, 0xf8, 0xc, 0xff, 0xf3, 0x0,
-    0xcf, 0xff, 0xf5, 0x0, 0x0, 0x4f, 0xff, 0xfe,
-    0x0, 0xaf, 0xff, 0x50, 0x8f, 0xff, 0x70, 0xf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xff, 0xff, 0xf1,
-    0xe, 0xff, 0xf1, 0x5, 0xff, 0xfa, 0x4, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x41,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xe0, 0x8f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf7, 0x4f,
-    0xff, 0xa0, 0x0, 0xef, 0xff, 0x1b, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xa7, 0xff,
-    0xf6, 0x0, 0xa, 0xff, 0xf3, 0xef, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfc, 0x9f, 0xff,
-    0x30, 0x0, 0x7f, 0xff, 0x6f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xeb, 0xff, 0xf0,
-    0x0, 0x3, 0xff, 0xfa, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xef, 0xfb, 0x0,
-    0x0, 0xf, 0xff, 0xef, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x10, 0x8f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0xdf, 0xff,
-    0xff, 0x20, 0x0, 0x4f, 0xff, 0xff, 0xb0, 0x0,
-    0x3, 0xff, 0xff, 0xfa, 0x0, 0xd, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf4, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xd2, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xef, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfe, 0x10, 0x3f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x60, 0x0, 0x9f, 0xff,
-    0xff, 0x50, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xef, 0xff, 0xfe, 0x10, 0xd, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfa, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf5,
-
-    /* U+0079 "y" */
-    0xcf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x46, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x0,
-    0xaf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x30, 0x4, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xd0, 0x0, 0xd, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x10, 0x0, 0x1, 0xff, 0xff, 0xf5, 0x0, 0xa,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xa0, 0x0, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x0, 0x4f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0xa, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x90, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf8, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x55, 0x7e, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xef,
-    0xfd, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+007A "z" */
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x11, 0x11, 0x11, 0x15, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xa1, 0x11, 0x11, 0x11, 0x10,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0xe, 0xff, 0xff, 0x81,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfa, 0x0, 0x1, 0x36, 0xbf, 0xff,
-    0xff, 0x50, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x7, 0xff, 0xff, 0xe9, 0x30, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xd7, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x28, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x71, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xad,
-    0xef, 0xc0,
-
-    /* U+007C "|" */
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-
-    /* U+007D "}" */
-    0x9f, 0xed, 0xa6, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0x6f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xc6, 0x42, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x28, 0xdf, 0xff, 0xfa,
-    0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xa0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x4, 0xff,
-    0xff, 0xf9, 0x31, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x9f, 0xed, 0xa6, 0x0, 0x0,
-    0x0, 0x0,
-
     /* U+007E "~" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x7c, 0xff, 0xeb, 0x60, 0x0, 0x0,
@@ -2788,8741 +476,39 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x81, 0x0,
     0x16, 0xcf, 0xff, 0xff, 0xff, 0xf8, 0x53, 0x0,
     0x0, 0x0, 0x3, 0x8c, 0xff, 0xeb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00A0 " " */
-
-    /* U+00A1 "¡" */
-    0x9, 0xef, 0xb2, 0x9, 0xff, 0xff, 0xe0, 0xef,
-    0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2, 0xaf, 0xff,
-    0xfe, 0x0, 0x9e, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x40, 0x2f, 0xff, 0xf5, 0x2, 0xff,
-    0xff, 0x60, 0x3f, 0xff, 0xf6, 0x4, 0xff, 0xff,
-    0x70, 0x5f, 0xff, 0xf8, 0x6, 0xff, 0xff, 0x90,
-    0x7f, 0xff, 0xfa, 0x7, 0xff, 0xff, 0xb0, 0x8f,
-    0xff, 0xfb, 0x9, 0xff, 0xff, 0xc0, 0xaf, 0xff,
-    0xfd, 0xb, 0xff, 0xff, 0xe0, 0xcf, 0xff, 0xff,
-    0xc, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xff, 0xe,
-    0xff, 0xff, 0xf1, 0x12, 0x22, 0x22, 0x0,
-
-    /* U+00A2 "¢" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xff, 0xff,
-    0xea, 0x40, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x8f, 0xff, 0xff, 0xe6,
-    0x11, 0x36, 0xce, 0x0, 0xe, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x2,
-    0x50, 0x7, 0xff, 0xff, 0xff, 0xa6, 0x56, 0x8d,
-    0xfb, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x4, 0x9d, 0xff,
-    0xff, 0xea, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x0, 0x0, 0x0,
-
-    /* U+00A3 "£" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa7,
-    0x20, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x96, 0x68, 0xcf, 0xe0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x24,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x6d, 0xde, 0xff,
-    0xff, 0xfd, 0xdd, 0xdd, 0xd6, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xfd, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x97, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+00A4 "¤" */
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xcb, 0x0, 0x4, 0xff, 0xf6, 0x6b, 0xff, 0xe9,
-    0x3c, 0xff, 0xc0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xe, 0xff,
-    0xff, 0xba, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x3f,
-    0xff, 0xe3, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0,
-    0x8f, 0xff, 0x50, 0x0, 0x0, 0xbf, 0xff, 0x10,
-    0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x30, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x30, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0xbf, 0xff, 0x10, 0x0, 0x3f, 0xff, 0xe2, 0x0,
-    0x8, 0xff, 0xfc, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xba, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3,
-    0xff, 0xf6, 0x7c, 0xff, 0xd9, 0x4c, 0xff, 0xb0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x1, 0xcb,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0,
-
-    /* U+00A5 "¥" */
-    0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x22, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xa0, 0x9, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x2f, 0xff, 0xff, 0x30, 0x0, 0x0, 0xaf, 0xff,
-    0xf9, 0x0, 0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x10, 0x0, 0x1, 0xff, 0xff,
-    0xf1, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x70, 0x0, 0xef, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x6f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf5, 0xd, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xdf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x1, 0x22, 0x25, 0xff, 0xff, 0xc2, 0x22,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x1, 0x22, 0x25, 0xff, 0xff, 0xd2, 0x22, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+00A6 "¦" */
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0x55, 0x54, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x55, 0x54, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-
-    /* U+00A7 "§" */
-    0x0, 0x0, 0x6b, 0xef, 0xff, 0xd9, 0x50, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xaf,
-    0xff, 0xf9, 0x65, 0x7b, 0xff, 0xb0, 0xd, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0x74, 0x0, 0xdf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf9, 0x20, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x2, 0xff, 0xff, 0x7a, 0xff,
-    0xff, 0xfa, 0x0, 0xaf, 0xff, 0x50, 0x1, 0xaf,
-    0xff, 0xf4, 0xd, 0xff, 0xf1, 0x0, 0x0, 0xaf,
-    0xff, 0xa0, 0xdf, 0xff, 0x40, 0x0, 0x4, 0xff,
-    0xfb, 0xa, 0xff, 0xfe, 0x20, 0x0, 0x5f, 0xff,
-    0xa0, 0x3f, 0xff, 0xff, 0x91, 0xd, 0xff, 0xf6,
-    0x0, 0x6f, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0x0,
-    0x0, 0x3c, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x4, 0xbf, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x29, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfb, 0x2a, 0x40, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xa2, 0xff, 0xea, 0x75,
-    0x46, 0xcf, 0xff, 0xf5, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x49, 0xce, 0xff, 0xec,
-    0x82, 0x0, 0x0,
-
-    /* U+00A8 "¨" */
-    0x1, 0x9a, 0x70, 0x0, 0x18, 0xa8, 0x0, 0xdf,
-    0xff, 0x80, 0xc, 0xff, 0xfb, 0x1f, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xa0, 0xe,
-    0xff, 0xfd, 0x4, 0xdf, 0xb2, 0x0, 0x3d, 0xfc,
-    0x30,
-
-    /* U+00A9 "©" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xdf, 0xff, 0xff, 0xfd, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe, 0x84,
-    0x10, 0x1, 0x49, 0xef, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xd1, 0x0, 0x0, 0x47, 0x88, 0x51, 0x0,
-    0x3e, 0xff, 0x40, 0x0, 0x0, 0x1e, 0xfd, 0x10,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xff,
-    0xe1, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x5f, 0xf9, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x6f, 0xff, 0x92, 0x1,
-    0x5b, 0x30, 0x0, 0xb, 0xff, 0x20, 0x8, 0xff,
-    0x10, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0xc, 0xfb, 0x0, 0x5,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xc0, 0xf, 0xf7, 0x0, 0x9, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0,
-    0x2f, 0xf4, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x3f, 0xf3,
-    0x0, 0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0x3f, 0xf3, 0x0, 0xc,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x2f, 0xf5, 0x0, 0xa, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0xf, 0xf8, 0x0, 0x7, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0xc, 0xfc,
-    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xc0, 0x7, 0xff, 0x20, 0x0,
-    0xcf, 0xfb, 0x0, 0x0, 0x0, 0x10, 0x0, 0x4,
-    0xff, 0x70, 0x1, 0xff, 0x90, 0x0, 0x2f, 0xff,
-    0xea, 0x89, 0xcf, 0x70, 0x0, 0xc, 0xff, 0x10,
-    0x0, 0x9f, 0xf4, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0x1e,
-    0xfe, 0x20, 0x0, 0x17, 0xcf, 0xff, 0xc7, 0x10,
-    0x5, 0xff, 0xe1, 0x0, 0x0, 0x4, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x4c, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xc8, 0x65, 0x56,
-    0x9d, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9c, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+00AA "ª" */
-    0x0, 0x1, 0x69, 0xbb, 0xa6, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x9, 0xa5, 0x10, 0x2c,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x30, 0x1, 0x8c, 0xef, 0xff, 0xff, 0xf3, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xef, 0xff,
-    0x52, 0x15, 0xff, 0xf3, 0x2f, 0xff, 0x80, 0x0,
-    0x6f, 0xff, 0x32, 0xff, 0xf8, 0x0, 0xd, 0xff,
-    0xf3, 0xe, 0xff, 0xf7, 0x8d, 0xff, 0xff, 0x30,
-    0x7f, 0xff, 0xff, 0xfd, 0xaf, 0xf3, 0x0, 0x5c,
-    0xff, 0xd7, 0x4, 0xff, 0x30,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x30, 0x0,
-    0x0, 0x9, 0xb2, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfa, 0x20, 0x0, 0x6f, 0xff, 0x91, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x70, 0x4, 0xff, 0xff, 0xf5,
-    0x0, 0x1, 0xdf, 0xff, 0xfa, 0x0, 0x2e, 0xff,
-    0xff, 0x80, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x0,
-    0xdf, 0xff, 0xfb, 0x0, 0x0, 0x9f, 0xff, 0xfe,
-    0x10, 0xa, 0xff, 0xff, 0xd1, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x0, 0x7f, 0xff, 0xff, 0x20, 0x0,
-    0x3f, 0xff, 0xff, 0x60, 0x4, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x30, 0x8, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe1,
-    0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfc, 0x0, 0x1d, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0x90, 0x2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf6, 0x0,
-    0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x30, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x8, 0xff, 0xfe, 0x50, 0x0, 0xaf, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0xc,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0,
-    0x0, 0x1, 0x10, 0x0,
-
-    /* U+00AC "¬" */
-    0x6d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x68, 0x88,
-
-    /* U+00AD "­" */
-    0x56, 0x66, 0x66, 0x66, 0x63, 0xef, 0xff, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xf8, 0xef,
-    0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff,
-    0xf8,
-
-    /* U+00AE "®" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xdf, 0xff, 0xff, 0xfd, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe, 0x84,
-    0x10, 0x1, 0x49, 0xef, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0x40, 0x0, 0x0, 0x1e, 0xfd, 0x10,
-    0x2f, 0xff, 0xff, 0xfd, 0x92, 0x0, 0x3, 0xff,
-    0xe1, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x5f, 0xf9, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x2f, 0xfe, 0x77, 0x8d,
-    0xff, 0xe0, 0x0, 0xb, 0xff, 0x20, 0x8, 0xff,
-    0x10, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0xdf, 0xf3,
-    0x0, 0x3, 0xff, 0x80, 0xc, 0xfb, 0x0, 0x0,
-    0x2f, 0xfc, 0x0, 0x0, 0xaf, 0xf5, 0x0, 0x0,
-    0xdf, 0xc0, 0xf, 0xf7, 0x0, 0x0, 0x2f, 0xfc,
-    0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x9f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x18,
-    0xff, 0xd0, 0x0, 0x0, 0x6f, 0xf2, 0x3f, 0xf3,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x5f, 0xf3, 0x3f, 0xf3, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x2f, 0xf5, 0x0, 0x0, 0x2f, 0xfd,
-    0x66, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0xf, 0xf8, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0xc, 0xfc,
-    0x0, 0x0, 0x2f, 0xfc, 0x0, 0xd, 0xff, 0x40,
-    0x0, 0x0, 0xef, 0xc0, 0x7, 0xff, 0x20, 0x0,
-    0x2f, 0xfc, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x4,
-    0xff, 0x70, 0x1, 0xff, 0x90, 0x0, 0x2f, 0xfc,
-    0x0, 0x0, 0xbf, 0xf7, 0x0, 0xc, 0xff, 0x10,
-    0x0, 0x9f, 0xf4, 0x0, 0x2f, 0xfc, 0x0, 0x0,
-    0x2f, 0xff, 0x10, 0x7f, 0xf9, 0x0, 0x0, 0x1e,
-    0xfe, 0x20, 0x19, 0x97, 0x0, 0x0, 0x7, 0x99,
-    0x55, 0xff, 0xe1, 0x0, 0x0, 0x4, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x4c, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xc8, 0x65, 0x56,
-    0x9d, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9c, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+00AF "¯" */
-    0x8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-
-    /* U+00B0 "°" */
-    0x0, 0x3, 0xae, 0xff, 0xc7, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x1, 0xff, 0xff, 0x95, 0x6d,
-    0xff, 0xf7, 0x6f, 0xff, 0x60, 0x0, 0x1e, 0xff,
-    0xc9, 0xff, 0xf0, 0x0, 0x0, 0xaf, 0xff, 0x9f,
-    0xff, 0x0, 0x0, 0x9, 0xff, 0xf6, 0xff, 0xf6,
-    0x0, 0x1, 0xef, 0xfc, 0x1f, 0xff, 0xf9, 0x57,
-    0xef, 0xff, 0x70, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x4a, 0xef, 0xfc, 0x70, 0x0,
-
-    /* U+00B1 "±" */
-    0x0, 0x0, 0x0, 0x4, 0x77, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x6d,
-    0xdd, 0xdd, 0xdf, 0xff, 0xfe, 0xdd, 0xdd, 0xdd,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+00B2 "²" */
-    0x0, 0x6, 0xbe, 0xff, 0xc7, 0x0, 0x0, 0x4e,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x2f, 0xfd, 0x76, 0xdf,
-    0xff, 0xd0, 0x0, 0x46, 0x0, 0x5, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xfb, 0x88, 0x88, 0x82, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50,
-
-    /* U+00B3 "³" */
-    0x1, 0x7c, 0xef, 0xfc, 0x70, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x7, 0x94, 0x10, 0x6f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x60, 0x0, 0x7c,
-    0xce, 0xff, 0xf8, 0x0, 0x0, 0x9f, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x1, 0x8f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf1, 0x60, 0x0, 0x0, 0xc,
-    0xff, 0xf3, 0xfd, 0x61, 0x0, 0x6f, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xef, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x16, 0xbe, 0xff, 0xeb,
-    0x60, 0x0,
-
-    /* U+00B4 "´" */
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x6f,
-    0xff, 0xff, 0x60, 0x0, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x1e, 0xff, 0xfe, 0x30, 0x0, 0xb, 0xff,
-    0xfd, 0x20, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0,
-    0x0,
-
-    /* U+00B5 "µ" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xc5, 0x46, 0xcf, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xac, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xd1, 0x8f, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x9e, 0xfe, 0x91, 0x3, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+00B6 "¶" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x88, 0xaf, 0xf8,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x5f, 0xf8, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x5f, 0xf8, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x5f, 0xf8, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x5f, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x5f, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x5f, 0xf8, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x5f, 0xf8, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x5f, 0xf8,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x5f, 0xf8, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x5f, 0xf8, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x5f, 0xf8,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x17, 0xbd, 0xed, 0xbf,
-    0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+00B7 "·" */
-    0x9, 0xef, 0xb2, 0xa, 0xff, 0xff, 0xe0, 0xef,
-    0xff, 0xff, 0x2e, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xfe, 0x0, 0x9e, 0xfb, 0x20,
-
-    /* U+00B8 "¸" */
-    0x0, 0x48, 0x86, 0x0, 0x0, 0xe, 0xff, 0xb1,
-    0x0, 0x7, 0xff, 0xff, 0xe4, 0x0, 0x26, 0xdf,
-    0xff, 0xf1, 0x0, 0x1, 0xff, 0xff, 0x52, 0x10,
-    0x1f, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0x1a,
-    0xff, 0xff, 0xff, 0x80, 0x7e, 0xff, 0xeb, 0x50,
-    0x0,
-
-    /* U+00B9 "¹" */
-    0x0, 0x0, 0x1b, 0xff, 0xf4, 0x0, 0x3, 0xdf,
-    0xff, 0xf4, 0x0, 0x6f, 0xff, 0xff, 0xf4, 0xa,
-    0xff, 0xff, 0xff, 0xf4, 0x1e, 0xff, 0x9d, 0xff,
-    0xf4, 0x2, 0xe7, 0xe, 0xff, 0xf4, 0x0, 0x0,
-    0xe, 0xff, 0xf4, 0x0, 0x0, 0xe, 0xff, 0xf4,
-    0x0, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0, 0xe,
-    0xff, 0xf4, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0x0, 0x0, 0xe, 0xff,
-    0xf4, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0,
-    0xe, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
 
-    /* U+00BA "º" */
-    0x0, 0x7, 0xbd, 0xdb, 0x60, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xfc, 0x10, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0x81, 0x19, 0xff, 0xf5,
-    0xcf, 0xfe, 0x0, 0x0, 0xef, 0xfb, 0xff, 0xfa,
-    0x0, 0x0, 0xbf, 0xfe, 0xff, 0xf9, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xfe,
-    0xcf, 0xfd, 0x0, 0x0, 0xef, 0xfb, 0x7f, 0xff,
-    0x60, 0x7, 0xff, 0xf7, 0xe, 0xff, 0xfe, 0xef,
-    0xff, 0xe0, 0x3, 0xef, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0x18, 0xdf, 0xfd, 0x81, 0x0,
 
-    /* U+00BB "»" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xb0, 0x0, 0x0, 0x2,
-    0xba, 0x0, 0x0, 0x0, 0x18, 0xff, 0xf9, 0x0,
-    0x1, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x60, 0x4, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf3, 0x0, 0x7f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x9f, 0xff, 0xfe, 0x10, 0xa,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xc0, 0x0, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xfa, 0x0, 0x2f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x70, 0x4, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xa0,
-    0x2, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xbf, 0xff,
-    0xfd, 0x10, 0xd, 0xff, 0xff, 0xc0, 0x0, 0x9,
-    0xff, 0xff, 0xf2, 0x0, 0xaf, 0xff, 0xfe, 0x10,
-    0x0, 0x5f, 0xff, 0xff, 0x40, 0x7, 0xff, 0xff,
-    0xf3, 0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x4f,
-    0xff, 0xff, 0x50, 0x0, 0x1e, 0xff, 0xff, 0xa0,
-    0x1, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x3d, 0xff,
-    0xfc, 0x0, 0x4, 0xdf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x6e, 0xe1, 0x0, 0x0, 0x6, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x0,
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
 
-    /* U+00BC "¼" */
-    0x0, 0x0, 0x1, 0x56, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x66, 0x65, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x5a, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x73, 0xb, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x9,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x2f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf7, 0x0, 0x0, 0xaf, 0xff, 0x80,
-    0x0, 0x7, 0x88, 0x82, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf7, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf7, 0x0, 0xc, 0xff, 0xf6, 0x0, 0x3, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
-    0x0, 0x5f, 0xff, 0xd0, 0x0, 0xd, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
-    0xef, 0xff, 0x40, 0x0, 0x8f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x7, 0xff,
-    0xfb, 0x0, 0x3, 0xff, 0xcc, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2,
-    0x0, 0xe, 0xff, 0x4c, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x0,
-    0x9f, 0xf9, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x4, 0xff,
-    0xc0, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf7, 0x0, 0x1e, 0xff, 0x20,
-    0xd, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xe0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x50, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf5, 0x0,
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 150, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 519, .box_w = 31, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 403, .adv_w = 329, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 565, .adv_w = 164, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 601, .adv_w = 185, .box_w = 10, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 626, .adv_w = 164, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 647, .adv_w = 238, .box_w = 15, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 842, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1089, .adv_w = 329, .box_w = 13, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1258, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1505, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1752, .adv_w = 329, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2012, .adv_w = 329, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2246, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2493, .adv_w = 329, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2753, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3000, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3247, .adv_w = 329, .box_w = 18, .box_h = 8, .ofs_x = 1, .ofs_y = 9}
+};
 
-    /* U+00BD "½" */
-    0x0, 0x0, 0x1, 0x56, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x66, 0x65, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfc, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe3,
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51, 0xb,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x70, 0x0, 0x0, 0x1e, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf7, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x70, 0x0, 0x2, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7,
-    0x0, 0x0, 0xaf, 0xff, 0x80, 0x17, 0xce, 0xff,
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70,
-    0x0, 0x3f, 0xff, 0xe0, 0x6f, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
-    0xc, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x5,
-    0xff, 0xfd, 0x0, 0x7f, 0xfd, 0x77, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0xef,
-    0xff, 0x40, 0x0, 0xca, 0x0, 0x8, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x7f, 0xff,
-    0xb0, 0x0, 0x1, 0x0, 0x0, 0x9f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xa8, 0x88, 0x88, 0x10, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2,
-
-    /* U+00BE "¾" */
-    0x0, 0x39, 0xdf, 0xfe, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0xaa, 0x10, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x30,
-    0x2d, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x9,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xc0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xdd, 0xff, 0xfb, 0x10,
-    0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x6,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xf4, 0x0, 0xe, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfa, 0x0, 0x8f, 0xff, 0xb0,
-    0x0, 0x38, 0x88, 0x70, 0x0, 0x31, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x1, 0xff, 0xff, 0x20, 0x0,
-    0xef, 0xff, 0xe0, 0x0, 0x6f, 0x93, 0x0, 0x2c,
-    0xff, 0xf9, 0xa, 0xff, 0xf9, 0x0, 0x9, 0xff,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x3f, 0xff, 0xf1, 0x0, 0x5f, 0xff, 0xff,
-    0xe0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0xbf, 0xff, 0x70, 0x1, 0xef, 0xef, 0xff, 0xe0,
-    0x0, 0x3, 0x9d, 0xff, 0xfd, 0x93, 0x4, 0xff,
-    0xfe, 0x0, 0xa, 0xff, 0x7f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf5,
-    0x0, 0x6f, 0xfb, 0x4f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd0, 0x2,
-    0xff, 0xe1, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x40, 0xb, 0xff,
-    0x50, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfb, 0x0, 0x7f, 0xfa, 0x0,
-    0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x90, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe0, 0x0,
-
-    /* U+00BF "¿" */
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xea, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x54, 0x0, 0xd, 0xff, 0xff,
-    0xd4, 0x0, 0x14, 0x8e, 0xfd, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xff, 0xea,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x14, 0x55, 0x32,
-    0x0, 0x0, 0x0,
-
-    /* U+00C0 "À" */
-    0x0, 0x0, 0x3, 0x88, 0x88, 0x85, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0,
-    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfa,
-
-    /* U+00C1 "Á" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x88,
-    0x88, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0,
-    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfa,
-
-    /* U+00C2 "Â" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x88, 0x88, 0x86,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xd4, 0xef, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xa0,
-    0x1, 0xbf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xfe, 0x40, 0x0, 0x0, 0x6e, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0,
-    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfa,
-
-    /* U+00C3 "Ã" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0,
-    0x3, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe7, 0x10, 0x4, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xa9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xb5, 0x7d,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xe0, 0x0, 0x5, 0xbf, 0xfb, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0,
-    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfa,
-
-    /* U+00C4 "Ä" */
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x70, 0x0, 0x9f,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x6f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4, 0x8,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xa9, 0x20,
-    0x0, 0x5a, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x4f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0xef, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf7, 0x9, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0x30, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf9, 0x0, 0xb, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40, 0x0,
-    0x6f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x7f, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfa,
-    0x99, 0x99, 0x9a, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x6, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf4, 0x0, 0xcf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x90, 0x2f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf5,
-    0xdf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xa0,
-
-    /* U+00C5 "Å" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x75, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x30, 0x6f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x30, 0x6f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf3,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0xbf,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa,
-
-    /* U+00C6 "Æ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xb7, 0x8f, 0xff, 0xff, 0x97, 0x77, 0x77,
-    0x77, 0x77, 0x10, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf2, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x50, 0x3, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x20, 0x0, 0x3f, 0xff, 0xff,
-    0x97, 0x77, 0x77, 0x77, 0x73, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xb0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfa, 0x99, 0x99, 0x9a,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfa, 0x88, 0x88,
-    0x88, 0x88, 0x81, 0x7, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0xef, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x5f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+00C7 "Ç" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xb9, 0x8a, 0xef,
-    0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x3, 0x9f, 0x30, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x27, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xbe, 0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff,
-    0xff, 0xda, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x20, 0x1d, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-
-    /* U+00C8 "È" */
-    0x7, 0x88, 0x88, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+00C9 "É" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x88, 0x88, 0x50,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+00CA "Ê" */
-    0x0, 0x0, 0x38, 0x88, 0x88, 0x81, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xbf, 0xff, 0xf5, 0xaf, 0xff, 0xf8, 0x0,
-    0xb, 0xff, 0xfd, 0x30, 0x6, 0xff, 0xff, 0x70,
-    0x9f, 0xff, 0x90, 0x0, 0x0, 0x2b, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+00CB "Ë" */
-    0x0, 0x6e, 0xfb, 0x10, 0x5, 0xdf, 0xc2, 0x0,
-    0x1, 0xff, 0xff, 0x90, 0xf, 0xff, 0xfb, 0x0,
-    0x2, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xfd, 0x0,
-    0x0, 0xef, 0xff, 0x70, 0xd, 0xff, 0xf9, 0x0,
-    0x0, 0x29, 0xa6, 0x0, 0x1, 0x9a, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+00CC "Ì" */
-    0x48, 0x88, 0x88, 0x40, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0xaf, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb,
-
-    /* U+00CD "Í" */
-    0x0, 0x0, 0x58, 0x88, 0x88, 0x40, 0x0, 0x3f,
-    0xff, 0xff, 0xc1, 0x0, 0x1e, 0xff, 0xff, 0x90,
-    0x0, 0xc, 0xff, 0xff, 0x60, 0x0, 0xa, 0xff,
-    0xfd, 0x30, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0,
-
-    /* U+00CE "Î" */
-    0x0, 0x0, 0x28, 0x88, 0x88, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xaf, 0xff, 0xf7, 0x8f, 0xff, 0xf9, 0x0,
-    0x9, 0xff, 0xfe, 0x40, 0x5, 0xff, 0xff, 0x90,
-    0x8f, 0xff, 0xa1, 0x0, 0x0, 0x1a, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-
-    /* U+00CF "Ï" */
-    0x4, 0xdf, 0xc2, 0x0, 0x3d, 0xfd, 0x30, 0xef,
-    0xff, 0xb0, 0xd, 0xff, 0xfd, 0xf, 0xff, 0xfd,
-    0x0, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0x90, 0xb,
-    0xff, 0xfb, 0x1, 0x8a, 0x70, 0x0, 0x18, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-
-    /* U+00D0 "Ð" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xff, 0xd7, 0x77,
-    0x8a, 0xef, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xb0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x71, 0x77, 0xdf, 0xff, 0xfd,
-    0x77, 0x76, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x89, 0xcf, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x62, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00D1 "Ñ" */
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xc6, 0x10, 0x0,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfb, 0x9d, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x9a, 0xef, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x5, 0xbf, 0xfc,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xde, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xd6, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xe0, 0xdf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xe0, 0x4f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0xb,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0x0,
-    0x9f, 0xff, 0xff, 0x40, 0x0, 0xdf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x1e, 0xff, 0xff, 0xd0,
-    0x0, 0xdf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x6, 0xff, 0xff, 0xf6, 0x0, 0xcf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff, 0xfe,
-    0x10, 0xcf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x90, 0xbf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf2, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfb, 0xaf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf0,
-
-    /* U+00D2 "Ò" */
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+00D4 "Ô" */
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x91, 0xdf, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x60,
-    0x1, 0xbf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x6f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+00D5 "Õ" */
-    0x0, 0x0, 0x0, 0x0, 0x58, 0x72, 0x0, 0x0,
-    0x8, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xf9, 0x10, 0x7, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xaa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x60, 0x3b,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xc0, 0x0, 0x4, 0xbf, 0xfa, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+00D6 "Ö" */
-    0x0, 0x0, 0x0, 0x6, 0xa9, 0x20, 0x0, 0x5a,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf3, 0x9,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x10, 0x7f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfe, 0x50,
-    0x0, 0xaf, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+00D7 "×" */
-    0x0, 0x43, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0,
-    0x0, 0x4f, 0xe3, 0x0, 0x0, 0x0, 0x9, 0xfc,
-    0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0, 0xa, 0xff,
-    0xfc, 0x4, 0xff, 0xff, 0xf3, 0x0, 0xa, 0xff,
-    0xff, 0xb0, 0x4, 0xff, 0xff, 0xf3, 0xa, 0xff,
-    0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xe2, 0x0, 0x9, 0xff,
-    0xff, 0xb0, 0x4, 0xff, 0xff, 0xe2, 0x7, 0xff,
-    0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xe0, 0xc,
-    0xff, 0xa0, 0x0, 0x0, 0x4, 0xff, 0xf5, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0,
-
-    /* U+00D8 "Ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x22, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0x40, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xfb, 0x98, 0xad, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x4, 0xff, 0xff, 0xff, 0xa1,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc,
-    0x6, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x8d, 0xff, 0xff, 0xf0, 0x9f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0x8f, 0xff,
-    0xff, 0x3c, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xd,
-    0xff, 0xf3, 0x5, 0xff, 0xff, 0xf6, 0xdf, 0xff,
-    0xfe, 0x0, 0x0, 0x9, 0xff, 0xf7, 0x0, 0x3f,
-    0xff, 0xff, 0x8e, 0xff, 0xff, 0xd0, 0x0, 0x4,
-    0xff, 0xfc, 0x0, 0x2, 0xff, 0xff, 0xf8, 0xef,
-    0xff, 0xfd, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0,
-    0x2f, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xe0, 0x0,
-    0xaf, 0xff, 0x70, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0xbf, 0xff, 0xff, 0x0, 0x5f, 0xff, 0xc0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x69, 0xff, 0xff, 0xf2,
-    0x1e, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0x6f, 0xff, 0xff, 0x7b, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xc0, 0xb, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xf6, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xc9, 0x9a, 0xdf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x14, 0x9c, 0xef, 0xff, 0xdb, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+00D9 "Ù" */
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+00DA "Ú" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+00DB "Û" */
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x1a, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xa0, 0x0, 0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf5, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+00DC "Ü" */
-    0x0, 0x0, 0x4, 0xaa, 0x40, 0x0, 0x3a, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3,
-    0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf7, 0x5, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x3, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8, 0xef,
-    0x90, 0x0, 0x7e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+00DD "Ý" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0x99,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xee, 0xd4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x33,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0xa, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x1, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0, 0xb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xb0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x30, 0xbf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xfb, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00DE "Þ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x66,
-    0x66, 0x53, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xcf, 0xff, 0xfb, 0x0, 0x2, 0x6e, 0xff,
-    0xff, 0xf7, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfc, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfe, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf9,
-    0xcf, 0xff, 0xfc, 0x66, 0x79, 0xef, 0xff, 0xff,
-    0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xdb, 0x71, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+00DF "ß" */
-    0x0, 0x0, 0x2, 0x7b, 0xef, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xa, 0xff,
-    0xff, 0xfe, 0x73, 0x24, 0x7e, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xe1, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3e, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0xe, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x5, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x6f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x3, 0xff, 0xff,
-    0xff, 0xd3, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xfd, 0x20, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x3, 0xdf, 0xff, 0xff, 0xfe, 0x20, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x43, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff,
-    0x20, 0x1e, 0x83, 0x0, 0x1, 0xcf, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x1, 0xff, 0xff, 0xde,
-    0xff, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0x20,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3,
-    0xff, 0xff, 0xf2, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x6,
-    0xad, 0xff, 0xff, 0xda, 0x60, 0x0, 0x0,
-
-    /* U+00E0 "à" */
-    0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x46, 0x66, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x5f, 0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0,
-    0x5, 0xbe, 0xff, 0xda, 0x40, 0x0, 0xef, 0xff,
-    0x0,
-
-    /* U+00E1 "á" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x66, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x5f, 0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0,
-    0x5, 0xbe, 0xff, 0xda, 0x40, 0x0, 0xef, 0xff,
-    0x0,
-
-    /* U+00E2 "â" */
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc,
-    0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf9, 0x2, 0xcf, 0xff, 0xe2, 0x0, 0x0, 0x4f,
-    0xff, 0xe5, 0x0, 0x0, 0x7f, 0xff, 0xe2, 0x0,
-    0x4, 0x66, 0x51, 0x0, 0x0, 0x0, 0x26, 0x66,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x5f, 0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0,
-    0x5, 0xbe, 0xff, 0xda, 0x40, 0x0, 0xef, 0xff,
-    0x0,
-
-    /* U+00E3 "ã" */
-    0x0, 0x0, 0x3a, 0xef, 0xea, 0x62, 0x2, 0xcf,
-    0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x4, 0xff, 0xfa,
-    0x9c, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x39,
-    0x93, 0x0, 0x0, 0x47, 0x86, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x5f, 0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0,
-    0x5, 0xbe, 0xff, 0xda, 0x40, 0x0, 0xef, 0xff,
-    0x0,
-
-    /* U+00E4 "ä" */
-    0x0, 0x0, 0x5e, 0xfb, 0x10, 0x4, 0xdf, 0xc2,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0xef,
-    0xff, 0xb0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xb0,
-    0xf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf7, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x29, 0xa6, 0x0, 0x1, 0x8a, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x5f, 0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0,
-    0x5, 0xbe, 0xff, 0xda, 0x40, 0x0, 0xef, 0xff,
-    0x0,
-
-    /* U+00E5 "å" */
-    0x0, 0x0, 0x0, 0x0, 0x47, 0x73, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfb, 0x11, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x40, 0x6, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x8f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xe8, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x0, 0x0, 0x16, 0xad,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf0, 0x5f,
-    0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xba, 0xff, 0xff, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0, 0x5, 0xbe,
-    0xff, 0xda, 0x40, 0x0, 0xef, 0xff, 0x0,
-
-    /* U+00E6 "æ" */
-    0x0, 0x0, 0x27, 0xad, 0xff, 0xfd, 0xa5, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xb6, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x15,
-    0xef, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xe9, 0x41, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf8,
-    0x10, 0x3, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x40, 0x0, 0x0, 0x47,
-    0x9a, 0xaa, 0xad, 0xff, 0xff, 0xfa, 0xaa, 0xaa,
-    0xaa, 0xdf, 0xff, 0xf6, 0x0, 0x19, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xb, 0xff, 0xff, 0xfe, 0xa7,
-    0x77, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x72, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0xa, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x20, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x32,
-    0x4, 0xff, 0xff, 0xfb, 0x20, 0x17, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x10, 0x1, 0x47, 0xcf, 0x50,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x3a, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfe, 0xc9, 0x50, 0x0,
-
-    /* U+00E7 "ç" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xa6, 0x56,
-    0xaf, 0xf2, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x4, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x38, 0x0,
-    0x6f, 0xff, 0xff, 0xf9, 0x43, 0x57, 0xcf, 0xc0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xfc,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x13,
-    0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xfe, 0xc7, 0x0, 0x0, 0x0,
-
-    /* U+00E8 "è" */
-    0x0, 0x1e, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x45, 0x55, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+00E9 "é" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x55, 0x51, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+00EA "ê" */
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfb,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf7, 0x3, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x8f,
-    0xff, 0xc3, 0x0, 0x1, 0x9f, 0xff, 0xd1, 0x0,
-    0x5, 0x55, 0x40, 0x0, 0x0, 0x0, 0x35, 0x55,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+00EB "ë" */
-    0x0, 0x0, 0x8e, 0xf9, 0x0, 0x7, 0xef, 0xa1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x2, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x5, 0xff, 0xff, 0x80,
-    0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf4, 0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3a, 0xa4, 0x0, 0x3, 0x9a, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+00EC "ì" */
-    0x2e, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xa0, 0x0, 0x0,
-    0x1, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x11,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20,
-
-    /* U+00ED "í" */
-    0x0, 0x1, 0xef, 0xff, 0xfe, 0x30, 0x0, 0xcf,
-    0xff, 0xfc, 0x20, 0x0, 0xaf, 0xff, 0xf9, 0x0,
-    0x0, 0x9f, 0xff, 0xe4, 0x0, 0x0, 0x8f, 0xff,
-    0xa1, 0x0, 0x0, 0x1, 0x11, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0,
-
-    /* U+00EE "î" */
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x9f, 0xff, 0xfd,
-    0x10, 0x0, 0xc, 0xff, 0xfd, 0x30, 0x3d, 0xff,
-    0xfd, 0x10, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x7,
-    0xff, 0xfd, 0x10, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-
-    /* U+00EF "ï" */
-    0x9, 0xfe, 0x80, 0x0, 0x8f, 0xf9, 0x6, 0xff,
-    0xff, 0x30, 0x4f, 0xff, 0xf6, 0x8f, 0xff, 0xf5,
-    0x6, 0xff, 0xff, 0x84, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0xf4, 0x5, 0xaa, 0x30, 0x0, 0x4a, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-
-    /* U+00F0 "ð" */
-    0x0, 0x0, 0x0, 0x3c, 0x40, 0x0, 0x0, 0x4b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfc, 0x30,
-    0x1a, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf9, 0x1a, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x30, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x4, 0x9d,
-    0xee, 0xda, 0x58, 0xff, 0xff, 0x70, 0x0, 0x2,
-    0xcf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xc0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x7, 0xff, 0xff, 0xfc,
-    0x40, 0x3, 0xaf, 0xff, 0xff, 0xf7, 0xd, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf9,
-    0x2f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfa, 0x4f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa, 0x5f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf8,
-    0x4f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0xc, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x5, 0xff,
-    0xff, 0xfc, 0x30, 0x2, 0x9f, 0xff, 0xff, 0x50,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+00F1 "ñ" */
-    0x0, 0x0, 0x3b, 0xef, 0xea, 0x62, 0x2, 0xdf,
-    0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x4, 0xff, 0xf9,
-    0x9c, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x39,
-    0x93, 0x0, 0x0, 0x47, 0x86, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x5, 0xae,
-    0xff, 0xea, 0x40, 0x0, 0x3f, 0xff, 0xf4, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff,
-    0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x43, 0xff, 0xff, 0xff, 0xfa, 0x54, 0x7e, 0xff,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf0,
-
-    /* U+00F2 "ò" */
-    0x0, 0x7, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x55,
-    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x95, 0x58, 0xef, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0x95, 0x57, 0xef, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x55, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x95, 0x58, 0xef, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0x95, 0x57, 0xef, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+00F4 "ô" */
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xfe, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xc2, 0x9, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x2d, 0xff, 0xf8, 0x0, 0x0, 0x4d, 0xff,
-    0xf6, 0x0, 0x0, 0x25, 0x55, 0x20, 0x0, 0x0,
-    0x0, 0x55, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x95, 0x58, 0xef, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0x95, 0x57, 0xef, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+00F5 "õ" */
-    0x0, 0x0, 0x19, 0xef, 0xeb, 0x73, 0x1, 0x9f,
-    0xf5, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xf,
-    0xff, 0xb9, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x19, 0x95, 0x0, 0x0, 0x37, 0x87, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x95, 0x58, 0xef, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0x95, 0x57, 0xef, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+00F6 "ö" */
-    0x0, 0x0, 0x2c, 0xfd, 0x40, 0x2, 0xcf, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0xa,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf0, 0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xc0, 0x8, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xb8, 0x10, 0x0, 0x7a, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x95, 0x58, 0xef, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0x95, 0x57, 0xef, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+00F7 "÷" */
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x34, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xa0, 0x0,
-    0x0, 0x0,
-
-    /* U+00F8 "ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe,
-    0xc7, 0x4f, 0xd2, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x3, 0xff, 0xff, 0xff, 0x95, 0x58,
-    0xff, 0xff, 0xff, 0x60, 0xa, 0xff, 0xff, 0xf4,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf3,
-    0x2f, 0xff, 0xff, 0x50, 0x0, 0xef, 0xfe, 0xff,
-    0xff, 0xf7, 0x4f, 0xff, 0xff, 0x20, 0xa, 0xff,
-    0xf5, 0xef, 0xff, 0xf9, 0x5f, 0xff, 0xff, 0x10,
-    0x5f, 0xff, 0xa0, 0xdf, 0xff, 0xfa, 0x5f, 0xff,
-    0xff, 0x11, 0xef, 0xfe, 0x10, 0xdf, 0xff, 0xfa,
-    0x4f, 0xff, 0xff, 0x2a, 0xff, 0xf4, 0x0, 0xef,
-    0xff, 0xf9, 0x2f, 0xff, 0xff, 0xbf, 0xff, 0x90,
-    0x1, 0xff, 0xff, 0xf7, 0xe, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x6, 0xff, 0xff, 0xf3, 0x9, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x1e, 0xff, 0xff, 0xe0,
-    0x2, 0xff, 0xff, 0xff, 0xd5, 0x57, 0xef, 0xff,
-    0xff, 0x70, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x6f, 0xfc, 0x6b, 0xef, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+00F9 "ù" */
-    0x0, 0xb, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff,
-    0xd0,
-
-    /* U+00FA "ú" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff,
-    0xd0,
-
-    /* U+00FB "û" */
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa,
-    0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf6, 0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x8f,
-    0xff, 0xb2, 0x0, 0x0, 0x4d, 0xff, 0xf4, 0x0,
-    0x1, 0x11, 0x10, 0x0, 0x0, 0x0, 0x1, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff,
-    0xd0,
-
-    /* U+00FC "ü" */
-    0x0, 0x0, 0x6e, 0xfb, 0x10, 0x5, 0xdf, 0xc2,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf7, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x29, 0xa6, 0x0, 0x1, 0x9a, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff,
-    0xd0,
-
-    /* U+00FD "ý" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x90, 0xa, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xff, 0x70,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x5, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50,
-    0x0, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf0, 0x4, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40,
-    0xaf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf9, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x8f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x57,
-    0xef, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xff, 0xda, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+00FE "þ" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x4a, 0xef, 0xfc, 0x70, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x85, 0x59, 0xff, 0xff, 0xff, 0x40,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf1,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xd0, 0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x90, 0x3f, 0xff, 0xff, 0xff,
-    0x95, 0x5a, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x3f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x3f, 0xff, 0xff, 0x2c, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x6b, 0xef, 0xfc, 0x70, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00FF "ÿ" */
-    0x0, 0x0, 0x1b, 0xfd, 0x50, 0x1, 0xbf, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf1, 0xa, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfd, 0x0, 0x7f, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xa9, 0x10, 0x0,
-    0x6a, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x90, 0xa, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xff, 0x70,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x5, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50,
-    0x0, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf0, 0x4, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40,
-    0xaf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf9, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x8f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x57,
-    0xef, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xff, 0xda, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0100 "Ā" */
-    0x0, 0x0, 0x0, 0x5b, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0xbf,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa,
-
-    /* U+0101 "ā" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0xad, 0xff, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x5, 0xfd, 0x73, 0x0, 0x17, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x1, 0x6a,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0x83, 0x0, 0x4,
-    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x5,
-    0xff, 0xff, 0xfa, 0x10, 0x4, 0xdf, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xaf, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xfa, 0x3, 0xff, 0xff, 0x0, 0x0, 0x5b,
-    0xef, 0xfd, 0xa4, 0x0, 0xe, 0xff, 0xf0,
-
-    /* U+0102 "Ă" */
-    0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x50, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xec, 0xbc,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8c, 0xff, 0xec, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xcf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf3, 0x4, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0,
-    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xa9, 0x99, 0x99, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfa,
-
-    /* U+0103 "ă" */
-    0x0, 0xd, 0xff, 0x82, 0x0, 0x1, 0x39, 0xff,
-    0xc0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0xab, 0xb9, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xd7, 0x30, 0x1, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x5f, 0xff, 0xff, 0xa1, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xf0, 0x0,
-    0x5, 0xbe, 0xff, 0xda, 0x40, 0x0, 0xef, 0xff,
-    0x0,
-
-    /* U+0104 "Ą" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xcf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf4, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0xe, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x9f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf3, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x90, 0x0, 0xbf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x0,
-    0x6, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0xaf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x2,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x5d, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x63, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2a, 0xef, 0xeb, 0x10,
-
-    /* U+0105 "ą" */
-    0x0, 0x0, 0x26, 0xad, 0xff, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x5,
-    0xfd, 0x83, 0x0, 0x17, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x5a, 0xde,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0x93, 0x10, 0x5, 0xff,
-    0xff, 0xf0, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x5, 0xff,
-    0xff, 0xfa, 0x10, 0x4, 0xcf, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xaf, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xfa, 0x3, 0xff, 0xff, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0xa4, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x93, 0x53, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xdf, 0xfd, 0x40,
-
-    /* U+0106 "Ć" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xb9, 0x8a, 0xef,
-    0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x3, 0x9f, 0x30, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x27, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xbe, 0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
-    0xfe, 0xda, 0x62, 0x0,
-
-    /* U+0107 "ć" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x55, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xfa, 0x65, 0x6a, 0xff, 0x20, 0xa, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x40, 0x0, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0x90, 0x6, 0xff, 0xff, 0xff, 0xb6,
-    0x56, 0x9d, 0xfc, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4,
-    0x9c, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-
-    /* U+0108 "Ĉ" */
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xc1, 0xaf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xf9, 0x0, 0x8, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0xef, 0xfe, 0x50, 0x0,
-    0x0, 0x3d, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xb9, 0x8a, 0xef,
-    0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x3, 0x9f, 0x30, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x27, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xbe, 0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
-    0xfe, 0xda, 0x62, 0x0,
-
-    /* U+0109 "ĉ" */
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0xcf, 0xff, 0xe3, 0x7, 0xff,
-    0xff, 0x90, 0x0, 0xcf, 0xff, 0x91, 0x0, 0x3,
-    0xcf, 0xff, 0x90, 0x15, 0x55, 0x30, 0x0, 0x0,
-    0x0, 0x45, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xfa, 0x65, 0x6a, 0xff, 0x20, 0xa, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x40, 0x0, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0x90, 0x6, 0xff, 0xff, 0xff, 0xb6,
-    0x56, 0x9d, 0xfc, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4,
-    0x9c, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-
-    /* U+010A "Ċ" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xe8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xb9, 0x8a, 0xef,
-    0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x3, 0x9f, 0x30, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x27, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xbe, 0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
-    0xfe, 0xda, 0x62, 0x0,
-
-    /* U+010B "ċ" */
-    0x0, 0x0, 0x0, 0x8, 0xef, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xfa, 0x65, 0x6a, 0xff, 0x20, 0xa, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x40, 0x0, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0x90, 0x6, 0xff, 0xff, 0xff, 0xb6,
-    0x56, 0x9d, 0xfc, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4,
-    0x9c, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-
-    /* U+010C "Č" */
-    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x3d,
-    0xff, 0xf2, 0x0, 0x0, 0x2e, 0xff, 0xfa, 0x0,
-    0x7, 0xff, 0xff, 0x50, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc1, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xb9, 0x8a, 0xef,
-    0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x3, 0x9f, 0x30, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x27, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xb9,
-    0x89, 0xbe, 0xff, 0xb0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
-    0xfe, 0xda, 0x62, 0x0,
-
-    /* U+010D "č" */
-    0x1, 0xef, 0xfd, 0x40, 0x0, 0x0, 0x6e, 0xff,
-    0xd0, 0x0, 0x2e, 0xff, 0xfa, 0x0, 0x2c, 0xff,
-    0xfd, 0x10, 0x0, 0x3, 0xff, 0xff, 0xd5, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x45, 0x55, 0x55, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xda, 0x61, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xa6,
-    0x56, 0xaf, 0xf2, 0x0, 0xa, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x40, 0x0, 0xf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x49, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xb6, 0x56, 0x9d, 0xfc, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xff, 0xfe,
-    0xc9, 0x30, 0x0,
-
-    /* U+010E "Ď" */
-    0x0, 0x18, 0x88, 0x50, 0x0, 0x0, 0x0, 0x68,
-    0x88, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x20,
-    0x0, 0x4d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf5, 0x8, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xcf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x84, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xcf, 0xff, 0xfd, 0x77,
-    0x78, 0xae, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xfc, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0x40, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xb0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf6, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf8, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x90, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x1, 0x8f, 0xff, 0xff, 0xfa, 0x0, 0xcf,
-    0xff, 0xfd, 0x88, 0x89, 0xcf, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe,
-    0xda, 0x62, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+010F "ď" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf0, 0xc, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0,
-    0x9f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x9, 0xbb, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x8d, 0xff, 0xea, 0x30, 0x5f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0x93, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf9, 0x56, 0x9f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x30,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x84, 0x47, 0xef,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf7,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xdf, 0xfe, 0x93, 0x0, 0x5f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0110 "Đ" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xff, 0xd7, 0x77,
-    0x8a, 0xef, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xb0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x71, 0x77, 0xdf, 0xff, 0xfd,
-    0x77, 0x76, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x89, 0xcf, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x62, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0111 "đ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x88, 0x8b, 0xff, 0xff,
-    0xf8, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x25, 0x54, 0x0, 0x5, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xf9, 0x14, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xa, 0xff, 0xff, 0xfd,
-    0x40, 0x3, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0xe,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf0, 0x0, 0x2f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf0, 0x0, 0x4f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x5f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x5f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0xd,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x84, 0x47,
-    0xef, 0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x18, 0xdf, 0xfe, 0x93, 0x0, 0x5f, 0xff, 0xf0,
-    0x0,
-
-    /* U+0112 "Ē" */
-    0x1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0113 "ē" */
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x3b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7c, 0xef, 0xfe, 0xb7,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0x60, 0x3,
-    0xff, 0xff, 0xf9, 0x10, 0x1, 0xaf, 0xff, 0xfe,
-    0x0, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf5, 0xf, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x82, 0xff, 0xff, 0xfa, 0x99,
-    0x99, 0x99, 0xbf, 0xff, 0xfa, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x14, 0x0,
-    0x2f, 0xff, 0xff, 0xf8, 0x20, 0x1, 0x36, 0xbf,
-    0x90, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x5, 0xad, 0xff, 0xfe, 0xda, 0x61, 0x0,
-
-    /* U+0114 "Ĕ" */
-    0xe, 0xff, 0x10, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x3d, 0xff, 0x80,
-    0x6, 0xff, 0xff, 0xdc, 0xce, 0xff, 0xff, 0x20,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5b, 0xef, 0xfd, 0x92, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0115 "ĕ" */
-    0x0, 0x1f, 0xff, 0x51, 0x0, 0x1, 0x4c, 0xff,
-    0x90, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0xab, 0xb9, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+0116 "Ė" */
-    0x0, 0x0, 0x0, 0x3, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0117 "ė" */
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x32, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+0118 "Ę" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x53, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbe, 0xfe, 0xb0,
-
-    /* U+0119 "ę" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xdd, 0xff, 0xff, 0xff, 0x30, 0x3, 0xff,
-    0xff, 0xfc, 0x20, 0x2, 0xcf, 0xff, 0xfc, 0x0,
-    0xaf, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf2, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x62, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf9, 0x4f, 0xff, 0xff, 0xa9,
-    0x99, 0x99, 0x9b, 0xff, 0xff, 0xb5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x3f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2f,
-    0xff, 0xff, 0xe6, 0x10, 0x0, 0x25, 0x9d, 0x90,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x35, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x9e, 0xff, 0xc2, 0x0,
-
-    /* U+011A "Ě" */
-    0x58, 0x87, 0x20, 0x0, 0x0, 0x3, 0x88, 0x84,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x9f, 0xff, 0xd1,
-    0x3, 0xff, 0xff, 0xb0, 0x2d, 0xff, 0xfe, 0x10,
-    0x0, 0x4f, 0xff, 0xfd, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x20,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfd, 0x88, 0x88, 0x88, 0x88, 0x80,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+011B "ě" */
-    0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x3d, 0xff,
-    0xf3, 0x0, 0x0, 0xbf, 0xff, 0xd2, 0x0, 0x9f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5,
-    0xcf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x55, 0x55, 0x55, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0x91, 0x0, 0x1a, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x50, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf8, 0x2f, 0xff, 0xff,
-    0xa9, 0x99, 0x99, 0x9b, 0xff, 0xff, 0xa4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x2, 0xff, 0xff, 0xff, 0x82, 0x0, 0x13,
-    0x6b, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xed, 0xa6, 0x10,
-    0x0,
-
-    /* U+011C "Ĝ" */
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x1c,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x70, 0x0, 0xaf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xd3, 0x0, 0x0, 0x5, 0xef,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfc, 0x98, 0x9a, 0xdf, 0xfe, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x2,
-    0x76, 0x0, 0x8, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfe,
-    0x0, 0x0, 0x8, 0x88, 0x89, 0xff, 0xff, 0xf3,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf3, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xb9, 0x89, 0xad, 0xff,
-    0xff, 0xf3, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xff, 0xed, 0xa8, 0x41, 0x0,
-
-    /* U+011D "ĝ" */
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfb, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x60, 0x4e, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xc2, 0x0, 0x1, 0xaf, 0xff,
-    0xc0, 0x0, 0x0, 0x55, 0x54, 0x0, 0x0, 0x0,
-    0x3, 0x55, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xfe,
-    0x74, 0x5d, 0xff, 0xff, 0xfb, 0x73, 0x1, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xef, 0xff, 0xf2, 0x0,
-    0x4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xf7, 0x0, 0x6, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x7f, 0xff, 0xfa, 0x0, 0x6, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xef, 0xff,
-    0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x74, 0x5d,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8,
-    0x55, 0x55, 0x54, 0x30, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff,
-    0xfe, 0x51, 0x0, 0x0, 0x14, 0xdf, 0xff, 0xfa,
-    0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfa, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0xbf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xe9, 0x88, 0x9c, 0xff, 0xff,
-    0xff, 0x60, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x2,
-    0x8b, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0, 0x0,
-
-    /* U+011E "Ğ" */
-    0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8,
-    0x20, 0x1, 0x3a, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x8b, 0xba, 0x73, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfc, 0x98, 0x9a, 0xdf, 0xfe, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x2,
-    0x76, 0x0, 0x8, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfe,
-    0x0, 0x0, 0x8, 0x88, 0x89, 0xff, 0xff, 0xf3,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf3, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xb9, 0x89, 0xad, 0xff,
-    0xff, 0xf3, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xff, 0xed, 0xa8, 0x41, 0x0,
-
-    /* U+011F "ğ" */
-    0x0, 0x3f, 0xfe, 0x41, 0x0, 0x1, 0x4d, 0xff,
-    0x70, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x58, 0xbb, 0xb9, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xfe,
-    0x74, 0x5d, 0xff, 0xff, 0xfb, 0x73, 0x1, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xef, 0xff, 0xf2, 0x0,
-    0x4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xf7, 0x0, 0x6, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x7f, 0xff, 0xfa, 0x0, 0x6, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xef, 0xff,
-    0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x74, 0x5d,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8,
-    0x55, 0x55, 0x54, 0x30, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff,
-    0xfe, 0x51, 0x0, 0x0, 0x14, 0xdf, 0xff, 0xfa,
-    0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfa, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0xbf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xe9, 0x88, 0x9c, 0xff, 0xff,
-    0xff, 0x60, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x2,
-    0x8b, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0, 0x0,
-
-    /* U+0120 "Ġ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x31, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfc, 0x98, 0x9a, 0xdf, 0xfe, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x2,
-    0x76, 0x0, 0x8, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfe,
-    0x0, 0x0, 0x8, 0x88, 0x89, 0xff, 0xff, 0xf3,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf3, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xb9, 0x89, 0xad, 0xff,
-    0xff, 0xf3, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xff, 0xed, 0xa8, 0x41, 0x0,
-
-    /* U+0121 "ġ" */
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xfe,
-    0x74, 0x5d, 0xff, 0xff, 0xfb, 0x73, 0x1, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xef, 0xff, 0xf2, 0x0,
-    0x4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xf7, 0x0, 0x6, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x7f, 0xff, 0xfa, 0x0, 0x6, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xef, 0xff,
-    0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x74, 0x5d,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8,
-    0x55, 0x55, 0x54, 0x30, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff,
-    0xfe, 0x51, 0x0, 0x0, 0x14, 0xdf, 0xff, 0xfa,
-    0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfa, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0xbf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xe9, 0x88, 0x9c, 0xff, 0xff,
-    0xff, 0x60, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x2,
-    0x8b, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0, 0x0,
-
-    /* U+0122 "Ģ" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfc, 0x98, 0x9a, 0xdf, 0xfe, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x2,
-    0x76, 0x0, 0x8, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfe,
-    0x0, 0x0, 0x8, 0x88, 0x89, 0xff, 0xff, 0xf3,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf3, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf3, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xb9, 0x89, 0xad, 0xff,
-    0xff, 0xf3, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xff, 0xed, 0xa8, 0x41, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xcc, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0123 "ģ" */
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xcc, 0xc8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xfe,
-    0x74, 0x5d, 0xff, 0xff, 0xfb, 0x73, 0x1, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xef, 0xff, 0xf2, 0x0,
-    0x4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xf7, 0x0, 0x6, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x7f, 0xff, 0xfa, 0x0, 0x6, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xef, 0xff,
-    0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x74, 0x5d,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8,
-    0x55, 0x55, 0x54, 0x30, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff,
-    0xfe, 0x51, 0x0, 0x0, 0x14, 0xdf, 0xff, 0xfa,
-    0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfa, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0xbf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xe9, 0x88, 0x9c, 0xff, 0xff,
-    0xff, 0x60, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x2,
-    0x8b, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0, 0x0,
-
-    /* U+0124 "Ĥ" */
-    0x0, 0x0, 0x0, 0x3, 0x88, 0x88, 0x88, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x5a, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xd2, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfd, 0x88, 0x88, 0x88, 0x88, 0x89, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4,
-
-    /* U+0125 "ĥ" */
-    0x0, 0x0, 0x5, 0x88, 0x88, 0x87, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x8f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf5, 0x3, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x20,
-    0x0, 0x1b, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x88, 0x60, 0x0, 0x0, 0x0, 0x58, 0x88,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x3, 0xae,
-    0xff, 0xda, 0x40, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x9f, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x54,
-    0x7e, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x2, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-
-    /* U+0126 "Ħ" */
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x77, 0x7e, 0xff, 0xff, 0xd7, 0x77,
-    0x77, 0x77, 0x77, 0x8f, 0xff, 0xff, 0xa7, 0x74,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xd8, 0x88, 0x88, 0x88, 0x88, 0x9f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x40, 0x0,
-
-    /* U+0127 "ħ" */
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x9f, 0xff,
-    0xff, 0x98, 0x88, 0x85, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x10, 0x3a, 0xef, 0xfd, 0xa4, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x9f, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xa5, 0x46, 0xef, 0xff, 0xff,
-    0x90, 0x3, 0xff, 0xff, 0xff, 0x70, 0x0, 0x2,
-    0xff, 0xff, 0xfd, 0x0, 0x3f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf0,
-
-    /* U+0128 "Ĩ" */
-    0x0, 0x19, 0xef, 0xd9, 0x30, 0x0, 0x9f, 0xf3,
-    0x1, 0xef, 0xff, 0xff, 0xfd, 0x9b, 0xff, 0xf0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0xf, 0xff, 0xb9, 0xdf, 0xff, 0xff, 0xfd, 0x10,
-    0x3f, 0xf9, 0x0, 0x3, 0x9e, 0xfe, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-
-    /* U+0129 "ĩ" */
-    0x0, 0x6c, 0xff, 0xd9, 0x41, 0x5, 0xff, 0xb0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x19, 0xff,
-    0xd9, 0xad, 0xff, 0xff, 0xfe, 0x30, 0x69, 0x80,
-    0x0, 0x2, 0x68, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0,
-
-    /* U+012A "Ī" */
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-
-    /* U+012B "ī" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x84, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0,
-
-    /* U+012C "Ĭ" */
-    0xef, 0xf2, 0x0, 0x0, 0x0, 0x4f, 0xfd, 0xbf,
-    0xfb, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x5f, 0xff,
-    0xfd, 0xcc, 0xef, 0xff, 0xf3, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-
-    /* U+012D "ĭ" */
-    0x3f, 0xfe, 0x41, 0x0, 0x1, 0x4d, 0xff, 0x60,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x59, 0xbb, 0xb9, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0,
-
-    /* U+012E "Į" */
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0xc, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x4f, 0xff, 0x30, 0x4, 0xff, 0xf5, 0x0,
-    0xe, 0xff, 0xa0, 0x0, 0x6f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x10, 0x0, 0x9f, 0xff, 0xa3, 0x53,
-    0x4f, 0xff, 0xff, 0xf8, 0xb, 0xff, 0xff, 0xf8,
-    0x0, 0x7d, 0xff, 0xd5,
-
-    /* U+012F "į" */
-    0x0, 0x7e, 0xfe, 0x70, 0x3, 0xff, 0xff, 0xf3,
-    0x6, 0xff, 0xff, 0xf6, 0x4, 0xff, 0xff, 0xf4,
-    0x0, 0xaf, 0xff, 0xa0, 0x0, 0x1, 0x31, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x2d, 0xff, 0x70,
-    0x1, 0xef, 0xf9, 0x0, 0xb, 0xff, 0xd0, 0x0,
-    0x2f, 0xff, 0x70, 0x0, 0x5f, 0xff, 0x50, 0x0,
-    0x5f, 0xff, 0xc4, 0x45, 0x1f, 0xff, 0xff, 0xfb,
-    0x7, 0xff, 0xff, 0xfb, 0x0, 0x5c, 0xff, 0xd8,
-
-    /* U+0130 "İ" */
-    0x0, 0x33, 0x0, 0x4f, 0xff, 0xe4, 0xdf, 0xff,
-    0xfc, 0xef, 0xff, 0xfd, 0xbf, 0xff, 0xfb, 0x2b,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf,
-    0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf,
-    0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff,
-    0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf,
-    0xff, 0xfb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-    0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xfb,
-
-    /* U+0131 "ı" */
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2,
-
-    /* U+0132 "Ĳ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf9, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x31,
-    0x1, 0x6f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x36, 0x88, 0x85, 0x10,
-    0x0, 0x0,
-
-    /* U+0133 "ĳ" */
-    0x7, 0xef, 0xe7, 0x0, 0x0, 0x0, 0x7e, 0xfd,
-    0x60, 0x3f, 0xff, 0xff, 0x30, 0x0, 0x3, 0xff,
-    0xff, 0xf3, 0x6f, 0xff, 0xff, 0x60, 0x0, 0x6,
-    0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x40, 0x0,
-    0x4, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0, 0x13, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x37, 0x55, 0x9f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef,
-    0xfe, 0xc7, 0x0, 0x0,
-
-    /* U+0134 "Ĵ" */
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0xcf, 0xff, 0xf4, 0x5f, 0xff,
-    0xfc, 0x0, 0x0, 0xaf, 0xff, 0xd3, 0x0, 0x3e,
-    0xff, 0xfb, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0,
-    0x19, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x9b, 0x99, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xff, 0xfd, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0135 "ĵ" */
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x9f, 0xff, 0xfd,
-    0x10, 0x0, 0xc, 0xff, 0xfd, 0x30, 0x3d, 0xff,
-    0xfd, 0x10, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x7,
-    0xff, 0xfd, 0x10, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x2,
-    0x75, 0x59, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x2, 0xbe, 0xff, 0xec, 0x70, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0136 "Ķ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x7c, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xa0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf2, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x2, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0xdf, 0xff, 0xff, 0x30, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0xaf, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xce, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x6b, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfe, 0x20, 0x2f, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x8f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x30, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf7, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xb0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x50, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x1c, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xcc, 0xcc, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0137 "ķ" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x70, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x90,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x6f, 0xff,
-    0xff, 0xb0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x3f, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf1, 0x2e, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x1d, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x6, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x1e, 0xff, 0xff, 0xe1,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x80, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x30, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0xcc, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0138 "ĸ" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf6, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x1, 0xef, 0xff, 0xfb, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xcf, 0xff, 0xfd,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0xaf,
-    0xff, 0xfe, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x7f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x5f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x3e,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x20, 0x8f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0xcf, 0xff, 0xff, 0x30, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x1, 0xef, 0xff, 0xfd, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x5, 0xff, 0xff,
-    0xfa, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf7, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf3, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xe1,
-
-    /* U+0139 "Ĺ" */
-    0x0, 0x0, 0x38, 0x88, 0x88, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xd8, 0x88, 0x88, 0x88, 0x88, 0x80, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
-
-    /* U+013A "ĺ" */
-    0x0, 0x0, 0x68, 0x88, 0x88, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xb0, 0x0, 0x1e, 0xff, 0xff, 0xa0,
-    0x0, 0xb, 0xff, 0xff, 0x80, 0x0, 0x8, 0xff,
-    0xff, 0x60, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x58, 0x87, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-
-    /* U+013B "Ļ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xd8, 0x88, 0x88,
-    0x88, 0x88, 0x80, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xcc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+013C "ļ" */
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x23, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xcc,
-    0xc5, 0x9, 0xff, 0xff, 0x20, 0xdf, 0xff, 0x90,
-    0xf, 0xff, 0xf1, 0x4, 0xff, 0xf8, 0x0, 0x7f,
-    0xfe, 0x0, 0x0,
-
-    /* U+013D "Ľ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xf1, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x90, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x10, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x7, 0xff, 0xf8, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0xb, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xa, 0xbb, 0x50, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10,
-
-    /* U+013E "ľ" */
-    0x3f, 0xff, 0xff, 0x20, 0xdf, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0x20, 0xff, 0xff, 0xa0, 0x3f, 0xff,
-    0xff, 0x23, 0xff, 0xff, 0x20, 0x3f, 0xff, 0xff,
-    0x26, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0x2a,
-    0xff, 0xf1, 0x0, 0x3f, 0xff, 0xff, 0x29, 0xbb,
-    0x50, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+013F "Ŀ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x3, 0xcf, 0xe9, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xef, 0xff, 0xf8, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x6, 0xff, 0xfd, 0x20, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x32, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xd8, 0x88, 0x88,
-    0x88, 0x88, 0x80, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1,
-
-    /* U+0140 "ŀ" */
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x3, 0x30, 0x3,
-    0xff, 0xff, 0xf2, 0x4f, 0xff, 0xe4, 0x3f, 0xff,
-    0xff, 0x2d, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x2b, 0xff,
-    0xff, 0xb3, 0xff, 0xff, 0xf2, 0x2b, 0xff, 0xb1,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0141 "Ł" */
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb5, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbd, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xd8, 0x88,
-    0x88, 0x88, 0x88, 0x80, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1,
-
-    /* U+0142 "ł" */
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf7, 0x80, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x1, 0xee, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-
-    /* U+0143 "Ń" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x88,
-    0x88, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xde, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xd6, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xe0, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xe0, 0x4f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0x2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff, 0x40,
-    0x0, 0xdf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x1e, 0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x6, 0xff, 0xff, 0xf6,
-    0x0, 0xcf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xdf, 0xff, 0xfe, 0x10, 0xcf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x90, 0xbf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfb, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0144 "ń" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x55, 0x52, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x5, 0xae,
-    0xff, 0xea, 0x40, 0x0, 0x3f, 0xff, 0xf4, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff,
-    0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x43, 0xff, 0xff, 0xff, 0xfa, 0x54, 0x7e, 0xff,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf0,
-
-    /* U+0145 "Ņ" */
-    0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xde, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xd6, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xe0, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xe0, 0x4f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0x2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff, 0x40,
-    0x0, 0xdf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x1e, 0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x6, 0xff, 0xff, 0xf6,
-    0x0, 0xcf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xdf, 0xff, 0xfe, 0x10, 0xcf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x90, 0xbf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfb, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xcc, 0xcc, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0146 "ņ" */
-    0x3f, 0xff, 0xf0, 0x0, 0x5a, 0xef, 0xfe, 0xa4,
-    0x0, 0x3, 0xff, 0xff, 0x41, 0xcf, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x3f, 0xff, 0xfa, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff,
-    0xff, 0xff, 0xa5, 0x47, 0xef, 0xff, 0xff, 0xa3,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcc, 0xcc, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0147 "Ň" */
-    0x0, 0x0, 0x78, 0x87, 0x10, 0x0, 0x0, 0x4,
-    0x88, 0x82, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xe5, 0x0, 0x1, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x4e, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfc, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xde, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xd6, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xe0, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xe0, 0x4f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0x2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff, 0x40,
-    0x0, 0xdf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x1e, 0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x6, 0xff, 0xff, 0xf6,
-    0x0, 0xcf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xdf, 0xff, 0xfe, 0x10, 0xcf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x90, 0xbf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfb, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0148 "ň" */
-    0x0, 0x8f, 0xff, 0x91, 0x0, 0x0, 0x2b, 0xff,
-    0xf6, 0x0, 0x0, 0x9f, 0xff, 0xe4, 0x0, 0x7f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
-    0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x55, 0x55, 0x55, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x5, 0xae,
-    0xff, 0xea, 0x40, 0x0, 0x3f, 0xff, 0xf4, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff,
-    0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x43, 0xff, 0xff, 0xff, 0xfa, 0x54, 0x7e, 0xff,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf0,
-
-    /* U+0149 "ŉ" */
-    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xe0, 0x2f, 0xff, 0xf1, 0x0, 0x5b, 0xef, 0xfe,
-    0xa4, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x2f, 0xff,
-    0xf6, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0xac, 0xcc, 0x10, 0x2f, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xa6, 0x46, 0xdf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf0,
-
-    /* U+014A "Ŋ" */
-    0xcf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xde, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xd4, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0xcf, 0xff, 0xe0, 0x9f, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0xd,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xdf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xdf, 0xff, 0xf0, 0xcf, 0xff, 0xf0, 0x0,
-    0x8f, 0xff, 0xff, 0xf2, 0x0, 0xcf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0xd, 0xff, 0xff, 0xfc,
-    0x0, 0xcf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf3, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x1,
-    0x5d, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x13, 0x44, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+014B "ŋ" */
-    0x3f, 0xff, 0xf0, 0x0, 0x5a, 0xef, 0xfe, 0xa4,
-    0x0, 0x3, 0xff, 0xff, 0x41, 0xcf, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x3f, 0xff, 0xfa, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff,
-    0xff, 0xff, 0xa5, 0x47, 0xef, 0xff, 0xff, 0x93,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x65, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf,
-    0xff, 0xc7, 0x10, 0x0,
-
-    /* U+014C "Ō" */
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0, 0x6f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf4,
-    0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x36,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfb,
-    0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff,
-    0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc, 0x99,
-    0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
-    0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+014D "ō" */
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x95, 0x58, 0xef, 0xff, 0xff, 0x60, 0xa, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x5f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0xe, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0x2, 0xff, 0xff, 0xff, 0x95, 0x57,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe,
-    0xc8, 0x20, 0x0, 0x0,
-
-    /* U+014E "Ŏ" */
-    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x72, 0x0, 0x13, 0xbf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x49, 0xbb, 0xa7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+014F "ŏ" */
-    0x0, 0x9, 0xff, 0xb3, 0x0, 0x0, 0x26, 0xff,
-    0xf1, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0x9b, 0xba, 0x73, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x95, 0x58, 0xef, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf7, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0x95, 0x57, 0xef, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0150 "Ő" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfc,
-    0xb, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfd, 0x14, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x10, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0x10, 0x9f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf9,
-    0x0, 0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0xc6, 0x0, 0x9, 0xcc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xff, 0xeb, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xb9, 0x89, 0xdf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x9, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6d, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x8e, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xd0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfc,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+0151 "ő" */
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0xd,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x6, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfb, 0x2, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf9, 0x0, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf7, 0x0,
-    0x6f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xc4, 0x0, 0xb, 0xcc, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xec,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf9,
-    0x55, 0x8e, 0xff, 0xff, 0xf6, 0x0, 0xa, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x30, 0x2f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf7, 0x4, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x90,
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x5, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xa0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x2,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x70, 0xe, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf3, 0x0, 0x9f, 0xff, 0xff,
-    0x40, 0x0, 0x1, 0xef, 0xff, 0xfe, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x95, 0x57, 0xef, 0xff, 0xff,
-    0x70, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+0152 "Œ" */
-    0x0, 0x0, 0x0, 0x17, 0xbd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xcf,
-    0xff, 0xff, 0xfe, 0xa8, 0x89, 0xae, 0xff, 0xff,
-    0xf7, 0x77, 0x77, 0x77, 0x77, 0x60, 0x5f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x4d, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x4e, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf7, 0x77, 0x77, 0x77, 0x77,
-    0x1c, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xea, 0x99, 0xab, 0xef, 0xff, 0xff,
-    0x88, 0x88, 0x88, 0x88, 0x87, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x1, 0x7b,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+0153 "œ" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb6, 0x10,
-    0x0, 0x2, 0x8c, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff,
-    0xff, 0x40, 0x3, 0xff, 0xff, 0xff, 0x95, 0x58,
-    0xef, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x2, 0xbf,
-    0xff, 0xfd, 0x0, 0xaf, 0xff, 0xff, 0x40, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf3, 0xf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x72, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe9, 0x99, 0x99,
-    0x99, 0xbf, 0xff, 0xf9, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x0,
-    0x2f, 0xff, 0xff, 0xf9, 0x55, 0x7e, 0xff, 0xff,
-    0xff, 0xff, 0xd5, 0x10, 0x1, 0x37, 0xcf, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xec,
-    0x82, 0x0, 0x0, 0x6, 0xad, 0xff, 0xfe, 0xda,
-    0x61, 0x0,
-
-    /* U+0154 "Ŕ" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x99, 0x99, 0x99,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xee, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xfe, 0xda, 0x72, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xcf, 0xff,
-    0xfd, 0x77, 0x8a, 0xef, 0xff, 0xff, 0xf6, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0, 0xc,
-    0xff, 0xff, 0xd6, 0x67, 0x9e, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x2f, 0xff, 0xff, 0x60, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x4, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x60, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x20,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf6,
-
-    /* U+0155 "ŕ" */
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x55, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0,
-    0x1, 0x8d, 0xff, 0x80, 0x3f, 0xff, 0xf3, 0x5,
-    0xff, 0xff, 0xf7, 0x3, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xff, 0x60, 0x3f, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xf5, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x3f, 0xff, 0xff, 0xff, 0xb4, 0x10,
-    0x10, 0x3, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0156 "Ŗ" */
-    0xcf, 0xff, 0xff, 0xff, 0xfe, 0xda, 0x72, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xcf, 0xff, 0xfd, 0x77, 0x8a, 0xef,
-    0xff, 0xff, 0xf6, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xc0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf7, 0x0, 0xc, 0xff, 0xff, 0xd6, 0x67,
-    0x9e, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x2f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x8f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x60, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcc, 0xcc, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0157 "ŗ" */
-    0x3f, 0xff, 0xf0, 0x0, 0x18, 0xdf, 0xf8, 0x3f,
-    0xff, 0xf3, 0x5, 0xff, 0xff, 0xf7, 0x3f, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xb4,
-    0x10, 0x10, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xcc, 0xcc, 0x60, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0158 "Ř" */
-    0x3, 0x99, 0x96, 0x0, 0x0, 0x0, 0x29, 0x99,
-    0x80, 0x0, 0x0, 0xb, 0xff, 0xfb, 0x20, 0x0,
-    0x7f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfe, 0x41, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xef, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xee, 0xee, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xfe, 0xda, 0x72, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xcf, 0xff,
-    0xfd, 0x77, 0x8a, 0xef, 0xff, 0xff, 0xf6, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xb0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x0, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0, 0xc,
-    0xff, 0xff, 0xd6, 0x67, 0x9e, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0x2f, 0xff, 0xff, 0x60, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x4, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xcf, 0xff,
-    0xfb, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x60, 0xc, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x20,
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf6,
-
-    /* U+0159 "ř" */
-    0x4f, 0xff, 0xc2, 0x0, 0x0, 0x8, 0xff, 0xfa,
-    0x5, 0xff, 0xff, 0x70, 0x4, 0xef, 0xff, 0xb0,
-    0x0, 0x5f, 0xff, 0xfb, 0x7f, 0xff, 0xfb, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0x55, 0x55, 0x52, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x0, 0x1, 0x8d, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0x30, 0x5f, 0xff, 0xff, 0x70,
-    0x3, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60,
-    0x3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x50,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x3, 0xff, 0xff, 0xff, 0xfb, 0x41, 0x1, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+015A "Ś" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff, 0xfe,
-    0xa8, 0x9b, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x4, 0xab, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf6, 0x23, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf5, 0x5f, 0xc7, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xfd,
-    0xa8, 0x79, 0xdf, 0xff, 0xff, 0xd0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe, 0xc9, 0x40,
-    0x0, 0x0,
-
-    /* U+015B "ś" */
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0x55, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x38, 0xef, 0x10,
-    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x4f, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x23, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x5f, 0xd8, 0x41, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x2, 0x7b, 0xdf, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+015C "Ŝ" */
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x8, 0xff, 0xff, 0x72,
-    0xef, 0xff, 0xf2, 0x0, 0x0, 0x6f, 0xff, 0xf5,
-    0x0, 0x1c, 0xff, 0xfe, 0x10, 0x4, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff, 0xfe,
-    0xa8, 0x9b, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x4, 0xab, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf6, 0x23, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf5, 0x5f, 0xc7, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xfd,
-    0xa8, 0x79, 0xdf, 0xff, 0xff, 0xd0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe, 0xc9, 0x40,
-    0x0, 0x0,
-
-    /* U+015D "ŝ" */
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x4f, 0xff, 0xfd, 0xdf, 0xff, 0xf4, 0x0,
-    0x3, 0xff, 0xff, 0xa0, 0x1b, 0xff, 0xff, 0x30,
-    0x3f, 0xff, 0xe5, 0x0, 0x0, 0x6e, 0xff, 0xf4,
-    0x35, 0x55, 0x10, 0x0, 0x0, 0x1, 0x55, 0x53,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x38, 0xef, 0x10,
-    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x4f, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x23, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x5f, 0xd8, 0x41, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x2, 0x7b, 0xdf, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+015E "Ş" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff, 0xfe,
-    0xa8, 0x9b, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x4, 0xab, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5e,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf6, 0x22, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf5, 0x5f, 0xb5, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xfc,
-    0x97, 0x67, 0xcf, 0xff, 0xff, 0xd0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x37, 0xbd, 0xff, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfc, 0x81,
-    0x0, 0x0, 0x0,
-
-    /* U+015F "ş" */
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x38, 0xef, 0x10,
-    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x4f, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x21, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x5f, 0xb7, 0x30, 0x0, 0x4, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0xdd, 0xef, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x3, 0x8b, 0xdf, 0xff, 0xff, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x31, 0x4, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0xff, 0xda, 0x20, 0x0, 0x0,
-
-    /* U+0160 "Š" */
-    0x3, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x6f, 0xff,
-    0xd0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x1b, 0xff,
-    0xfe, 0x20, 0x0, 0x8, 0xff, 0xff, 0x82, 0xdf,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff, 0xfe,
-    0xa8, 0x9b, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x4, 0xab, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf6, 0x23, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf5, 0x5f, 0xc7, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xfd,
-    0xa8, 0x79, 0xdf, 0xff, 0xff, 0xd0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe, 0xc9, 0x40,
-    0x0, 0x0,
-
-    /* U+0161 "š" */
-    0x6f, 0xff, 0xa1, 0x0, 0x0, 0x1a, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0x50, 0x5, 0xff, 0xff, 0x90,
-    0x0, 0x8f, 0xff, 0xf9, 0x9f, 0xff, 0xf9, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0x55, 0x55, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x38, 0xef, 0x10,
-    0x5f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x4f, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x23, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x5f, 0xd8, 0x41, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x2, 0x7b, 0xdf, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+0162 "Ţ" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x28, 0x88, 0x88, 0x8a, 0xff, 0xff,
-    0xf9, 0x88, 0x88, 0x88, 0x10, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x20, 0xc, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xec, 0x70, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0163 "ţ" */
-    0x0, 0x0, 0x6, 0x88, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x42, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc5, 0x46, 0x96, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xdb, 0x71, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x30, 0x9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xfd, 0x81, 0x0, 0x0,
-
-    /* U+0164 "Ť" */
-    0x0, 0x8, 0x88, 0x60, 0x0, 0x0, 0x0, 0x68,
-    0x88, 0x10, 0x0, 0x0, 0x8f, 0xff, 0xd3, 0x0,
-    0x3, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf6, 0x7, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x28, 0x88,
-    0x88, 0x8a, 0xff, 0xff, 0xf9, 0x88, 0x88, 0x88,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0165 "ť" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x67, 0x75, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x5f, 0xff, 0x50, 0x0, 0x0, 0x8, 0xff,
-    0xfc, 0x0, 0x0, 0x6, 0xbb, 0x90, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x54, 0x69, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xef, 0xfd, 0xb7,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0166 "Ŧ" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x28, 0x88, 0x88, 0x8a, 0xff, 0xff,
-    0xf9, 0x88, 0x88, 0x88, 0x10, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x47,
-    0x77, 0x9f, 0xff, 0xff, 0x87, 0x77, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+0167 "ŧ" */
-    0x0, 0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x42, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x67, 0xcf, 0xff, 0xfd, 0x77,
-    0x77, 0x40, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc5, 0x46, 0x96, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x7,
-    0xce, 0xff, 0xdb, 0x71,
-
-    /* U+0168 "Ũ" */
-    0x0, 0x0, 0x0, 0x47, 0x83, 0x0, 0x0, 0x7,
-    0x87, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xc3, 0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xc9, 0xef, 0xf7, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
-    0x29, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x10, 0x0, 0x29, 0xef, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+0169 "ũ" */
-    0x0, 0x0, 0x3b, 0xef, 0xea, 0x62, 0x2, 0xdf,
-    0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x4, 0xff, 0xf9,
-    0x9c, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x39,
-    0x93, 0x0, 0x0, 0x47, 0x86, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff,
-    0xd0,
-
-    /* U+016A "Ū" */
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
-    0x60, 0xb, 0xff, 0xff, 0xff, 0xda, 0x99, 0xcf,
-    0xff, 0xff, 0xfe, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x7b, 0xef, 0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+016B "ū" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x1b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x2f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xd0,
-    0xff, 0xff, 0xff, 0xb5, 0x46, 0xcf, 0xff, 0xff,
-    0xfd, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9e, 0xff, 0xfd, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xaf, 0xff, 0xd0, 0x0, 0x7,
-    0xce, 0xff, 0xd9, 0x30, 0x6, 0xff, 0xfd,
-
-    /* U+016C "Ŭ" */
-    0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x30,
-    0x0, 0x28, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x8a, 0xbb, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+016D "ŭ" */
-    0x0, 0xe, 0xff, 0x72, 0x0, 0x1, 0x3a, 0xff,
-    0xc0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0xab, 0xb9, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff,
-    0xd0,
-
-    /* U+016E "Ů" */
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x76, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0x4, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0xdf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x8b,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8e, 0xfe, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60,
-    0xb, 0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff,
-    0xff, 0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b,
-    0xef, 0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+016F "ů" */
-    0x0, 0x0, 0x0, 0x0, 0x47, 0x73, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfa, 0x12, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x7, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x9f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xe8, 0x9f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xd2, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfd, 0xf,
-    0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff, 0xff, 0xff,
-    0xd0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0xef, 0xff, 0xd0, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xf9, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x7c,
-    0xef, 0xfd, 0x93, 0x0, 0x6f, 0xff, 0xd0,
-
-    /* U+0170 "Ű" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x16,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xf4, 0x1e, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe3, 0x5,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xfc, 0x10, 0x1e, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xcc, 0x90, 0x0, 0x6c, 0xc8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xeb, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+0171 "ű" */
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x2f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0xb, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf7, 0x6, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf5, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe3, 0x0,
-    0xbf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x3, 0xcc,
-    0xb1, 0x0, 0x3c, 0xca, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd0, 0x4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd,
-    0x0, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xd0, 0x4, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0x0, 0x4f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd0,
-    0x4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xd0, 0x4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x0,
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd0, 0x4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x4,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd0, 0x2, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfd, 0x0, 0xf,
-    0xff, 0xff, 0xfb, 0x54, 0x6c, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x7c, 0xef, 0xfd, 0x93, 0x0,
-    0x6f, 0xff, 0xd0, 0x0,
-
-    /* U+0172 "Ų" */
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf0, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x60, 0xb,
-    0xff, 0xff, 0xff, 0xda, 0x99, 0xcf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xe5, 0x46, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xea, 0x0,
-    0x0,
-
-    /* U+0173 "ų" */
-    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd4,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x4f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xd0, 0xff,
-    0xff, 0xff, 0xb5, 0x46, 0xcf, 0xff, 0xff, 0xfd,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9e, 0xff, 0xfd, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xaf, 0xff, 0xd0, 0x0, 0x7, 0xce,
-    0xff, 0xd9, 0x30, 0x7, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xa3, 0x54, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xdf, 0xfd, 0x50,
-
-    /* U+0174 "Ŵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68,
-    0x88, 0x88, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x4e, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xf9, 0x0, 0x1b,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe4, 0x0,
-    0x0, 0x6, 0xef, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xba, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf7, 0x6f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x31, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xe0, 0xd, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x60, 0x5, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0xff, 0xfa,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf2, 0x0, 0x1f,
-    0xff, 0xff, 0x10, 0x0, 0x1, 0xff, 0xff, 0xaf,
-    0xff, 0xe0, 0x0, 0x0, 0x4f, 0xff, 0xfe, 0x0,
-    0x0, 0xdf, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0xff, 0xff, 0x20, 0x0, 0x8, 0xff, 0xff,
-    0xa0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x9,
-    0xff, 0xfd, 0xf, 0xff, 0xf6, 0x0, 0x0, 0xcf,
-    0xff, 0xf6, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0,
-    0x0, 0xdf, 0xff, 0xa0, 0xdf, 0xff, 0xb0, 0x0,
-    0xf, 0xff, 0xff, 0x20, 0x0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xf6, 0xa, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x40, 0x6, 0xff, 0xff, 0x20, 0x6f,
-    0xff, 0xf3, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf7, 0x0, 0xaf, 0xff, 0xe0,
-    0x2, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xb0, 0xe, 0xff,
-    0xfa, 0x0, 0xe, 0xff, 0xfb, 0x0, 0xef, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x2,
-    0xff, 0xff, 0x60, 0x0, 0xaf, 0xff, 0xf0, 0x1f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf2, 0x5f, 0xff, 0xf2, 0x0, 0x5, 0xff, 0xff,
-    0x24, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x58, 0xff, 0xfe, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x7f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf8, 0xbf, 0xff, 0xa0, 0x0,
-    0x0, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xae, 0xff, 0xf6,
-    0x0, 0x0, 0x9, 0xff, 0xfb, 0xdf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x5f, 0xff, 0xef, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0,
-
-    /* U+0175 "ŵ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xf9, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xc2, 0x4, 0xef,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x8f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x11, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x10, 0xef, 0xff, 0xf5, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xc0, 0xa, 0xff, 0xff, 0x90, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xbf,
-    0xff, 0xf7, 0x0, 0x6f, 0xff, 0xfd, 0x0, 0x0,
-    0xaf, 0xff, 0xbf, 0xff, 0x70, 0x0, 0xf, 0xff,
-    0xff, 0x30, 0x1, 0xff, 0xff, 0xf1, 0x0, 0xe,
-    0xff, 0xf4, 0xff, 0xfb, 0x0, 0x4, 0xff, 0xff,
-    0xe0, 0x0, 0xd, 0xff, 0xff, 0x50, 0x2, 0xff,
-    0xfc, 0xf, 0xff, 0xf0, 0x0, 0x8f, 0xff, 0xfa,
-    0x0, 0x0, 0x8f, 0xff, 0xfa, 0x0, 0x6f, 0xff,
-    0x80, 0xcf, 0xff, 0x30, 0xc, 0xff, 0xff, 0x50,
-    0x0, 0x4, 0xff, 0xff, 0xe0, 0xa, 0xff, 0xf5,
-    0x8, 0xff, 0xf7, 0x0, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x10, 0xef, 0xff, 0x10,
-    0x5f, 0xff, 0xa0, 0x4f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf4, 0x1f, 0xff, 0xe0, 0x1,
-    0xff, 0xfe, 0x8, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x74, 0xff, 0xfa, 0x0, 0xe,
-    0xff, 0xf1, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfa, 0x7f, 0xff, 0x60, 0x0, 0xaf,
-    0xff, 0x3e, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xc9, 0xff, 0xf3, 0x0, 0x7, 0xff,
-    0xf6, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0xbf, 0xff, 0x0, 0x0, 0x3f, 0xff,
-    0xaf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfe, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xfe,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0,
-
-    /* U+0176 "Ŷ" */
-    0x0, 0x0, 0x0, 0x0, 0x99, 0x99, 0x99, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9,
-    0x4e, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf6, 0x0, 0x2c, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x3e, 0xee, 0xb2, 0x0, 0x0,
-    0x6, 0xee, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x33,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0xa, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x1, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0, 0xb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xb0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x30, 0xbf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xfb, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0177 "ŷ" */
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xfe, 0x9f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xfb, 0x10, 0x5e, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xe5, 0x0, 0x0,
-    0x19, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x11, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0x11, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x90, 0xa, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xff, 0x70,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x5, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50,
-    0x0, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf0, 0x4, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40,
-    0xaf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf9, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x8f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x57,
-    0xef, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xff, 0xda, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0178 "Ÿ" */
-    0x0, 0x0, 0x2, 0xcf, 0xd4, 0x0, 0x1b, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x10, 0xbf, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0,
-    0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7a, 0x81, 0x0, 0x6, 0xa9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0xaf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x20, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x9,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xa0, 0x0,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x30, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfb, 0x0, 0x3f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf3, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xb3, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0179 "Ź" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x88, 0x88,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x6, 0x77, 0x77, 0x77, 0x77, 0x77, 0x8f, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x87, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+017A "ź" */
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x1, 0x11,
-    0x11, 0x11, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-
-    /* U+017B "Ż" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x32, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xfe,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x6, 0x77, 0x77, 0x77, 0x77, 0x77, 0x8f, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x87, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+017C "ż" */
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x1, 0x11,
-    0x11, 0x11, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-
-    /* U+017D "Ž" */
-    0x0, 0x7, 0x88, 0x70, 0x0, 0x0, 0x0, 0x58,
-    0x88, 0x20, 0x0, 0x6, 0xff, 0xfe, 0x40, 0x0,
-    0x2b, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf8, 0x4, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xcf, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x6, 0x77, 0x77, 0x77, 0x77, 0x77, 0x8f, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x87, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+017E "ž" */
-    0x9, 0xff, 0xf9, 0x10, 0x0, 0x3, 0xcf, 0xff,
-    0x50, 0x9, 0xff, 0xfe, 0x50, 0x9, 0xff, 0xff,
-    0x50, 0x0, 0x9, 0xff, 0xff, 0x9c, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x11,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x1, 0x11,
-    0x11, 0x11, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-
-    /* U+017F "ſ" */
-    0x0, 0x3, 0x9c, 0xff, 0xfe, 0xc8, 0x20, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xf, 0xff, 0xff, 0xe6, 0x45, 0x85,
-    0x2, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 150, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 165, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 91, .adv_w = 272, .box_w = 13, .box_h = 10, .ofs_x = 2, .ofs_y = 16},
-    {.bitmap_index = 156, .adv_w = 372, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 455, .adv_w = 329, .box_w = 19, .box_h = 30, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 740, .adv_w = 519, .box_w = 31, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1143, .adv_w = 432, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1481, .adv_w = 153, .box_w = 6, .box_h = 10, .ofs_x = 2, .ofs_y = 16},
-    {.bitmap_index = 1511, .adv_w = 195, .box_w = 11, .box_h = 32, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 1687, .adv_w = 195, .box_w = 10, .box_h = 32, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 1847, .adv_w = 314, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 2009, .adv_w = 329, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2171, .adv_w = 164, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2207, .adv_w = 185, .box_w = 10, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 2232, .adv_w = 164, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2253, .adv_w = 238, .box_w = 15, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2448, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2695, .adv_w = 329, .box_w = 13, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2864, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3111, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3358, .adv_w = 329, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3618, .adv_w = 329, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3852, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4099, .adv_w = 329, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4359, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4606, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4853, .adv_w = 164, .box_w = 7, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4923, .adv_w = 164, .box_w = 8, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 5023, .adv_w = 329, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 5203, .adv_w = 329, .box_w = 18, .box_h = 11, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 5302, .adv_w = 329, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 5482, .adv_w = 275, .box_w = 17, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5703, .adv_w = 517, .box_w = 30, .box_h = 29, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 6138, .adv_w = 397, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6463, .adv_w = 387, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6723, .adv_w = 367, .box_w = 20, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6983, .adv_w = 426, .box_w = 22, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7269, .adv_w = 323, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7477, .adv_w = 316, .box_w = 15, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7672, .adv_w = 417, .box_w = 22, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7958, .adv_w = 441, .box_w = 22, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8244, .adv_w = 191, .box_w = 6, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8322, .adv_w = 191, .box_w = 12, .box_h = 33, .ofs_x = -3, .ofs_y = -7},
-    {.bitmap_index = 8520, .adv_w = 383, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8793, .adv_w = 325, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9014, .adv_w = 543, .box_w = 28, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9378, .adv_w = 468, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9690, .adv_w = 458, .box_w = 25, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10015, .adv_w = 362, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10249, .adv_w = 458, .box_w = 25, .box_h = 32, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 10649, .adv_w = 380, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10922, .adv_w = 317, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11156, .adv_w = 334, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11429, .adv_w = 435, .box_w = 22, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11715, .adv_w = 374, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12027, .adv_w = 557, .box_w = 35, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12482, .adv_w = 384, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12807, .adv_w = 359, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13106, .adv_w = 334, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13366, .adv_w = 191, .box_w = 10, .box_h = 32, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 13526, .adv_w = 238, .box_w = 15, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13721, .adv_w = 191, .box_w = 10, .box_h = 32, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 13881, .adv_w = 329, .box_w = 20, .box_h = 17, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 14051, .adv_w = 237, .box_w = 16, .box_h = 3, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 14075, .adv_w = 208, .box_w = 11, .box_h = 6, .ofs_x = 1, .ofs_y = 22},
-    {.bitmap_index = 14108, .adv_w = 348, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14298, .adv_w = 365, .box_w = 20, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14568, .adv_w = 296, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14738, .adv_w = 365, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14995, .adv_w = 340, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15185, .adv_w = 223, .box_w = 16, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15401, .adv_w = 325, .box_w = 20, .box_h = 29, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 15691, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15948, .adv_w = 176, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16043, .adv_w = 176, .box_w = 12, .box_h = 36, .ofs_x = -3, .ofs_y = -9},
-    {.bitmap_index = 16259, .adv_w = 357, .box_w = 21, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16543, .adv_w = 176, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16638, .adv_w = 566, .box_w = 31, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16948, .adv_w = 379, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17138, .adv_w = 357, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17338, .adv_w = 365, .box_w = 20, .box_h = 29, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 17628, .adv_w = 365, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 17904, .adv_w = 262, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18044, .adv_w = 286, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18204, .adv_w = 250, .box_w = 15, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18384, .adv_w = 379, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18574, .adv_w = 328, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18784, .adv_w = 493, .box_w = 31, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19094, .adv_w = 333, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19304, .adv_w = 328, .box_w = 21, .box_h = 29, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 19609, .adv_w = 281, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19779, .adv_w = 227, .box_w = 13, .box_h = 31, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 19981, .adv_w = 317, .box_w = 4, .box_h = 36, .ofs_x = 8, .ofs_y = -9},
-    {.bitmap_index = 20053, .adv_w = 227, .box_w = 13, .box_h = 31, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 20255, .adv_w = 329, .box_w = 18, .box_h = 8, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 20327, .adv_w = 150, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20327, .adv_w = 165, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 20422, .adv_w = 329, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20643, .adv_w = 329, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20890, .adv_w = 329, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 21052, .adv_w = 329, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21325, .adv_w = 317, .box_w = 4, .box_h = 36, .ofs_x = 8, .ofs_y = -9},
-    {.bitmap_index = 21397, .adv_w = 280, .box_w = 15, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21600, .adv_w = 350, .box_w = 13, .box_h = 5, .ofs_x = 4, .ofs_y = 22},
-    {.bitmap_index = 21633, .adv_w = 479, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22011, .adv_w = 221, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 13},
-    {.bitmap_index = 22096, .adv_w = 354, .box_w = 20, .box_h = 18, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 22276, .adv_w = 329, .box_w = 18, .box_h = 11, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 22375, .adv_w = 185, .box_w = 10, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 22400, .adv_w = 479, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22778, .adv_w = 288, .box_w = 20, .box_h = 4, .ofs_x = -1, .ofs_y = 27},
-    {.bitmap_index = 22818, .adv_w = 247, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 22896, .adv_w = 329, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23103, .adv_w = 218, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 15},
-    {.bitmap_index = 23201, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 23291, .adv_w = 208, .box_w = 11, .box_h = 6, .ofs_x = 1, .ofs_y = 22},
-    {.bitmap_index = 23324, .adv_w = 380, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 23600, .adv_w = 377, .box_w = 20, .box_h = 33, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 23930, .adv_w = 164, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 23951, .adv_w = 118, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = -9},
-    {.bitmap_index = 23992, .adv_w = 218, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 24067, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 13},
-    {.bitmap_index = 24145, .adv_w = 354, .box_w = 20, .box_h = 18, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 24325, .adv_w = 478, .box_w = 30, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24715, .adv_w = 503, .box_w = 31, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25118, .adv_w = 487, .box_w = 30, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25508, .adv_w = 275, .box_w = 18, .box_h = 27, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 25751, .adv_w = 397, .box_w = 25, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26176, .adv_w = 397, .box_w = 25, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26601, .adv_w = 397, .box_w = 25, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27026, .adv_w = 397, .box_w = 25, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27451, .adv_w = 397, .box_w = 25, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27864, .adv_w = 397, .box_w = 25, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28264, .adv_w = 548, .box_w = 33, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28693, .adv_w = 367, .box_w = 20, .box_h = 35, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 29043, .adv_w = 323, .box_w = 16, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29315, .adv_w = 323, .box_w = 16, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29587, .adv_w = 323, .box_w = 16, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29859, .adv_w = 323, .box_w = 16, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30123, .adv_w = 191, .box_w = 11, .box_h = 34, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 30310, .adv_w = 191, .box_w = 11, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30497, .adv_w = 191, .box_w = 16, .box_h = 34, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 30769, .adv_w = 191, .box_w = 13, .box_h = 33, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 30984, .adv_w = 426, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31309, .adv_w = 468, .box_w = 24, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31705, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32130, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32555, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32980, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33405, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33830, .adv_w = 329, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 33975, .adv_w = 458, .box_w = 25, .box_h = 29, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 34338, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 34712, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35086, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35460, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35834, .adv_w = 359, .box_w = 23, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36225, .adv_w = 362, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36459, .adv_w = 410, .box_w = 23, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36770, .adv_w = 348, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37027, .adv_w = 348, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37284, .adv_w = 348, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37541, .adv_w = 348, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37798, .adv_w = 348, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38055, .adv_w = 348, .box_w = 19, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38350, .adv_w = 528, .box_w = 31, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38660, .adv_w = 296, .box_w = 17, .box_h = 29, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 38907, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39164, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39421, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39678, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39935, .adv_w = 176, .box_w = 11, .box_h = 27, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 40084, .adv_w = 176, .box_w = 11, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40233, .adv_w = 176, .box_w = 17, .box_h = 27, .ofs_x = -3, .ofs_y = 0},
-    {.bitmap_index = 40463, .adv_w = 176, .box_w = 13, .box_h = 27, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 40639, .adv_w = 357, .box_w = 20, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40919, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 41176, .adv_w = 357, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41446, .adv_w = 357, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41716, .adv_w = 357, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41986, .adv_w = 357, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42256, .adv_w = 357, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42526, .adv_w = 329, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 42688, .adv_w = 357, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 42908, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43165, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43422, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43679, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43936, .adv_w = 328, .box_w = 21, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 44314, .adv_w = 365, .box_w = 20, .box_h = 36, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 44674, .adv_w = 328, .box_w = 21, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 45052, .adv_w = 397, .box_w = 25, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 45452, .adv_w = 348, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 45699, .adv_w = 397, .box_w = 25, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 46124, .adv_w = 348, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 46381, .adv_w = 397, .box_w = 25, .box_h = 35, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 46819, .adv_w = 348, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 47095, .adv_w = 367, .box_w = 20, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 47435, .adv_w = 296, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 47665, .adv_w = 367, .box_w = 20, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 48005, .adv_w = 296, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 48235, .adv_w = 367, .box_w = 20, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 48575, .adv_w = 296, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 48805, .adv_w = 367, .box_w = 20, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49145, .adv_w = 296, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 49388, .adv_w = 426, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 49762, .adv_w = 365, .box_w = 27, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50127, .adv_w = 426, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 50452, .adv_w = 374, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50749, .adv_w = 323, .box_w = 16, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 51005, .adv_w = 340, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 51252, .adv_w = 323, .box_w = 16, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 51524, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 51781, .adv_w = 323, .box_w = 16, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 52053, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 52310, .adv_w = 323, .box_w = 16, .box_h = 35, .ofs_x = 3, .ofs_y = -9},
-    {.bitmap_index = 52590, .adv_w = 340, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 52866, .adv_w = 323, .box_w = 16, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 53138, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53395, .adv_w = 417, .box_w = 22, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 53769, .adv_w = 325, .box_w = 20, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 54129, .adv_w = 417, .box_w = 22, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 54503, .adv_w = 325, .box_w = 20, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 54863, .adv_w = 417, .box_w = 22, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 55237, .adv_w = 325, .box_w = 20, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 55597, .adv_w = 417, .box_w = 22, .box_h = 34, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 55971, .adv_w = 325, .box_w = 20, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 56331, .adv_w = 441, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 56705, .adv_w = 379, .box_w = 24, .box_h = 36, .ofs_x = -3, .ofs_y = 0},
-    {.bitmap_index = 57137, .adv_w = 441, .box_w = 28, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 57501, .adv_w = 379, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 57785, .adv_w = 191, .box_w = 16, .box_h = 33, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 58049, .adv_w = 176, .box_w = 15, .box_h = 27, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 58252, .adv_w = 191, .box_w = 12, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 58444, .adv_w = 176, .box_w = 13, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 58613, .adv_w = 191, .box_w = 14, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 58851, .adv_w = 176, .box_w = 15, .box_h = 27, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 59054, .adv_w = 191, .box_w = 8, .box_h = 35, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 59194, .adv_w = 176, .box_w = 8, .box_h = 36, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 59338, .adv_w = 191, .box_w = 6, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 59440, .adv_w = 176, .box_w = 7, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 59510, .adv_w = 381, .box_w = 18, .box_h = 34, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 59816, .adv_w = 351, .box_w = 18, .box_h = 36, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 60140, .adv_w = 191, .box_w = 17, .box_h = 41, .ofs_x = -3, .ofs_y = -7},
-    {.bitmap_index = 60489, .adv_w = 176, .box_w = 17, .box_h = 36, .ofs_x = -3, .ofs_y = -9},
-    {.bitmap_index = 60795, .adv_w = 383, .box_w = 21, .box_h = 34, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 61152, .adv_w = 357, .box_w = 21, .box_h = 35, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 61520, .adv_w = 357, .box_w = 21, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 61730, .adv_w = 325, .box_w = 18, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 62036, .adv_w = 176, .box_w = 11, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 62234, .adv_w = 325, .box_w = 17, .box_h = 34, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 62523, .adv_w = 176, .box_w = 7, .box_h = 35, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 62646, .adv_w = 325, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 62880, .adv_w = 176, .box_w = 14, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 63069, .adv_w = 325, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 63290, .adv_w = 208, .box_w = 13, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 63466, .adv_w = 325, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 63726, .adv_w = 176, .box_w = 13, .box_h = 27, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 63902, .adv_w = 468, .box_w = 24, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 64310, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 64567, .adv_w = 468, .box_w = 24, .box_h = 34, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 64975, .adv_w = 379, .box_w = 19, .box_h = 28, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 65241, .adv_w = 468, .box_w = 24, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 65649, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 65906, .adv_w = 444, .box_w = 26, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66244, .adv_w = 468, .box_w = 24, .box_h = 34, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 66652, .adv_w = 379, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 66928, .adv_w = 458, .box_w = 25, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 67328, .adv_w = 357, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 67588, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 68013, .adv_w = 357, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 68283, .adv_w = 458, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 68708, .adv_w = 357, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 68992, .adv_w = 561, .box_w = 31, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 69395, .adv_w = 563, .box_w = 33, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 69725, .adv_w = 380, .box_w = 21, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 70082, .adv_w = 262, .box_w = 15, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 70285, .adv_w = 380, .box_w = 21, .box_h = 34, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 70642, .adv_w = 262, .box_w = 14, .box_h = 28, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 70838, .adv_w = 380, .box_w = 21, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 71195, .adv_w = 262, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 71411, .adv_w = 317, .box_w = 18, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 71717, .adv_w = 286, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 71933, .adv_w = 317, .box_w = 18, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 72239, .adv_w = 286, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 72455, .adv_w = 317, .box_w = 18, .box_h = 35, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 72770, .adv_w = 286, .box_w = 16, .box_h = 29, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 73002, .adv_w = 317, .box_w = 18, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 73308, .adv_w = 286, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 73524, .adv_w = 334, .box_w = 21, .box_h = 35, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 73892, .adv_w = 250, .box_w = 15, .box_h = 33, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 74140, .adv_w = 334, .box_w = 21, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 74497, .adv_w = 250, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 74781, .adv_w = 334, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 75054, .adv_w = 250, .box_w = 15, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 75234, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 75608, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 75865, .adv_w = 435, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 76217, .adv_w = 379, .box_w = 19, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 76464, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 76838, .adv_w = 379, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 77095, .adv_w = 435, .box_w = 22, .box_h = 37, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 77502, .adv_w = 379, .box_w = 19, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 77797, .adv_w = 435, .box_w = 22, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 78171, .adv_w = 379, .box_w = 21, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 78455, .adv_w = 435, .box_w = 22, .box_h = 35, .ofs_x = 3, .ofs_y = -9},
-    {.bitmap_index = 78840, .adv_w = 379, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 79116, .adv_w = 557, .box_w = 35, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 79711, .adv_w = 493, .box_w = 31, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 80130, .adv_w = 359, .box_w = 23, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 80521, .adv_w = 328, .box_w = 21, .box_h = 36, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 80899, .adv_w = 359, .box_w = 23, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 81279, .adv_w = 334, .box_w = 20, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 81619, .adv_w = 281, .box_w = 17, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 81849, .adv_w = 334, .box_w = 20, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 82189, .adv_w = 281, .box_w = 17, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 82419, .adv_w = 334, .box_w = 20, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 82759, .adv_w = 281, .box_w = 17, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 82989, .adv_w = 221, .box_w = 13, .box_h = 27, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
 
 
 
@@ -11530,11 +516,19 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 1, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 37, .range_length = 1, .glyph_id_start = 2,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 43, .range_length = 15, .glyph_id_start = 3,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 160, .range_length = 224, .glyph_id_start = 96,
+        .range_start = 126, .range_length = 1, .glyph_id_start = 18,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     }
 };
@@ -11560,7 +554,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 2,
+    .cmap_num = 4,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
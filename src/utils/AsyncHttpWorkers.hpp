@@ -0,0 +1,217 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_http_server.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <RemoteLogger.hpp>
+#include "Metrics.hpp"
+
+/**
+ * Small worker pool for long-running HTTP handlers (screenshot, live stream,
+ * trace export).
+ *
+ * httpd has a single server task, so one slow response used to block every
+ * other request including /api/data. Routes registered through this pool
+ * detach the request with httpd_req_async_handler_begin() and run the real
+ * handler on a worker task, the server task returns immediately.
+ *
+ * Every route has a limit of in-flight requests and a memory budget - the
+ * minimum largest free internal block required to accept the request.
+ * Requests over either limit are answered with 503 right away.
+ */
+
+#define ASYNC_HTTP_WORKERS 2
+#define ASYNC_HTTP_QUEUE_LENGTH 4
+#define ASYNC_HTTP_WORKER_STACK_SIZE 6144
+
+typedef struct
+{
+    const char *name;
+    esp_err_t (*handler)(httpd_req_t *req);
+    void *userCtx;          // passed to handler as req->user_ctx
+    uint8_t maxInFlight;    // queued + running
+    uint32_t memoryBudget;  // bytes of contiguous internal RAM the handler needs
+    volatile uint8_t inFlight;
+    char labels[32];        // metric labels, must outlive the registry entry
+    MetricCounter *rejected;
+} AsyncHttpRoute_t;
+
+class AsyncHttpWorkers
+{
+public:
+    static AsyncHttpWorkers &instance()
+    {
+        static AsyncHttpWorkers inst;
+        return inst;
+    }
+
+    /**
+     * Create the queue and worker tasks. Safe to call repeatedly.
+     */
+    bool begin()
+    {
+        if (queue != nullptr)
+        {
+            return true;
+        }
+        queue = xQueueCreate(ASYNC_HTTP_QUEUE_LENGTH, sizeof(Job_t));
+        if (queue == nullptr)
+        {
+            LOGE("[AsyncHttp] Failed to create queue");
+            return false;
+        }
+        for (int i = 0; i < ASYNC_HTTP_WORKERS; i++)
+        {
+            char name[16];
+            snprintf(name, sizeof(name), "httpWorker%d", i);
+            if (xTaskCreatePinnedToCore(workerTask, name, ASYNC_HTTP_WORKER_STACK_SIZE, this, 5, NULL, 0) != pdPASS)
+            {
+                LOGE("[AsyncHttp] Failed to start %s", name);
+                return i > 0;
+            }
+        }
+        LOGI("[AsyncHttp] %d workers started", ASYNC_HTTP_WORKERS);
+        return true;
+    }
+
+    /**
+     * Fill route and return uri descriptor dispatching to the pool.
+     */
+    static httpd_uri_t uri(const char *path, AsyncHttpRoute_t *route, const char *name,
+                           esp_err_t (*handler)(httpd_req_t *), void *userCtx, uint8_t maxInFlight, uint32_t memoryBudget)
+    {
+        route->name = name;
+        route->handler = handler;
+        route->userCtx = userCtx;
+        route->maxInFlight = maxInFlight;
+        route->memoryBudget = memoryBudget;
+        route->inFlight = 0;
+        if (route->rejected == nullptr)
+        {
+            snprintf(route->labels, sizeof(route->labels), "route=\"%s\"", name);
+            route->rejected = Metrics::instance().counter("http_async_rejected_total", "Requests rejected by async worker limits", route->labels);
+        }
+        httpd_uri_t uri = {
+            .uri = path,
+            .method = HTTP_GET,
+            .handler = dispatch,
+            .user_ctx = route};
+        return uri;
+    }
+
+    /**
+     * Wait until no request is queued or running, e.g. before httpd_stop().
+     */
+    bool drain(uint32_t timeoutMs)
+    {
+        unsigned long start = millis();
+        while (totalInFlight > 0)
+        {
+            if (millis() - start > timeoutMs)
+            {
+                LOGW("[AsyncHttp] %d requests still running", totalInFlight);
+                return false;
+            }
+            vTaskDelay(pdMS_TO_TICKS(20));
+        }
+        return true;
+    }
+
+private:
+    typedef struct
+    {
+        httpd_req_t *req;
+        AsyncHttpRoute_t *route;
+    } Job_t;
+
+    QueueHandle_t queue = nullptr;
+    volatile uint8_t totalInFlight = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    AsyncHttpWorkers() {}
+
+    static esp_err_t reject(httpd_req_t *req, AsyncHttpRoute_t *route, const char *reason)
+    {
+        route->rejected->inc();
+        LOGW("[AsyncHttp] %s rejected: %s", route->name, reason);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "2");
+        return httpd_resp_send(req, reason, HTTPD_RESP_USE_STRLEN);
+    }
+
+    static esp_err_t dispatch(httpd_req_t *req)
+    {
+        AsyncHttpWorkers &self = instance();
+        AsyncHttpRoute_t *route = (AsyncHttpRoute_t *)req->user_ctx;
+
+        if (self.queue == nullptr)
+        {
+            // Pool not available - serve synchronously as before
+            req->user_ctx = route->userCtx;
+            return route->handler(req);
+        }
+        if (heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL) < route->memoryBudget)
+        {
+            return reject(req, route, "Low memory");
+        }
+
+        portENTER_CRITICAL(&self.lock);
+        bool accepted = route->inFlight < route->maxInFlight;
+        if (accepted)
+        {
+            route->inFlight++;
+            self.totalInFlight++;
+        }
+        portEXIT_CRITICAL(&self.lock);
+        if (!accepted)
+        {
+            return reject(req, route, "Too many requests");
+        }
+
+        Job_t job = {nullptr, route};
+        if (httpd_req_async_handler_begin(req, &job.req) != ESP_OK)
+        {
+            self.release(route);
+            return reject(req, route, "Async start failed");
+        }
+        job.req->user_ctx = route->userCtx;
+        if (xQueueSend(self.queue, &job, 0) != pdTRUE)
+        {
+            // Answer on the detached copy, the original is owned by httpd now
+            reject(job.req, route, "Queue full");
+            httpd_req_async_handler_complete(job.req);
+            self.release(route);
+            return ESP_OK;
+        }
+        return ESP_OK;
+    }
+
+    void release(AsyncHttpRoute_t *route)
+    {
+        portENTER_CRITICAL(&lock);
+        route->inFlight--;
+        totalInFlight--;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    static void workerTask(void *param)
+    {
+        AsyncHttpWorkers *self = (AsyncHttpWorkers *)param;
+        Job_t job;
+        for (;;)
+        {
+            if (xQueueReceive(self->queue, &job, portMAX_DELAY) != pdTRUE)
+            {
+                continue;
+            }
+            unsigned long start = millis();
+            job.route->handler(job.req);
+            httpd_req_async_handler_complete(job.req);
+            self->release(job.route);
+            LOGD("[AsyncHttp] %s done in %lu ms", job.route->name, millis() - start);
+        }
+    }
+};
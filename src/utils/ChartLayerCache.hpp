@@ -0,0 +1,267 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_heap_caps.h>
+#include <RemoteLogger.hpp>
+
+/**
+ * Offscreen PSRAM layer for an expensive-to-draw widget (charts).
+ *
+ * The painter renders the widget once into an opaque buffer, pre-filled with
+ * the effective background color below it. Later redraws - e.g. caused by an
+ * animation overlapping the chart - only blit the buffer, clipped to the
+ * rounded shape of clipObj.
+ *
+ * The layer is rebuilt outside of rendering (lv_async_call) when the owner
+ * called invalidate() or the widget moved/resized. Until then the caller
+ * draws the widget directly, as without the cache.
+ */
+class ChartLayerCache
+{
+public:
+    /** Draws obj (or its custom content) into drawCtx, in screen coordinates. */
+    typedef void (*Painter_t)(lv_draw_ctx_t *drawCtx, lv_obj_t *obj);
+
+    ~ChartLayerCache()
+    {
+        release();
+    }
+
+    /**
+     * @param obj widget whose drawing is cached
+     * @param painter renders obj into the layer
+     * @param clipObj layer is limited to coords and radius of this object (obj itself or its parent)
+     */
+    void attach(lv_obj_t *obj, Painter_t painter, lv_obj_t *clipObj)
+    {
+        release();
+        this->obj = obj;
+        this->painter = painter;
+        this->clipObj = clipObj;
+        // Widgets are recreated with every show(), drop the buffer with them
+        lv_obj_add_event_cb(obj, onDelete, LV_EVENT_DELETE, this);
+    }
+
+    /**
+     * Content changed (new data, quarter, theme) - rebuild on next draw.
+     */
+    void invalidate()
+    {
+        valid = false;
+    }
+
+    /**
+     * True while the painter renders into the layer. Live-only decorations
+     * (current time marker) must not be drawn then.
+     */
+    bool isRendering() const
+    {
+        return rendering;
+    }
+
+    /**
+     * Blit the layer. Returns false if it is not up to date - the caller then
+     * draws directly and a rebuild is scheduled.
+     */
+    bool draw(lv_draw_ctx_t *drawCtx)
+    {
+        if (obj == nullptr || rendering)
+        {
+            return false;
+        }
+        lv_area_t area;
+        if (!getArea(&area))
+        {
+            return false;
+        }
+        if (!valid || buffer == nullptr || memcmp(&area, &bufferArea, sizeof(lv_area_t)) != 0)
+        {
+            // Don't rebuild every frame while the widget is being resized (expand animation)
+            if (memcmp(&area, &lastSeenArea, sizeof(lv_area_t)) == 0)
+            {
+                requestRebuild();
+            }
+            lastSeenArea = area;
+            return false;
+        }
+
+        lv_area_t clip;
+        if (!_lv_area_intersect(&clip, drawCtx->clip_area, &area))
+        {
+            return true;
+        }
+
+        lv_img_dsc_t img;
+        memset(&img, 0, sizeof(img));
+        img.header.cf = LV_IMG_CF_TRUE_COLOR;
+        img.header.w = lv_area_get_width(&area);
+        img.header.h = lv_area_get_height(&area);
+        img.data_size = img.header.w * img.header.h * sizeof(lv_color_t);
+        img.data = (const uint8_t *)buffer;
+
+        lv_draw_img_dsc_t imgDsc;
+        lv_draw_img_dsc_init(&imgDsc);
+
+        lv_draw_mask_radius_param_t maskParam;
+        int16_t maskId = LV_MASK_ID_INV;
+        lv_coord_t radius = lv_obj_get_style_radius(clipObj, LV_PART_MAIN);
+        if (radius > 0)
+        {
+            lv_draw_mask_radius_init(&maskParam, &clipObj->coords, radius, false);
+            maskId = lv_draw_mask_add(&maskParam, NULL);
+        }
+
+        const lv_area_t *clipOri = drawCtx->clip_area;
+        drawCtx->clip_area = &clip;
+        lv_draw_img(drawCtx, &imgDsc, &area, &img);
+        drawCtx->clip_area = clipOri;
+
+        if (maskId != LV_MASK_ID_INV)
+        {
+            lv_draw_mask_free_param(&maskParam);
+            lv_draw_mask_remove_id(maskId);
+        }
+        return true;
+    }
+
+private:
+    lv_obj_t *obj = nullptr;
+    lv_obj_t *clipObj = nullptr;
+    Painter_t painter = nullptr;
+    lv_color_t *buffer = nullptr;
+    size_t bufferSize = 0;
+    lv_area_t bufferArea = {0, 0, 0, 0};
+    lv_area_t lastSeenArea = {0, 0, 0, 0};
+    bool valid = false;
+    bool rendering = false;
+    bool rebuildPending = false;
+
+    bool getArea(lv_area_t *area)
+    {
+        lv_coord_t ext = _lv_obj_get_ext_draw_size(obj);
+        lv_area_t objArea = obj->coords;
+        lv_area_increase(&objArea, ext, ext);
+        return _lv_area_intersect(area, &objArea, &clipObj->coords);
+    }
+
+    /**
+     * Color visible below obj, blending opacities from the screen down.
+     */
+    lv_color_t getBackgroundColor()
+    {
+        lv_obj_t *chain[16];
+        int depth = 0;
+        for (lv_obj_t *o = obj; o != nullptr && depth < 16; o = lv_obj_get_parent(o))
+        {
+            chain[depth++] = o;
+        }
+        lv_color_t color = lv_color_black();
+        for (int i = depth - 1; i >= 0; i--)
+        {
+            lv_opa_t opa = lv_obj_get_style_bg_opa(chain[i], LV_PART_MAIN);
+            color = lv_color_mix(lv_obj_get_style_bg_color(chain[i], LV_PART_MAIN), color, opa);
+        }
+        return color;
+    }
+
+    void requestRebuild()
+    {
+        if (rebuildPending)
+        {
+            return;
+        }
+        rebuildPending = true;
+        lv_async_call(onAsyncRebuild, this);
+    }
+
+    static void onAsyncRebuild(void *param)
+    {
+        ChartLayerCache *self = (ChartLayerCache *)param;
+        self->rebuildPending = false;
+        if (self->obj != nullptr && self->rebuild())
+        {
+            lv_obj_invalidate(self->obj);
+        }
+    }
+
+    bool rebuild()
+    {
+        lv_area_t area;
+        if (!getArea(&area))
+        {
+            return false;
+        }
+        size_t size = (size_t)lv_area_get_size(&area) * sizeof(lv_color_t);
+        if (size != bufferSize)
+        {
+            if (buffer != nullptr)
+            {
+                heap_caps_free(buffer);
+            }
+            buffer = (lv_color_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+            bufferSize = buffer != nullptr ? size : 0;
+            if (buffer == nullptr)
+            {
+                LOGE("[ChartLayerCache] Failed to allocate %u bytes", (unsigned)size);
+                return false;
+            }
+        }
+        lv_color_fill(buffer, getBackgroundColor(), lv_area_get_size(&area));
+        bufferArea = area;
+
+        // Same setup as lv_snapshot: a fake display whose draw buffer is the layer
+        lv_disp_t *disp = lv_obj_get_disp(obj);
+        lv_disp_drv_t driver;
+        lv_disp_drv_init(&driver);
+        driver.hor_res = lv_disp_get_hor_res(disp);
+        driver.ver_res = lv_disp_get_ver_res(disp);
+
+        lv_disp_t fakeDisp;
+        lv_memset_00(&fakeDisp, sizeof(lv_disp_t));
+        fakeDisp.driver = &driver;
+
+        lv_draw_ctx_t *drawCtx = (lv_draw_ctx_t *)lv_mem_alloc(disp->driver->draw_ctx_size);
+        if (drawCtx == nullptr)
+        {
+            return false;
+        }
+        disp->driver->draw_ctx_init(fakeDisp.driver, drawCtx);
+        driver.draw_ctx = drawCtx;
+        lv_area_t clip = area;
+        drawCtx->clip_area = &clip;
+        drawCtx->buf_area = &bufferArea;
+        drawCtx->buf = (void *)buffer;
+
+        lv_disp_t *refreshing = _lv_refr_get_disp_refreshing();
+        _lv_refr_set_disp_refreshing(&fakeDisp);
+        rendering = true;
+        painter(drawCtx, obj);
+        rendering = false;
+        _lv_refr_set_disp_refreshing(refreshing);
+
+        disp->driver->draw_ctx_deinit(fakeDisp.driver, drawCtx);
+        lv_mem_free(drawCtx);
+
+        valid = true;
+        return true;
+    }
+
+    void release()
+    {
+        if (buffer != nullptr)
+        {
+            heap_caps_free(buffer);
+            buffer = nullptr;
+        }
+        bufferSize = 0;
+        valid = false;
+        obj = nullptr;
+        clipObj = nullptr;
+    }
+
+    static void onDelete(lv_event_t *e)
+    {
+        ((ChartLayerCache *)lv_event_get_user_data(e))->release();
+    }
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../Inverters/InverterResult.hpp"
+#include "../Shelly/Shelly.hpp"
+#include "../Wallbox/WallboxResult.hpp"
+#include "../Spot/ElectricityPriceResult.hpp"
+
+/**
+ * Groups of dashboard widgets, each refreshed only when one of its inputs
+ * changed since the last applied update.
+ */
+typedef enum : uint32_t
+{
+    DASHBOARD_DIRTY_PV = 1 << 0,          // pv1..4 power
+    DASHBOARD_DIRTY_INVERTER = 1 << 1,    // inverter output per phase
+    DASHBOARD_DIRTY_GRID = 1 << 2,        // grid power per phase
+    DASHBOARD_DIRTY_LOAD = 1 << 3,        // load power
+    DASHBOARD_DIRTY_BATTERY = 1 << 4,     // battery power, SOC, limits, presence
+    DASHBOARD_DIRTY_TEMPERATURE = 1 << 5, // inverter and battery temperature
+    DASHBOARD_DIRTY_ENERGY = 1 << 6,      // daily and total energy counters
+    DASHBOARD_DIRTY_STATUS = 1 << 7,      // dongle status, SN, FW version, Wi-Fi signal
+    DASHBOARD_DIRTY_SHELLY = 1 << 8,
+    DASHBOARD_DIRTY_WALLBOX = 1 << 9,
+    DASHBOARD_DIRTY_PRICES = 1 << 10,     // new spot price data
+    DASHBOARD_DIRTY_QUARTER = 1 << 11,    // current price quarter moved
+    DASHBOARD_DIRTY_THEME = 1 << 12,      // dark mode switched
+    DASHBOARD_DIRTY_ALL = 0xFFFFFFFF
+} DashboardDirty_t;
+
+/**
+ * Diffs incoming data against the snapshot that was last applied to the
+ * widgets. The previous* structs passed to DashboardUI::update() can't be used
+ * for this - the caller sometimes passes the current data as previous to skip
+ * animations.
+ */
+class DashboardChangeTracker
+{
+public:
+    /**
+     * Next diff returns DASHBOARD_DIRTY_ALL, e.g. after widgets were recreated.
+     */
+    void invalidateAll()
+    {
+        forceAll = true;
+    }
+
+    uint32_t diff(const InverterData_t &inverter, const ShellyResult_t &shelly, const WallboxResult_t &wallbox,
+                  const ElectricityPriceTwoDays_t &prices, int wifiSignalPercent, bool darkMode, int quarter)
+    {
+        uint32_t dirty = 0;
+        const InverterData_t &last = lastInverter;
+
+        if (inverter.pv1Power != last.pv1Power || inverter.pv2Power != last.pv2Power ||
+            inverter.pv3Power != last.pv3Power || inverter.pv4Power != last.pv4Power)
+        {
+            dirty |= DASHBOARD_DIRTY_PV;
+        }
+        if (inverter.inverterOutpuPowerL1 != last.inverterOutpuPowerL1 || inverter.inverterOutpuPowerL2 != last.inverterOutpuPowerL2 ||
+            inverter.inverterOutpuPowerL3 != last.inverterOutpuPowerL3)
+        {
+            dirty |= DASHBOARD_DIRTY_INVERTER;
+        }
+        if (inverter.gridPowerL1 != last.gridPowerL1 || inverter.gridPowerL2 != last.gridPowerL2 || inverter.gridPowerL3 != last.gridPowerL3)
+        {
+            dirty |= DASHBOARD_DIRTY_GRID;
+        }
+        if (inverter.loadPower != last.loadPower)
+        {
+            dirty |= DASHBOARD_DIRTY_LOAD;
+        }
+        if (inverter.batteryPower != last.batteryPower || inverter.soc != last.soc || inverter.socApproximated != last.socApproximated ||
+            inverter.minSoc != last.minSoc || inverter.maxSoc != last.maxSoc || inverter.batteryCapacityWh != last.batteryCapacityWh ||
+            inverter.hasBattery != last.hasBattery)
+        {
+            dirty |= DASHBOARD_DIRTY_BATTERY;
+        }
+        if (inverter.inverterTemperature != last.inverterTemperature || inverter.batteryTemperature != last.batteryTemperature)
+        {
+            dirty |= DASHBOARD_DIRTY_TEMPERATURE;
+        }
+        if (inverter.pvToday != last.pvToday || inverter.pvTotal != last.pvTotal ||
+            inverter.gridSellToday != last.gridSellToday || inverter.gridBuyToday != last.gridBuyToday ||
+            inverter.batteryChargedToday != last.batteryChargedToday || inverter.batteryDischargedToday != last.batteryDischargedToday ||
+            inverter.loadToday != last.loadToday)
+        {
+            dirty |= DASHBOARD_DIRTY_ENERGY;
+        }
+        if (inverter.status != last.status || inverter.sn != last.sn || inverter.dongleFWVersion != last.dongleFWVersion ||
+            wifiSignalPercent != lastWifiSignalPercent)
+        {
+            dirty |= DASHBOARD_DIRTY_STATUS;
+        }
+        if (shelly.pairedCount != lastShelly.pairedCount || shelly.activeCount != lastShelly.activeCount ||
+            shelly.maxPercent != lastShelly.maxPercent || shelly.totalPower != lastShelly.totalPower)
+        {
+            dirty |= DASHBOARD_DIRTY_SHELLY;
+        }
+        if (wallbox.updated != lastWallbox.updated || wallbox.type != lastWallbox.type || wallbox.evConnected != lastWallbox.evConnected ||
+            wallbox.chargingPower != lastWallbox.chargingPower || wallbox.chargingControlEnabled != lastWallbox.chargingControlEnabled ||
+            wallbox.chargedEnergy != lastWallbox.chargedEnergy || wallbox.totalChargedEnergy != lastWallbox.totalChargedEnergy ||
+            wallbox.temperature != lastWallbox.temperature)
+        {
+            dirty |= DASHBOARD_DIRTY_WALLBOX;
+        }
+        if (prices.updated != lastPricesUpdated)
+        {
+            dirty |= DASHBOARD_DIRTY_PRICES;
+        }
+        if (quarter != lastQuarter)
+        {
+            dirty |= DASHBOARD_DIRTY_QUARTER;
+        }
+        if (darkMode != lastDarkMode)
+        {
+            dirty |= DASHBOARD_DIRTY_THEME;
+        }
+
+        if (forceAll)
+        {
+            dirty = DASHBOARD_DIRTY_ALL;
+            forceAll = false;
+        }
+
+        lastInverter = inverter;
+        lastShelly = shelly;
+        lastWallbox = wallbox;
+        lastPricesUpdated = prices.updated;
+        lastWifiSignalPercent = wifiSignalPercent;
+        lastQuarter = quarter;
+        lastDarkMode = darkMode;
+        return dirty;
+    }
+
+private:
+    bool forceAll = true;
+    InverterData_t lastInverter;
+    ShellyResult_t lastShelly;
+    WallboxResult_t lastWallbox;
+    time_t lastPricesUpdated = 0;
+    int lastWifiSignalPercent = -1;
+    int lastQuarter = -1;
+    bool lastDarkMode = false;
+};
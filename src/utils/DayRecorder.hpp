@@ -0,0 +1,280 @@
+#pragma once
+
+#include <Arduino.h>
+#include <SolarIntelligence.h>
+#include <RemoteLogger.hpp>
+#include <esp_heap_caps.h>
+#include <time.h>
+#include "IntelligenceWorker.hpp"
+#include "../Spot/ElectricityPriceResult.hpp"
+
+/**
+ * What happened in one quarter next to what the plan expected for it.
+ */
+typedef struct RecordedQuarter
+{
+    uint16_t samples;               // 0 = no inverter data in this quarter
+    float pvWh;
+    float loadWh;
+    float gridBuyWh;
+    float gridSellWh;
+    int8_t soc;                     // average, -1 without samples
+    float spotPrice;                // NAN without prices
+    float buyPrice;                 // tariff in force when the quarter ended, NAN without prices
+    float sellPrice;
+    SolarInverterMode_t plannedMode; // decision of the last plan simulated before the quarter ended
+    float plannedPvWh;
+    float plannedLoadWh;
+    int8_t plannedSoc;              // -1 without a plan
+} RecordedQuarter_t;
+
+typedef struct RecordedDay
+{
+    uint32_t date; // YYYYMMDD, 0 = nothing recorded
+    RecordedQuarter_t quarters[QUARTERS_OF_DAY];
+} RecordedDay_t;
+
+/**
+ * Per-quarter record of today and yesterday for evaluating the battery
+ * strategy offline.
+ *
+ * The main loop feeds inverter samples and published plans; a quarter
+ * keeps the measured PV, load, grid energy and SOC, the spot price and
+ * what the last plan before its end expected. Exported as CSV at
+ * /history.csv, scripts/backtest.py turns collected exports into actual
+ * versus planned cost and per-quarter decisions.
+ *
+ * Buy and sell prices are stored with the quarter, so a later tariff
+ * change doesn't rewrite the cost of past days.
+ *
+ * Held in PSRAM only, a reboot loses the days. Only two days are kept:
+ * evaluating more of them depends on fetching yesterday every day. The
+ * main loop writes rows under a spinlock, the export copies each row under
+ * it before formatting.
+ */
+class DayRecorder
+{
+public:
+    static DayRecorder &instance()
+    {
+        static DayRecorder inst;
+        return inst;
+    }
+
+    /**
+     * Add an inverter sample to the current quarter.
+     * @param gridPowerW positive when selling
+     * @param settings tariff for the buy and sell price of the quarter
+     */
+    void addSample(int pvPowerW, int loadPowerW, int gridPowerW, int soc, const ElectricityPriceTwoDays_t *prices,
+                   const SolarIntelligenceSettings_t &settings)
+    {
+        if (!ensureAllocated())
+        {
+            return;
+        }
+        time_t now = time(nullptr);
+        struct tm t;
+        localtime_r(&now, &t);
+        if (t.tm_year < 100)
+        {
+            return; // no valid time yet
+        }
+        uint32_t date = (t.tm_year + 1900) * 10000 + (t.tm_mon + 1) * 100 + t.tm_mday;
+        int quarter = (t.tm_hour * 60 + t.tm_min) / 15;
+
+        if (date != days[today]->date)
+        {
+            rollover(date);
+        }
+        if (quarter != currentQuarter)
+        {
+            finishQuarter();
+            currentQuarter = quarter;
+            pvSum = loadSum = buySum = sellSum = socSum = 0;
+            sampleCount = 0;
+        }
+
+        pvSum += pvPowerW;
+        loadSum += loadPowerW;
+        buySum += gridPowerW < 0 ? -gridPowerW : 0;
+        sellSum += gridPowerW > 0 ? gridPowerW : 0;
+        socSum += soc;
+        sampleCount++;
+        currentPrice = prices != nullptr && prices->updated > 0 ? prices->prices[quarter].electricityPrice : NAN;
+        currentBuyPrice = isnan(currentPrice) ? NAN : calculateBuyPrice(currentPrice, settings);
+        currentSellPrice = isnan(currentPrice) ? NAN : calculateSellPrice(currentPrice, settings);
+    }
+
+    /**
+     * Remember what a freshly published plan expects for the quarters of
+     * today that are not finished yet.
+     */
+    void setPlan(const IntelligencePlan_t &plan)
+    {
+        if (!ensureAllocated() || days[today]->date == 0)
+        {
+            return;
+        }
+        int from = max(plan.firstQuarter, max(currentQuarter, 0));
+        for (int q = from; q < QUARTERS_OF_DAY; q++)
+        {
+            RecordedQuarter_t &r = days[today]->quarters[q];
+            portENTER_CRITICAL(&lock);
+            r.plannedMode = plan.decisions[q];
+            r.plannedPvWh = plan.productionWh[q];
+            r.plannedLoadWh = plan.consumptionWh[q];
+            r.plannedSoc = plan.soc[q];
+            portEXIT_CRITICAL(&lock);
+        }
+    }
+
+    /**
+     * @param daysAgo 0 = today (finished quarters only), 1 = yesterday
+     * @return nullptr when the day was not recorded
+     */
+    const RecordedDay_t *getDay(int daysAgo) const
+    {
+        if (days[0] == nullptr || daysAgo < 0 || daysAgo > 1)
+        {
+            return nullptr;
+        }
+        const RecordedDay_t *day = days[daysAgo == 0 ? today : 1 - today];
+        return day->date != 0 ? day : nullptr;
+    }
+
+    /**
+     * Write a recorded day as CSV, one line per call of write. Callable from
+     * any task.
+     */
+    template <typename WriteFn>
+    void exportCsv(int daysAgo, WriteFn write) const
+    {
+        char line[200];
+        write("date,quarter,time,pv_wh,load_wh,grid_buy_wh,grid_sell_wh,soc,spot,buy,sell,mode,plan_pv_wh,plan_load_wh,plan_soc\n");
+        const RecordedDay_t *day = getDay(daysAgo);
+        if (day == nullptr)
+        {
+            return;
+        }
+        portENTER_CRITICAL(&lock);
+        uint32_t date = day->date;
+        portEXIT_CRITICAL(&lock);
+        for (int q = 0; q < QUARTERS_OF_DAY; q++)
+        {
+            portENTER_CRITICAL(&lock);
+            bool sameDay = day->date == date;
+            RecordedQuarter_t r = day->quarters[q];
+            portEXIT_CRITICAL(&lock);
+            if (!sameDay)
+            {
+                break; // the buffer was reused for a new day meanwhile
+            }
+            if (r.samples == 0)
+            {
+                continue;
+            }
+            bool hasPrice = !isnan(r.spotPrice);
+            snprintf(line, sizeof(line), "%lu,%d,%02d:%02d,%.1f,%.1f,%.1f,%.1f,%d,%.3f,%.3f,%.3f,%s,%.1f,%.1f,%d\n",
+                     (unsigned long)date, q, q / 4, (q % 4) * 15,
+                     r.pvWh, r.loadWh, r.gridBuyWh, r.gridSellWh, r.soc,
+                     hasPrice ? r.spotPrice : 0.0f,
+                     hasPrice ? r.buyPrice : 0.0f,
+                     hasPrice ? r.sellPrice : 0.0f,
+                     IntelligenceResolver::commandToString(r.plannedMode).c_str(),
+                     r.plannedPvWh, r.plannedLoadWh, r.plannedSoc);
+            write(line);
+        }
+    }
+
+private:
+    RecordedDay_t *days[2] = {nullptr, nullptr};
+    volatile int today = 0;
+    int currentQuarter = -1;
+    float pvSum = 0;
+    float loadSum = 0;
+    float buySum = 0;
+    float sellSum = 0;
+    float socSum = 0;
+    uint16_t sampleCount = 0;
+    float currentPrice = NAN;
+    float currentBuyPrice = NAN;
+    float currentSellPrice = NAN;
+    mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    DayRecorder() {}
+
+    bool ensureAllocated()
+    {
+        if (days[0] != nullptr)
+        {
+            return true;
+        }
+        RecordedDay_t *allocated = (RecordedDay_t *)heap_caps_calloc(2, sizeof(RecordedDay_t), MALLOC_CAP_SPIRAM);
+        if (allocated == nullptr)
+        {
+            LOGE("[DayRecorder] Failed to allocate days");
+            return false;
+        }
+        days[0] = &allocated[0];
+        days[1] = &allocated[1];
+        clear(*days[0], 0);
+        clear(*days[1], 0);
+        return true;
+    }
+
+    static void clear(RecordedDay_t &day, uint32_t date)
+    {
+        day.date = date;
+        for (int q = 0; q < QUARTERS_OF_DAY; q++)
+        {
+            RecordedQuarter_t &r = day.quarters[q];
+            r.samples = 0;
+            r.pvWh = r.loadWh = r.gridBuyWh = r.gridSellWh = 0;
+            r.soc = -1;
+            r.spotPrice = NAN;
+            r.buyPrice = NAN;
+            r.sellPrice = NAN;
+            r.plannedMode = SI_MODE_UNKNOWN;
+            r.plannedPvWh = r.plannedLoadWh = 0;
+            r.plannedSoc = -1;
+        }
+    }
+
+    void finishQuarter()
+    {
+        if (currentQuarter < 0 || sampleCount == 0)
+        {
+            return;
+        }
+        // Average power over the quarter, 0.25 h
+        RecordedQuarter_t &r = days[today]->quarters[currentQuarter];
+        portENTER_CRITICAL(&lock);
+        r.pvWh = pvSum / sampleCount * 0.25f;
+        r.loadWh = loadSum / sampleCount * 0.25f;
+        r.gridBuyWh = buySum / sampleCount * 0.25f;
+        r.gridSellWh = sellSum / sampleCount * 0.25f;
+        r.soc = (int8_t)(socSum / sampleCount + 0.5f);
+        r.spotPrice = currentPrice;
+        r.buyPrice = currentBuyPrice;
+        r.sellPrice = currentSellPrice;
+        r.samples = sampleCount;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void rollover(uint32_t date)
+    {
+        if (days[today]->date != 0)
+        {
+            finishQuarter();
+            LOGD("[DayRecorder] Day %lu finished", (unsigned long)days[today]->date);
+        }
+        int next = 1 - today;
+        portENTER_CRITICAL(&lock);
+        clear(*days[next], date);
+        today = next;
+        portEXIT_CRITICAL(&lock);
+        currentQuarter = -1;
+        sampleCount = 0;
+    }
+};
@@ -4,6 +4,8 @@
 #include <RemoteLogger.hpp>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include "Metrics.hpp"
+#include "Tracer.hpp"
 
 /**
  * Synchronizace Flash operací s VSYNC a LVGL DMA
@@ -192,10 +194,30 @@ private:
     uint32_t startTimeUs;  // Čas začátku flash operace
     bool vsyncOk;
     
+    void recordMetrics(uint32_t durationUs) {
+#if TRACING
+        int64_t endUs = esp_timer_get_time();
+        Tracer::instance().record("flash.vsync_wait", endUs - durationUs - waitTimeUs, waitTimeUs);
+        Tracer::instance().record(tag, endUs - durationUs, durationUs);
+#endif
+        static MetricHistogram *waitHistogram = Metrics::instance().histogram("flash_lock_wait_us", "VSYNC wait before flash operation", METRICS_BUCKETS_US, METRICS_BUCKETS_LEN(METRICS_BUCKETS_US));
+        static MetricHistogram *durationHistogram = Metrics::instance().histogram("flash_op_duration_us", "Flash operation duration under FlashGuard", METRICS_BUCKETS_US, METRICS_BUCKETS_LEN(METRICS_BUCKETS_US));
+        static MetricCounter *vsyncTimeouts = Metrics::instance().counter("flash_vsync_timeouts_total", "Flash operations started without VSYNC");
+        waitHistogram->observe(waitTimeUs);
+        durationHistogram->observe(durationUs);
+        if (!vsyncOk) {
+            vsyncTimeouts->inc();
+        }
+    }
+    
 public:
     explicit FlashGuard(const char* tag = "Flash", uint32_t timeoutMs = 5000) 
         : tag(tag), locked(false), waitTimeUs(0), startTimeUs(0), vsyncOk(false) {
         locked = VSyncManager::getInstance().lockForFlash(tag, timeoutMs);
+        if (!locked) {
+            static MetricCounter *lockTimeouts = Metrics::instance().counter("flash_lock_timeouts_total", "Flash lock acquisitions that timed out");
+            lockTimeouts->inc();
+        }
         // Uložit info pro pozdější logování
         if (locked) {
             const auto& info = VSyncManager::getInstance().getLastOpInfo();
@@ -210,6 +232,7 @@ public:
         if (locked) {
             uint32_t durationUs = micros() - startTimeUs;  // Doba trvání flash operace
             VSyncManager::getInstance().unlockFlash(tag);
+            recordMetrics(durationUs);
             // Log AŽ PO uvolnění mutexu - bezpečné!
             // VBLANK trvá cca 1-2ms, pokud operace trvá déle, může bliknout
             if (durationUs > 2000) {
@@ -234,6 +257,7 @@ public:
         if (locked) {
             uint32_t durationUs = micros() - startTimeUs;
             VSyncManager::getInstance().unlockFlash(tag);
+            recordMetrics(durationUs);
             // Log po uvolnění
             if (durationUs > 2000) {
                 LOGW("Flash[%s]: %luus (>2ms!), wait %luus, vsync %s", 
@@ -0,0 +1,396 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <RemoteLogger.hpp>
+#include "Metrics.hpp"
+#include "LvglAllocator.h"
+
+/**
+ * On-device LVGL frame and invalidation profiler.
+ *
+ * Per frame (LVGL monitor_cb): render time, rendered pixels, invalidated
+ * pixels, number of flush calls and LVGL allocations since the previous frame,
+ * fed into /metrics histograms.
+ *
+ * Per widget group: widgets registered with track() are attributed
+ *  - invalidations: every invalidated area (seen in rounder_cb) is assigned
+ *    to the smallest tracked widget that contains it, the rest goes to "other"
+ *  - draws: number of redraws and time spent from DRAW_MAIN_BEGIN to
+ *    DRAW_POST_END (inclusive of children)
+ *
+ * Disabled by default; when disabled every hook returns after one flag test.
+ * Toggle via /profile?enable=1 and read the report at /profile.
+ */
+
+#define FRAME_PROFILER_MAX_OBJECTS 64
+#define FRAME_PROFILER_MAX_GROUPS 16
+#define FRAME_PROFILER_ATTRIBUTION_MARGIN 12 // ext draw size of shadows, outlines etc.
+
+typedef struct
+{
+    const char *name;
+    uint32_t invalidations;
+    uint64_t invalidatedPx;
+    uint32_t draws;
+    uint64_t drawUs;
+} FrameProfilerGroup_t;
+
+class FrameProfiler
+{
+public:
+    static FrameProfiler &instance()
+    {
+        static FrameProfiler inst;
+        return inst;
+    }
+
+    /**
+     * Must be called with lvgl_mutex held, monitor_cb updates the same state.
+     */
+    void setEnabled(bool value)
+    {
+        if (value && !enabled)
+        {
+            reset();
+        }
+        enabled = value;
+        LOGD("[FrameProfiler] %s", value ? "enabled" : "disabled");
+    }
+
+    bool isEnabled() const { return enabled; }
+
+    /**
+     * Show FPS / frame time / px overlay on the system layer. Must be called with lvgl_mutex held.
+     */
+    void setOverlay(bool value)
+    {
+        if (value && overlayLabel == nullptr)
+        {
+            overlayLabel = lv_label_create(lv_layer_sys());
+            lv_obj_set_style_bg_color(overlayLabel, lv_color_black(), 0);
+            lv_obj_set_style_bg_opa(overlayLabel, LV_OPA_70, 0);
+            lv_obj_set_style_text_color(overlayLabel, lv_color_white(), 0);
+            lv_obj_set_style_text_font(overlayLabel, &lv_font_montserrat_14, 0);
+            lv_obj_set_style_pad_all(overlayLabel, 4, 0);
+            lv_obj_align(overlayLabel, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+            lv_label_set_text(overlayLabel, "");
+            overlayTimer = lv_timer_create(overlayTimerCb, 1000, this);
+        }
+        else if (!value && overlayLabel != nullptr)
+        {
+            lv_timer_del(overlayTimer);
+            lv_obj_del(overlayLabel);
+            overlayTimer = nullptr;
+            overlayLabel = nullptr;
+        }
+    }
+
+    /**
+     * Attribute invalidations and draws of obj to the named group.
+     * Objects are untracked automatically when deleted.
+     */
+    void track(lv_obj_t *obj, const char *group)
+    {
+        if (obj == nullptr)
+        {
+            return;
+        }
+        int groupIndex = findOrCreateGroup(group);
+        if (groupIndex < 0 || objectCount >= FRAME_PROFILER_MAX_OBJECTS)
+        {
+            LOGW("[FrameProfiler] Cannot track %s, limits reached", group);
+            return;
+        }
+        objects[objectCount].obj = obj;
+        objects[objectCount].group = groupIndex;
+        objects[objectCount].drawStartUs = 0;
+        objectCount++;
+        lv_obj_add_event_cb(obj, drawEventCb, LV_EVENT_DRAW_MAIN_BEGIN, this);
+        lv_obj_add_event_cb(obj, drawEventCb, LV_EVENT_DRAW_POST_END, this);
+        lv_obj_add_event_cb(obj, deleteEventCb, LV_EVENT_DELETE, this);
+    }
+
+    /**
+     * Install as disp_drv.rounder_cb. Does not modify the area.
+     */
+    static void rounderCb(lv_disp_drv_t *disp_drv, lv_area_t *area)
+    {
+        FrameProfiler &p = instance();
+        if (!p.enabled)
+        {
+            return;
+        }
+        // LVGL also calls rounder_cb while rendering (get_max_row) - not an invalidation
+        lv_disp_t *disp = lv_disp_get_default();
+        if (disp != nullptr && disp->rendering_in_progress)
+        {
+            return;
+        }
+        p.frameInvalidations++;
+        uint32_t px = lv_area_get_size(area);
+        p.frameInvalidatedPx += px;
+        int best = -1;
+        uint32_t bestSize = UINT32_MAX;
+        for (int i = 0; i < p.objectCount; i++)
+        {
+            lv_area_t coords;
+            lv_obj_get_coords(p.objects[i].obj, &coords);
+            lv_area_increase(&coords, FRAME_PROFILER_ATTRIBUTION_MARGIN, FRAME_PROFILER_ATTRIBUTION_MARGIN);
+            uint32_t size = lv_area_get_size(&coords);
+            if (size < bestSize && _lv_area_is_in(area, &coords, 0))
+            {
+                best = p.objects[i].group;
+                bestSize = size;
+            }
+        }
+        FrameProfilerGroup_t &g = p.groups[best >= 0 ? best : 0];
+        g.invalidations++;
+        g.invalidatedPx += px;
+    }
+
+    /**
+     * Install as disp_drv.monitor_cb - called once per refreshed frame.
+     */
+    static void monitorCb(lv_disp_drv_t *disp_drv, uint32_t timeMs, uint32_t px)
+    {
+        FrameProfiler &p = instance();
+        if (!p.enabled)
+        {
+            return;
+        }
+        static MetricHistogram *frameTime = Metrics::instance().histogram("lvgl_frame_render_ms", "Render time per refreshed frame", FRAME_MS_BUCKETS, METRICS_BUCKETS_LEN(FRAME_MS_BUCKETS));
+        static MetricHistogram *framePx = Metrics::instance().histogram("lvgl_frame_px", "Pixels rendered per frame", FRAME_PX_BUCKETS, METRICS_BUCKETS_LEN(FRAME_PX_BUCKETS));
+        static MetricHistogram *frameFlushes = Metrics::instance().histogram("lvgl_frame_flushes", "Flush calls per frame", METRICS_BUCKETS_COUNT, METRICS_BUCKETS_LEN(METRICS_BUCKETS_COUNT));
+        static MetricHistogram *frameInvalidatedPx = Metrics::instance().histogram("lvgl_frame_invalidated_px", "Invalidated pixels per frame", FRAME_PX_BUCKETS, METRICS_BUCKETS_LEN(FRAME_PX_BUCKETS));
+        static MetricHistogram *frameAllocs = Metrics::instance().histogram("lvgl_frame_allocs", "LVGL allocations per frame", METRICS_BUCKETS_COUNT, METRICS_BUCKETS_LEN(METRICS_BUCKETS_COUNT));
+        uint32_t allocs = p.allocsSinceLastFrame();
+        frameTime->observe(timeMs);
+        framePx->observe(px);
+        frameFlushes->observe(p.frameFlushes);
+        frameInvalidatedPx->observe(p.frameInvalidatedPx);
+        frameAllocs->observe(allocs);
+
+        p.frames++;
+        p.totalRenderMs += timeMs;
+        p.totalPx += px;
+        p.totalFlushes += p.frameFlushes;
+        p.totalInvalidatedPx += p.frameInvalidatedPx;
+        p.totalAllocs += allocs;
+        if (timeMs > p.maxRenderMs)
+        {
+            p.maxRenderMs = timeMs;
+        }
+        p.frameFlushes = 0;
+        p.frameInvalidations = 0;
+        p.frameInvalidatedPx = 0;
+    }
+
+    /**
+     * Call from flush_cb.
+     */
+    inline void onFlush()
+    {
+        if (enabled)
+        {
+            frameFlushes++;
+        }
+    }
+
+    /**
+     * Must be called with lvgl_mutex held.
+     */
+    void reset()
+    {
+        frames = 0;
+        totalRenderMs = 0;
+        maxRenderMs = 0;
+        totalPx = 0;
+        totalFlushes = 0;
+        totalInvalidatedPx = 0;
+        totalAllocs = 0;
+        frameFlushes = 0;
+        frameInvalidations = 0;
+        frameInvalidatedPx = 0;
+        allocsSinceLastFrame();
+        startMillis = millis();
+        overlayLastFrames = 0;
+        overlayLastRenderMs = 0;
+        overlayLastPx = 0;
+        for (int i = 0; i < groupCount; i++)
+        {
+            groups[i].invalidations = 0;
+            groups[i].invalidatedPx = 0;
+            groups[i].draws = 0;
+            groups[i].drawUs = 0;
+        }
+    }
+
+    /**
+     * Plain text report, one widget group per line.
+     */
+    template <typename Writer>
+    void report(Writer write)
+    {
+        char line[160];
+        uint32_t seconds = (millis() - startMillis) / 1000;
+        snprintf(line, sizeof(line), "profiler: %s, window %lus\n", enabled ? "enabled" : "disabled", (unsigned long)seconds);
+        write(line);
+        snprintf(line, sizeof(line), "frames: %lu, avg render %.2f ms, max %lu ms, avg %lu px, avg %.2f flushes\n",
+                 (unsigned long)frames,
+                 frames ? (float)totalRenderMs / frames : 0.0f,
+                 (unsigned long)maxRenderMs,
+                 (unsigned long)(frames ? totalPx / frames : 0),
+                 frames ? (float)totalFlushes / frames : 0.0f);
+        write(line);
+        snprintf(line, sizeof(line), "avg invalidated %lu px, avg %.1f lvgl allocations per frame\n\n",
+                 (unsigned long)(frames ? totalInvalidatedPx / frames : 0),
+                 frames ? (float)totalAllocs / frames : 0.0f);
+        write(line);
+        snprintf(line, sizeof(line), "%-20s %12s %14s %10s %12s %10s\n", "group", "invalidations", "invalidated_px", "draws", "draw_us", "us/draw");
+        write(line);
+        for (int i = 0; i < groupCount; i++)
+        {
+            const FrameProfilerGroup_t &g = groups[i];
+            snprintf(line, sizeof(line), "%-20s %12lu %14llu %10lu %12llu %10lu\n",
+                     g.name, (unsigned long)g.invalidations, (unsigned long long)g.invalidatedPx,
+                     (unsigned long)g.draws, (unsigned long long)g.drawUs,
+                     (unsigned long)(g.draws ? g.drawUs / g.draws : 0));
+            write(line);
+        }
+    }
+
+private:
+    typedef struct
+    {
+        lv_obj_t *obj;
+        int group;
+        uint32_t drawStartUs;
+    } TrackedObject_t;
+
+    static constexpr float FRAME_MS_BUCKETS[] = {2, 5, 10, 16, 33, 50, 100, 250};
+    static constexpr float FRAME_PX_BUCKETS[] = {100, 1000, 5000, 20000, 50000, 100000, 200000, 384000};
+
+    volatile bool enabled = false;
+    TrackedObject_t objects[FRAME_PROFILER_MAX_OBJECTS];
+    int objectCount = 0;
+    FrameProfilerGroup_t groups[FRAME_PROFILER_MAX_GROUPS];
+    int groupCount = 0;
+
+    uint32_t frames = 0;
+    uint32_t totalRenderMs = 0;
+    uint32_t maxRenderMs = 0;
+    uint64_t totalPx = 0;
+    uint32_t totalFlushes = 0;
+    uint64_t totalInvalidatedPx = 0;
+    uint32_t totalAllocs = 0;
+    uint32_t frameFlushes = 0;
+    uint32_t frameInvalidations = 0;
+    uint32_t frameInvalidatedPx = 0;
+    uint32_t lastAllocs = 0;
+    unsigned long startMillis = 0;
+
+    lv_obj_t *overlayLabel = nullptr;
+    lv_timer_t *overlayTimer = nullptr;
+    uint32_t overlayLastFrames = 0;
+    uint32_t overlayLastRenderMs = 0;
+    uint64_t overlayLastPx = 0;
+
+    FrameProfiler()
+    {
+        findOrCreateGroup("other"); // group 0 - invalidations outside tracked widgets
+    }
+
+    uint32_t allocsSinceLastFrame()
+    {
+        lvgl_alloc_stats_t stats;
+        lvgl_alloc_get_stats(&stats);
+        uint32_t allocs = stats.internalAllocs + stats.psramAllocs;
+        uint32_t delta = allocs - lastAllocs;
+        lastAllocs = allocs;
+        return delta;
+    }
+
+    int findOrCreateGroup(const char *name)
+    {
+        for (int i = 0; i < groupCount; i++)
+        {
+            if (strcmp(groups[i].name, name) == 0)
+            {
+                return i;
+            }
+        }
+        if (groupCount >= FRAME_PROFILER_MAX_GROUPS)
+        {
+            return -1;
+        }
+        groups[groupCount] = {name, 0, 0, 0, 0};
+        return groupCount++;
+    }
+
+    int findObject(lv_obj_t *obj)
+    {
+        for (int i = 0; i < objectCount; i++)
+        {
+            if (objects[i].obj == obj)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    static void drawEventCb(lv_event_t *e)
+    {
+        FrameProfiler *p = (FrameProfiler *)lv_event_get_user_data(e);
+        if (!p->enabled)
+        {
+            return;
+        }
+        int index = p->findObject(lv_event_get_target(e));
+        if (index < 0)
+        {
+            return;
+        }
+        TrackedObject_t &o = p->objects[index];
+        if (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_BEGIN)
+        {
+            o.drawStartUs = micros();
+        }
+        else if (o.drawStartUs != 0)
+        {
+            FrameProfilerGroup_t &g = p->groups[o.group];
+            g.draws++;
+            g.drawUs += micros() - o.drawStartUs;
+            o.drawStartUs = 0;
+        }
+    }
+
+    static void deleteEventCb(lv_event_t *e)
+    {
+        FrameProfiler *p = (FrameProfiler *)lv_event_get_user_data(e);
+        int index = p->findObject(lv_event_get_target(e));
+        if (index < 0)
+        {
+            return;
+        }
+        // Swap-remove, order of tracked objects does not matter
+        p->objects[index] = p->objects[p->objectCount - 1];
+        p->objectCount--;
+    }
+
+    static void overlayTimerCb(lv_timer_t *timer)
+    {
+        FrameProfiler *p = (FrameProfiler *)timer->user_data;
+        uint32_t frames = p->frames - p->overlayLastFrames;
+        uint32_t renderMs = p->totalRenderMs - p->overlayLastRenderMs;
+        uint64_t px = p->totalPx - p->overlayLastPx;
+        p->overlayLastFrames = p->frames;
+        p->overlayLastRenderMs = p->totalRenderMs;
+        p->overlayLastPx = p->totalPx;
+        lv_label_set_text_fmt(p->overlayLabel, "%lu FPS  %lu ms/frame  %lu kpx/s",
+                              (unsigned long)frames,
+                              (unsigned long)(frames ? renderMs / frames : 0),
+                              (unsigned long)(px / 1000));
+    }
+};
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <Arduino.h>
+#include <SolarIntelligence.h>
+#include <RemoteLogger.hpp>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "SimulationGate.hpp"
+#include "../Spot/ElectricityPriceResult.hpp"
+
+#define INTELLIGENCE_WORKER_STACK_SIZE (10 * 1024)
+#define INTELLIGENCE_WORKER_PRIORITY 2
+#define INTELLIGENCE_WORKER_CORE 0 // LVGL and the main loop run on core 1
+#define INTELLIGENCE_REASON_LENGTH 96
+
+/**
+ * Result of one simulation run, never modified after it is published.
+ */
+typedef struct IntelligencePlan
+{
+    uint32_t generation;
+    SimulationChange_t change;
+    unsigned long elapsedMs;
+    uint32_t stackFreeBytes;                           // worker stack high-water mark after the run
+    SolarIntelligenceSettings_t settings;              // settings the plan was simulated with
+    int firstQuarter;                                  // quarter the simulation started at
+    int totalQuarters;                                 // 96 or 192
+    SolarInverterMode_t decisions[QUARTERS_TWO_DAYS];  // SI_MODE_UNKNOWN outside the simulated range
+    float productionWh[QUARTERS_TWO_DAYS];
+    float consumptionWh[QUARTERS_TWO_DAYS];
+    int8_t soc[QUARTERS_TWO_DAYS];                     // -1 outside the simulated range
+    SolarInverterMode_t command;                       // decision for firstQuarter
+    char reason[INTELLIGENCE_REASON_LENGTH];
+    float totalSavings;
+    float totalProductionKwh;
+    float totalConsumptionKwh;
+} IntelligencePlan_t;
+
+/**
+ * Runs the intelligence simulation on a low priority task on core 0, so
+ * inverter polling and Shelly/wallbox control in the main loop don't wait
+ * for it.
+ *
+ * submit() stores the inputs and wakes the worker. A newer submit()
+ * supersedes an older one: a run that finishes after a newer request
+ * arrived is dropped and the worker starts over with the latest inputs
+ * (the library call itself can't be interrupted). Finished plans are
+ * written to the back buffer and published by swapping buffers under a
+ * mutex, takePlan() copies the published one out.
+ *
+ * The resolver reads the predictors for the whole run, so the run holds
+ * the predictor mutex. The main loop only try-takes it for samples and
+ * saves, and holds them back while a simulation is in progress.
+ */
+class IntelligenceWorker
+{
+public:
+    IntelligenceWorker(IntelligenceResolver &resolver, SemaphoreHandle_t &predictorMutex)
+        : resolver(resolver), predictorMutex(predictorMutex) {}
+
+    bool begin()
+    {
+        mutex = xSemaphoreCreateMutex();
+        request = (Request_t *)heap_caps_calloc(1, sizeof(Request_t), MALLOC_CAP_SPIRAM);
+        working = (Request_t *)heap_caps_calloc(1, sizeof(Request_t), MALLOC_CAP_SPIRAM);
+        plans[0] = (IntelligencePlan_t *)heap_caps_calloc(1, sizeof(IntelligencePlan_t), MALLOC_CAP_SPIRAM);
+        plans[1] = (IntelligencePlan_t *)heap_caps_calloc(1, sizeof(IntelligencePlan_t), MALLOC_CAP_SPIRAM);
+        if (mutex == nullptr || predictorMutex == nullptr || request == nullptr || working == nullptr || plans[0] == nullptr || plans[1] == nullptr)
+        {
+            LOGE("[IntelligenceWorker] Failed to allocate buffers");
+            return false;
+        }
+        if (xTaskCreatePinnedToCore(workerTask, "intelligence", INTELLIGENCE_WORKER_STACK_SIZE, this,
+                                    INTELLIGENCE_WORKER_PRIORITY, &task, INTELLIGENCE_WORKER_CORE) != pdPASS)
+        {
+            LOGE("[IntelligenceWorker] Failed to start task");
+            task = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Request a simulation, superseding any request not finished yet.
+     */
+    void submit(int soc, const SolarPriceData_t &prices, const SolarIntelligenceSettings_t &settings, SimulationChange_t change)
+    {
+        if (task == nullptr)
+        {
+            return;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        request->generation = ++requestedGeneration;
+        request->soc = soc;
+        request->prices = prices;
+        request->settings = settings;
+        request->change = change;
+        xSemaphoreGive(mutex);
+        xTaskNotifyGive(task);
+    }
+
+    /**
+     * Drop requests in flight, e.g. after intelligence was disabled.
+     */
+    void cancel()
+    {
+        if (task == nullptr)
+        {
+            return;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        ++requestedGeneration;
+        xSemaphoreGive(mutex);
+    }
+
+    /**
+     * Copy the latest plan into out if it is newer than seenGeneration.
+     */
+    bool takePlan(IntelligencePlan_t &out, uint32_t &seenGeneration)
+    {
+        if (task == nullptr || publishedGeneration == seenGeneration)
+        {
+            return false;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool fresh = front != nullptr && front->generation == requestedGeneration && front->generation != seenGeneration;
+        if (fresh)
+        {
+            out = *front;
+            seenGeneration = front->generation;
+        }
+        xSemaphoreGive(mutex);
+        return fresh;
+    }
+
+private:
+    typedef struct
+    {
+        uint32_t generation;
+        int soc;
+        SolarPriceData_t prices;
+        SolarIntelligenceSettings_t settings;
+        SimulationChange_t change;
+    } Request_t;
+
+    IntelligenceResolver &resolver;
+    SemaphoreHandle_t &predictorMutex;       // guards the predictors the resolver reads
+    TaskHandle_t task = nullptr;
+    SemaphoreHandle_t mutex = nullptr;
+    Request_t *request = nullptr;            // latest inputs, guarded by mutex
+    Request_t *working = nullptr;            // inputs of the run in progress, worker only
+    IntelligencePlan_t *plans[2] = {nullptr, nullptr};
+    IntelligencePlan_t *front = nullptr;     // published, guarded by mutex
+    uint32_t requestedGeneration = 0;        // guarded by mutex
+    volatile uint32_t publishedGeneration = 0;
+
+    static void workerTask(void *param)
+    {
+        IntelligenceWorker *self = (IntelligenceWorker *)param;
+        for (;;)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            self->runLatest();
+        }
+    }
+
+    void runLatest()
+    {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        *working = *request;
+        bool pending = working->generation == requestedGeneration && working->generation != publishedGeneration;
+        xSemaphoreGive(mutex);
+        if (!pending)
+        {
+            return;
+        }
+
+        IntelligencePlan_t *back = plans[0] == front ? plans[1] : plans[0];
+        simulate(*working, *back);
+
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool current = back->generation == requestedGeneration;
+        if (current)
+        {
+            front = back;
+            publishedGeneration = back->generation;
+        }
+        xSemaphoreGive(mutex);
+        if (!current)
+        {
+            LOGD("[IntelligenceWorker] Run %lu superseded, result dropped", (unsigned long)back->generation);
+        }
+    }
+
+    void simulate(const Request_t &input, IntelligencePlan_t &plan)
+    {
+        unsigned long start = millis();
+        SolarBatteryState_t batteryState(input.soc);
+        xSemaphoreTake(predictorMutex, portMAX_DELAY);
+        const auto &simResults = resolver.runSimulation(batteryState, input.prices, input.settings, true);
+        xSemaphoreGive(predictorMutex);
+        const auto &summary = resolver.getLastSummary();
+
+        time_t now = time(nullptr);
+        struct tm timeinfo;
+        localtime_r(&now, &timeinfo);
+
+        plan.generation = input.generation;
+        plan.change = input.change;
+        plan.elapsedMs = millis() - start;
+        plan.stackFreeBytes = uxTaskGetStackHighWaterMark(nullptr);
+        plan.settings = input.settings;
+        plan.firstQuarter = simResults.empty() ? (timeinfo.tm_hour * 60 + timeinfo.tm_min) / 15 : simResults[0].quarter;
+        plan.totalQuarters = input.prices.hasTomorrowData ? QUARTERS_TWO_DAYS : QUARTERS_OF_DAY;
+        for (int q = 0; q < QUARTERS_TWO_DAYS; q++)
+        {
+            plan.decisions[q] = SI_MODE_UNKNOWN;
+            plan.productionWh[q] = 0;
+            plan.consumptionWh[q] = 0;
+            plan.soc[q] = -1;
+        }
+        for (size_t i = 0; i < simResults.size(); i++)
+        {
+            int q = simResults[i].quarter;
+            if (q < plan.totalQuarters)
+            {
+                plan.decisions[q] = simResults[i].decision;
+                plan.productionWh[q] = simResults[i].productionKwh * 1000.0f;
+                plan.consumptionWh[q] = simResults[i].consumptionKwh * 1000.0f;
+                plan.soc[q] = (int8_t)simResults[i].batterySoc;
+            }
+        }
+        plan.command = simResults.empty() ? SI_MODE_UNKNOWN : simResults[0].decision;
+        strncpy(plan.reason, simResults.empty() ? "" : simResults[0].reason.c_str(), INTELLIGENCE_REASON_LENGTH - 1);
+        plan.reason[INTELLIGENCE_REASON_LENGTH - 1] = '\0';
+        plan.totalSavings = summary.totalSavingsCzk;
+        plan.totalProductionKwh = summary.totalProductionKwh;
+        plan.totalConsumptionKwh = summary.totalConsumptionKwh;
+
+        logSummary(input, plan, summary);
+    }
+
+    template <typename Summary>
+    void logSummary(const Request_t &input, const IntelligencePlan_t &plan, const Summary &summary)
+    {
+        const SolarIntelligenceSettings_t &settings = input.settings;
+        LOGI("Recommended action: %s - %s",
+             IntelligenceResolver::commandToString(plan.command).c_str(), plan.reason);
+
+        LOGI("=== SIMULATION SUMMARY ===");
+        LOGI("Total production: %.1f kWh, consumption: %.1f kWh",
+             summary.totalProductionKwh, summary.totalConsumptionKwh);
+        LOGI("Grid: bought %.1f kWh, sold %.1f kWh",
+             summary.totalFromGridKwh, summary.totalToGridKwh);
+        LOGI("Intelligent: cost %.1f CZK, final SOC %.0f%%",
+             summary.totalCostCzk, summary.finalBatterySoc);
+        LOGI("Baseline (dumb): cost %.1f CZK, final SOC %.0f%%",
+             summary.baselineCostCzk, summary.baselineFinalSoc);
+
+        // Detailní info o arbitráži
+        if (summary.chargedFromGridKwh > 0)
+        {
+            float avgChargeCost = summary.chargedFromGridCost / summary.chargedFromGridKwh;
+            float potentialSavings = summary.chargedFromGridKwh * (summary.maxBuyPrice - avgChargeCost);
+            LOGI("Arbitrage: charged %.1f kWh @ avg %.1f CZK, max buy %.1f CZK, potential savings %.1f CZK",
+                 summary.chargedFromGridKwh, avgChargeCost, summary.maxBuyPrice, potentialSavings);
+        }
+
+        LOGI("Battery value adjustment: %.1f CZK (diff %.1f kWh @ %.1f CZK)",
+             summary.batteryValueAdjustment,
+             (summary.finalBatterySoc - summary.baselineFinalSoc) / 100.0f * settings.batteryCapacityKwh,
+             summary.maxBuyPrice - settings.batteryCostPerKwh);
+        LOGI("Savings vs dumb Self-Use: %.1f CZK", summary.totalSavingsCzk);
+
+        // Log summary of mode changes only
+        LOGI("=== MODE CHANGES ===");
+        int lastMode = -1;
+        for (int q = plan.firstQuarter; q < plan.totalQuarters; q++)
+        {
+            if (plan.decisions[q] != lastMode)
+            {
+                int hour = (q % QUARTERS_OF_DAY) / 4;
+                int minute = ((q % QUARTERS_OF_DAY) % 4) * 15;
+                LOGI("  Q%d (%02d:%02d): %s (spot: %.2f %s)",
+                     q, hour, minute, IntelligenceResolver::commandToString(plan.decisions[q]).c_str(),
+                     input.prices.prices[q], input.prices.currency);
+                lastMode = plan.decisions[q];
+            }
+        }
+    }
+};
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <RemoteLogger.hpp>
+
+/**
+ * Live screen mirroring for remote support.
+ *
+ * Every area LVGL flushes to the panel is RLE-compressed into a PSRAM ring
+ * buffer as one "rect record". The web server streams records to a viewer,
+ * which paints them onto a canvas, so only the redrawn parts of the screen
+ * travel over the network.
+ *
+ * Capture runs only while a viewer polled recently, otherwise flush cost is
+ * a single millis() compare.
+ *
+ * Record layout (little-endian):
+ *   uint32 seq, uint16 x, uint16 y, uint16 w, uint16 h, uint32 payloadLen
+ *   payload: uint16 words, control word c:
+ *     c & 0x8000 -> next word repeated (c & 0x7FFF) times
+ *     otherwise  -> c literal words follow
+ */
+
+#define LIVE_STREAM_BUFFER_SIZE (512 * 1024)
+#define LIVE_STREAM_MAX_RECORDS 256
+#define LIVE_STREAM_CLIENT_TIMEOUT_MS 5000
+#define LIVE_STREAM_HEADER_SIZE 16
+#define LIVE_STREAM_WINDOW_MS 1500 // one HTTP response streams at most this long
+// Largest area one record may cover, its worst case (no runs) takes half of the ring
+#define LIVE_STREAM_MAX_AREA_PIXELS ((LIVE_STREAM_BUFFER_SIZE / 2 - LIVE_STREAM_HEADER_SIZE) / 2 - 64)
+// Records a full screen of the given size is split into by captureArea()
+#define LIVE_STREAM_RECORDS_PER_SCREEN(w, h) (((h) + LIVE_STREAM_MAX_AREA_PIXELS / (w) - 1) / (LIVE_STREAM_MAX_AREA_PIXELS / (w)))
+
+typedef struct
+{
+    uint32_t seq;
+    uint32_t start; // absolute position in the byte ring
+    uint32_t length;
+    uint16_t x, y, w, h;
+} LiveStreamRecord_t;
+
+class LiveStream
+{
+public:
+    static LiveStream &instance()
+    {
+        static LiveStream inst;
+        return inst;
+    }
+
+    /**
+     * Called by the web server on every viewer request - keeps capture enabled.
+     * Allocates the ring buffer on first use.
+     */
+    bool touchClient()
+    {
+        if (buffer == nullptr)
+        {
+            buffer = (uint8_t *)heap_caps_malloc(LIVE_STREAM_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+            if (buffer == nullptr)
+            {
+                LOGE("[LiveStream] Failed to allocate %d bytes in PSRAM", LIVE_STREAM_BUFFER_SIZE);
+                return false;
+            }
+            LOGD("[LiveStream] Ring buffer allocated (%d KB)", LIVE_STREAM_BUFFER_SIZE / 1024);
+        }
+        lastClientMillis = millis();
+        return true;
+    }
+
+    bool isActive() const
+    {
+        return buffer != nullptr && lastClientMillis != 0 && (millis() - lastClientMillis) < LIVE_STREAM_CLIENT_TIMEOUT_MS;
+    }
+
+    /**
+     * Capture an area inside a larger framebuffer (rows stride pixels apart),
+     * as few records as possible - bands of rows up to LIVE_STREAM_MAX_AREA_PIXELS.
+     * @param origin first pixel of the area
+     */
+    void captureArea(const lv_area_t *area, const lv_color_t *origin, uint16_t stride)
+    {
+        if (!isActive())
+        {
+            return;
+        }
+        uint16_t w = area->x2 - area->x1 + 1;
+        lv_coord_t bandRows = max(1, (int)(LIVE_STREAM_MAX_AREA_PIXELS / w));
+        for (lv_coord_t y = area->y1; y <= area->y2; y += bandRows)
+        {
+            lv_area_t band = {area->x1, y, area->x2, (lv_coord_t)min((int)area->y2, y + bandRows - 1)};
+            capture(&band, origin + (uint32_t)(y - area->y1) * stride, stride);
+        }
+    }
+
+    /**
+     * Capture flushed area. Must be called from flush_cb before lv_disp_flush_ready().
+     * @param stride pixels between rows in color_p, 0 = area width (contiguous)
+     */
+    void capture(const lv_area_t *area, const lv_color_t *color_p, uint16_t stride = 0)
+    {
+        if (!isActive())
+        {
+            return;
+        }
+
+        uint16_t w = area->x2 - area->x1 + 1;
+        uint16_t h = area->y2 - area->y1 + 1;
+        uint32_t pixels = (uint32_t)w * h;
+        if (stride == 0)
+        {
+            stride = w;
+        }
+        // Worst case: every 0x7FFF literals need one control word
+        uint32_t worstCase = LIVE_STREAM_HEADER_SIZE + pixels * 2 + ((pixels / 0x7FFF) + 1) * 2;
+        if (worstCase > LIVE_STREAM_BUFFER_SIZE / 2)
+        {
+            LOGW("[LiveStream] Area %dx%d too large, skipped", w, h);
+            return;
+        }
+
+        xSemaphoreTake(mutex, portMAX_DELAY);
+
+        uint32_t recordStart = writePos;
+        writePos += LIVE_STREAM_HEADER_SIZE; // header is filled once payload length is known
+
+        const uint16_t *base = (const uint16_t *)color_p;
+        bool contiguous = stride == w;
+        auto src = [&](uint32_t index) -> uint16_t {
+            return contiguous ? base[index] : base[(index / w) * stride + index % w];
+        };
+        uint32_t i = 0;
+        while (i < pixels)
+        {
+            uint16_t value = src(i);
+            uint32_t run = 1;
+            while (i + run < pixels && run < 0x7FFF && src(i + run) == value)
+            {
+                run++;
+            }
+
+            if (run >= 3)
+            {
+                putWord(0x8000 | run);
+                putWord(value);
+                i += run;
+                continue;
+            }
+
+            // Literal block until next run of 3+ equal pixels
+            uint32_t literalStart = i;
+            uint32_t count = 0;
+            while (i < pixels && count < 0x7FFF)
+            {
+                if (i + 2 < pixels && src(i) == src(i + 1) && src(i) == src(i + 2))
+                {
+                    break;
+                }
+                i++;
+                count++;
+            }
+            putWord(count);
+            for (uint32_t j = 0; j < count; j++)
+            {
+                putWord(src(literalStart + j));
+            }
+        }
+
+        uint32_t payloadLength = writePos - recordStart - LIVE_STREAM_HEADER_SIZE;
+        uint32_t seq = nextSeq++;
+        uint8_t header[LIVE_STREAM_HEADER_SIZE];
+        writeHeader(header, seq, area->x1, area->y1, w, h, payloadLength);
+        for (int b = 0; b < LIVE_STREAM_HEADER_SIZE; b++)
+        {
+            buffer[(recordStart + b) % LIVE_STREAM_BUFFER_SIZE] = header[b];
+        }
+
+        LiveStreamRecord_t &record = records[seq % LIVE_STREAM_MAX_RECORDS];
+        record.seq = seq;
+        record.start = recordStart;
+        record.length = LIVE_STREAM_HEADER_SIZE + payloadLength;
+        record.x = area->x1;
+        record.y = area->y1;
+        record.w = w;
+        record.h = h;
+
+        xSemaphoreGive(mutex);
+    }
+
+    /**
+     * Sequence number the next captured record will get.
+     */
+    uint32_t getNextSeq()
+    {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        uint32_t seq = nextSeq;
+        xSemaphoreGive(mutex);
+        return seq;
+    }
+
+    /**
+     * Returns true if record with given seq is still fully present in the ring.
+     */
+    bool isAvailable(uint32_t seq)
+    {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool ok = isValidLocked(seq);
+        xSemaphoreGive(mutex);
+        return ok;
+    }
+
+    /**
+     * Copy part of a record (header + payload) into dest.
+     * @param seq record sequence number
+     * @param offset byte offset inside the record
+     * @param dest destination buffer
+     * @param maxLen destination size
+     * @return number of bytes copied, -1 if the record was overwritten meanwhile
+     */
+    int32_t read(uint32_t seq, uint32_t offset, uint8_t *dest, uint32_t maxLen, uint32_t *recordLength)
+    {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        if (!isValidLocked(seq))
+        {
+            xSemaphoreGive(mutex);
+            return -1;
+        }
+        const LiveStreamRecord_t &record = records[seq % LIVE_STREAM_MAX_RECORDS];
+        *recordLength = record.length;
+        uint32_t remaining = record.length > offset ? record.length - offset : 0;
+        uint32_t len = remaining < maxLen ? remaining : maxLen;
+        uint32_t pos = (record.start + offset) % LIVE_STREAM_BUFFER_SIZE;
+        uint32_t firstPart = LIVE_STREAM_BUFFER_SIZE - pos;
+        if (firstPart >= len)
+        {
+            memcpy(dest, buffer + pos, len);
+        }
+        else
+        {
+            memcpy(dest, buffer + pos, firstPart);
+            memcpy(dest + firstPart, buffer, len - firstPart);
+        }
+        xSemaphoreGive(mutex);
+        return len;
+    }
+
+private:
+    LiveStream()
+    {
+        mutex = xSemaphoreCreateMutex();
+        memset(records, 0, sizeof(records));
+    }
+
+    SemaphoreHandle_t mutex = nullptr;
+    uint8_t *buffer = nullptr;
+    volatile uint32_t lastClientMillis = 0;
+    uint32_t writePos = 0; // absolute, wraps naturally at 2^32
+    uint32_t nextSeq = 1;
+    LiveStreamRecord_t records[LIVE_STREAM_MAX_RECORDS];
+
+    inline void putWord(uint16_t word)
+    {
+        buffer[writePos % LIVE_STREAM_BUFFER_SIZE] = word & 0xFF;
+        buffer[(writePos + 1) % LIVE_STREAM_BUFFER_SIZE] = word >> 8;
+        writePos += 2;
+    }
+
+    bool isValidLocked(uint32_t seq) const
+    {
+        if (seq == 0 || seq >= nextSeq || nextSeq - seq > LIVE_STREAM_MAX_RECORDS)
+        {
+            return false;
+        }
+        const LiveStreamRecord_t &record = records[seq % LIVE_STREAM_MAX_RECORDS];
+        // Bytes older than writePos - BUFFER_SIZE were already overwritten
+        return record.seq == seq && (writePos - record.start) <= LIVE_STREAM_BUFFER_SIZE;
+    }
+
+    static void writeHeader(uint8_t *header, uint32_t seq, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t len)
+    {
+        header[0] = seq;
+        header[1] = seq >> 8;
+        header[2] = seq >> 16;
+        header[3] = seq >> 24;
+        header[4] = x;
+        header[5] = x >> 8;
+        header[6] = y;
+        header[7] = y >> 8;
+        header[8] = w;
+        header[9] = w >> 8;
+        header[10] = h;
+        header[11] = h >> 8;
+        header[12] = len;
+        header[13] = len >> 8;
+        header[14] = len >> 16;
+        header[15] = len >> 24;
+    }
+};
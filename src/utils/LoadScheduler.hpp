@@ -0,0 +1,467 @@
+#pragma once
+
+#include <Arduino.h>
+#include <RemoteLogger.hpp>
+#include <SolarIntelligence.h>
+#include <algorithm>
+#include "../Spot/ElectricityPriceResult.hpp"
+
+#define LOAD_SCHEDULER_PLAN_BYTES (QUARTERS_TWO_DAYS / 8)
+#define LOAD_SCHEDULER_MAX_ENERGY_WH 10000000UL // 10 MWh, far above any load over two days
+
+typedef enum
+{
+    SCHEDULED_LOAD_SHELLY = 0,
+    SCHEDULED_LOAD_WALLBOX,
+    SCHEDULED_LOAD_COUNT
+} ScheduledLoad_t;
+
+typedef struct LoadRequest
+{
+    uint32_t energyWh;  // still needed, 0 = no request
+    time_t deadline;    // energy has to be delivered before
+    uint16_t maxPowerW; // power drawn while the load runs
+} LoadRequest_t;
+
+/**
+ * Plans when deferrable loads (Shelly relays, wallbox) should run.
+ *
+ * Each load declares an energy need, a deadline and its power. The scheduler
+ * picks the cheapest quarters between now and the deadline over today and
+ * tomorrow. A quarter's cost is the predicted PV surplus valued at the sell
+ * price (feed-in given up) plus the rest from the grid at the buy price.
+ * The control loops ask isScheduledNow() and force the load on, outside
+ * the planned quarters the surplus rules stay in charge.
+ *
+ * update() only redoes what changed:
+ *  - quarter inputs are rebuilt when prices are reloaded or the day rolls over
+ *  - when a quarter ends, its energy is deducted from the loads that were
+ *    confirmed running in it and only the prediction of the same quarter
+ *    tomorrow (the one that just learned a sample) is refreshed
+ *  - a load is re-planned only after its request or its inputs changed, or
+ *    when a planned quarter passed without the load running (dropping an
+ *    executed quarter together with its energy keeps the rest of the plan
+ *    optimal)
+ * Delivered energy is estimated as maxPowerW for every planned quarter the
+ * control loop confirmed with confirmRunning().
+ *
+ * Everything except request() and report() belongs to the main loop.
+ * report() formats a snapshot published at the end of update().
+ */
+class LoadScheduler
+{
+public:
+    static LoadScheduler &instance()
+    {
+        static LoadScheduler inst;
+        return inst;
+    }
+
+    static const char *loadName(ScheduledLoad_t load)
+    {
+        return load == SCHEDULED_LOAD_SHELLY ? "shelly" : "wallbox";
+    }
+
+    /**
+     * Declare (or with energyWh = 0 cancel) the need of a load. Callable from
+     * any task, applied by the next update().
+     */
+    void request(ScheduledLoad_t load, uint32_t energyWh, time_t deadline, uint16_t maxPowerW)
+    {
+        portENTER_CRITICAL(&lock);
+        pending[load].energyWh = energyWh;
+        pending[load].deadline = deadline;
+        pending[load].maxPowerW = maxPowerW;
+        hasPending[load] = true;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    /**
+     * True while any request is pending or unfinished, update() is a no-op otherwise.
+     */
+    bool isActive() const
+    {
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            if (hasPending[i] || loads[i].request.energyWh > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool hasPendingRequest() const
+    {
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            if (hasPending[i])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const LoadRequest_t &getRequest(ScheduledLoad_t load) const
+    {
+        return loads[load].request;
+    }
+
+    /**
+     * True when the load should run in the current quarter.
+     */
+    bool isScheduledNow(ScheduledLoad_t load) const
+    {
+        return lastQuarter >= 0 && isPlanned(loads[load], lastQuarter);
+    }
+
+    /**
+     * Report that the load was seen running (relay on, car charging) in the
+     * current quarter. A planned quarter without confirmation delivers no
+     * energy, its share is planned again.
+     */
+    void confirmRunning(ScheduledLoad_t load)
+    {
+        if (day == 0)
+        {
+            return;
+        }
+        time_t now = time(nullptr);
+        struct tm t;
+        localtime_r(&now, &t);
+        int quarter = (t.tm_hour * 60 + t.tm_min) / 15;
+        if ((uint32_t)((t.tm_year + 1900) * 1000 + t.tm_yday) != day)
+        {
+            quarter += QUARTERS_OF_DAY; // day rolled over, update() hasn't seen it yet
+        }
+        loads[load].confirmed[quarter / 8] |= 1 << (quarter % 8);
+    }
+
+    /**
+     * Call periodically from the main loop.
+     */
+    void update(const ElectricityPriceTwoDays_t &prices, const SolarIntelligenceSettings_t &settings,
+                ProductionPredictor &production, ConsumptionPredictor &consumption)
+    {
+        updateState(prices, settings, production, consumption);
+        portENTER_CRITICAL(&lock);
+        memcpy(published, loads, sizeof(published));
+        portEXIT_CRITICAL(&lock);
+    }
+
+    /**
+     * Text overview of the requests and plans as of the last update(), one
+     * line per call of write. Callable from any task.
+     */
+    template <typename WriteFn>
+    void report(WriteFn write) const
+    {
+        LoadState_t snapshot[SCHEDULED_LOAD_COUNT];
+        portENTER_CRITICAL(&lock);
+        memcpy(snapshot, published, sizeof(snapshot));
+        portEXIT_CRITICAL(&lock);
+
+        char line[160];
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            const LoadState_t &load = snapshot[i];
+            if (load.request.energyWh == 0)
+            {
+                snprintf(line, sizeof(line), "%s: no request\n", loadName((ScheduledLoad_t)i));
+                write(line);
+                continue;
+            }
+            struct tm deadline;
+            localtime_r(&load.request.deadline, &deadline);
+            snprintf(line, sizeof(line), "%s: %lu Wh at %u W until %02d:%02d, %d quarters planned%s\n",
+                     loadName((ScheduledLoad_t)i), (unsigned long)load.request.energyWh, load.request.maxPowerW,
+                     deadline.tm_hour, deadline.tm_min, load.plannedQuarters,
+                     load.shortOfQuarters ? " (not enough time before deadline)" : "");
+            write(line);
+            for (int q = 0; q < QUARTERS_TWO_DAYS; q++)
+            {
+                if (!isPlanned(load, q) || (q > 0 && isPlanned(load, q - 1)))
+                {
+                    continue;
+                }
+                int end = q;
+                while (end < QUARTERS_TWO_DAYS && isPlanned(load, end))
+                {
+                    end++;
+                }
+                snprintf(line, sizeof(line), "  %s %02d:%02d-%02d:%02d\n", q < QUARTERS_OF_DAY ? "today" : "tomorrow",
+                         (q % QUARTERS_OF_DAY) / 4, (q % 4) * 15,
+                         (end % QUARTERS_OF_DAY) / 4 + (end == QUARTERS_OF_DAY ? 24 : 0), (end % 4) * 15);
+                write(line);
+            }
+        }
+    }
+
+private:
+    typedef struct
+    {
+        LoadRequest_t request;
+        uint8_t plan[LOAD_SCHEDULER_PLAN_BYTES];      // bit per quarter since today's midnight
+        uint8_t confirmed[LOAD_SCHEDULER_PLAN_BYTES]; // seen running, same indexing
+        int plannedQuarters;
+        bool shortOfQuarters;
+        bool dirty;
+    } LoadState_t;
+
+    mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    LoadRequest_t pending[SCHEDULED_LOAD_COUNT] = {};
+    bool hasPending[SCHEDULED_LOAD_COUNT] = {};
+    LoadState_t loads[SCHEDULED_LOAD_COUNT] = {};
+    LoadState_t published[SCHEDULED_LOAD_COUNT] = {}; // copy for report(), under lock
+
+    // Inputs per quarter since today's midnight
+    float buyPrice[QUARTERS_TWO_DAYS];
+    float sellPrice[QUARTERS_TWO_DAYS];
+    float surplusWh[QUARTERS_TWO_DAYS];
+    int quarterCount = 0;
+    time_t pricesUpdated = 0;
+    uint32_t day = 0;
+    volatile int lastQuarter = -1;
+
+    // Scratch for plan()
+    float cost[QUARTERS_TWO_DAYS];
+    uint8_t candidates[QUARTERS_TWO_DAYS];
+
+    LoadScheduler() {}
+
+    void updateState(const ElectricityPriceTwoDays_t &prices, const SolarIntelligenceSettings_t &settings,
+                     ProductionPredictor &production, ConsumptionPredictor &consumption)
+    {
+        applyPendingRequests();
+
+        bool anyRequest = false;
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            anyRequest |= loads[i].request.energyWh > 0;
+        }
+        if (!anyRequest || prices.updated == 0)
+        {
+            return;
+        }
+
+        time_t now = time(nullptr);
+        struct tm t;
+        localtime_r(&now, &t);
+        uint32_t today = (t.tm_year + 1900) * 1000 + t.tm_yday;
+        int currentQuarter = (t.tm_hour * 60 + t.tm_min) / 15;
+
+        if (today != day || prices.updated != pricesUpdated)
+        {
+            finishQuarters(today == day ? currentQuarter : QUARTERS_OF_DAY);
+            if (today != day)
+            {
+                shiftConfirmed();
+            }
+            day = today;
+            pricesUpdated = prices.updated;
+            lastQuarter = currentQuarter;
+            refreshInputs(prices, settings, production, consumption, t);
+        }
+        else if (currentQuarter != lastQuarter)
+        {
+            finishQuarters(currentQuarter);
+            for (int q = lastQuarter; q < currentQuarter; q++)
+            {
+                refreshTomorrowSurplus(q, production, consumption, t);
+            }
+            lastQuarter = currentQuarter;
+        }
+
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            if (loads[i].dirty)
+            {
+                plan((ScheduledLoad_t)i, t);
+            }
+        }
+    }
+
+    static bool isPlanned(const LoadState_t &load, int quarter)
+    {
+        return (load.plan[quarter / 8] >> (quarter % 8)) & 1;
+    }
+
+    static bool isConfirmed(const LoadState_t &load, int quarter)
+    {
+        return (load.confirmed[quarter / 8] >> (quarter % 8)) & 1;
+    }
+
+    /**
+     * Move confirmations made after midnight, before update() saw the new
+     * day, from tomorrow's half to today's.
+     */
+    void shiftConfirmed()
+    {
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            uint8_t *confirmed = loads[i].confirmed;
+            memmove(confirmed, confirmed + QUARTERS_OF_DAY / 8, QUARTERS_OF_DAY / 8);
+            memset(confirmed + QUARTERS_OF_DAY / 8, 0, LOAD_SCHEDULER_PLAN_BYTES - QUARTERS_OF_DAY / 8);
+        }
+    }
+
+    void applyPendingRequests()
+    {
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            if (hasPending[i])
+            {
+                loads[i].request = pending[i];
+                loads[i].dirty = true;
+                hasPending[i] = false;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            if (loads[i].dirty && loads[i].request.energyWh == 0)
+            {
+                memset(loads[i].plan, 0, sizeof(loads[i].plan));
+                memset(loads[i].confirmed, 0, sizeof(loads[i].confirmed));
+                loads[i].plannedQuarters = 0;
+                loads[i].dirty = false;
+            }
+        }
+    }
+
+    /**
+     * Deduct the energy of confirmed planned quarters before endQuarter (of
+     * the day seen last) and drop them from the plan. A planned quarter the
+     * load didn't run in keeps its energy and the load is re-planned.
+     */
+    void finishQuarters(int endQuarter)
+    {
+        if (lastQuarter < 0)
+        {
+            return;
+        }
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            LoadState_t &load = loads[i];
+            for (int q = lastQuarter; q < endQuarter; q++)
+            {
+                if (isPlanned(load, q))
+                {
+                    if (isConfirmed(load, q))
+                    {
+                        load.request.energyWh -= min(load.request.energyWh, (uint32_t)max(1, load.request.maxPowerW / 4));
+                    }
+                    else
+                    {
+                        LOGD("[LoadScheduler] %s didn't run in quarter %d", loadName((ScheduledLoad_t)i), q);
+                        load.dirty = true;
+                    }
+                    load.plan[q / 8] &= ~(1 << (q % 8));
+                    load.plannedQuarters--;
+                }
+                load.confirmed[q / 8] &= ~(1 << (q % 8));
+            }
+            if (load.request.energyWh > 0 && time(nullptr) >= load.request.deadline)
+            {
+                LOGW("[LoadScheduler] %s missed its deadline, %lu Wh left", loadName((ScheduledLoad_t)i), (unsigned long)load.request.energyWh);
+                load.request.energyWh = 0;
+            }
+            if (load.request.energyWh == 0 && load.plannedQuarters > 0)
+            {
+                LOGI("[LoadScheduler] %s done", loadName((ScheduledLoad_t)i));
+                memset(load.plan, 0, sizeof(load.plan));
+                load.plannedQuarters = 0;
+            }
+        }
+    }
+
+    void refreshInputs(const ElectricityPriceTwoDays_t &prices, const SolarIntelligenceSettings_t &settings,
+                       ProductionPredictor &production, ConsumptionPredictor &consumption, const struct tm &now)
+    {
+        quarterCount = prices.hasTomorrowData ? QUARTERS_TWO_DAYS : QUARTERS_OF_DAY;
+        for (int q = 0; q < quarterCount; q++)
+        {
+            buyPrice[q] = calculateBuyPrice(prices.prices[q].electricityPrice, settings);
+            sellPrice[q] = calculateSellPrice(prices.prices[q].electricityPrice, settings);
+        }
+        for (int q = 0; q < QUARTERS_OF_DAY; q++)
+        {
+            surplusWh[q] = max(0.0f, production.predictQuarterlyProduction(now.tm_mon, q) -
+                                         consumption.predictQuarterlyConsumption(now.tm_wday, q));
+            refreshTomorrowSurplus(q, production, consumption, now);
+        }
+        for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+        {
+            loads[i].dirty |= loads[i].request.energyWh > 0;
+        }
+    }
+
+    void refreshTomorrowSurplus(int quarterOfDay, ProductionPredictor &production, ConsumptionPredictor &consumption, const struct tm &now)
+    {
+        if (quarterCount <= QUARTERS_OF_DAY)
+        {
+            return;
+        }
+        struct tm tomorrow = now;
+        tomorrow.tm_mday++;
+        tomorrow.tm_hour = 12;
+        tomorrow.tm_isdst = -1;
+        mktime(&tomorrow);
+        int q = QUARTERS_OF_DAY + quarterOfDay;
+        float surplus = max(0.0f, production.predictQuarterlyProduction(tomorrow.tm_mon, quarterOfDay) -
+                                      consumption.predictQuarterlyConsumption(tomorrow.tm_wday, quarterOfDay));
+        if (surplus != surplusWh[q])
+        {
+            surplusWh[q] = surplus;
+            for (int i = 0; i < SCHEDULED_LOAD_COUNT; i++)
+            {
+                loads[i].dirty |= loads[i].request.energyWh > 0;
+            }
+        }
+    }
+
+    void plan(ScheduledLoad_t id, const struct tm &t)
+    {
+        LoadState_t &load = loads[id];
+        load.dirty = false;
+        memset(load.plan, 0, sizeof(load.plan));
+        load.plannedQuarters = 0;
+        load.shortOfQuarters = false;
+        if (load.request.energyWh == 0 || load.request.maxPowerW == 0)
+        {
+            return;
+        }
+
+        struct tm midnight = t;
+        midnight.tm_hour = 0;
+        midnight.tm_min = 0;
+        midnight.tm_sec = 0;
+        midnight.tm_isdst = -1;
+        time_t dayStart = mktime(&midnight);
+        int end = min((int)((load.request.deadline - dayStart) / 900), quarterCount);
+
+        uint32_t quarterWh = max(1, load.request.maxPowerW / 4);
+        int count = 0;
+        for (int q = lastQuarter; q < end; q++)
+        {
+            float fromPv = min((float)quarterWh, surplusWh[q]);
+            cost[q] = fromPv * sellPrice[q] + (quarterWh - fromPv) * buyPrice[q];
+            candidates[count++] = q;
+        }
+        // Cheapest first, earlier quarter on equal cost
+        std::stable_sort(candidates, candidates + count, [this](uint8_t a, uint8_t b) {
+            return cost[a] < cost[b];
+        });
+
+        int needed = (load.request.energyWh + quarterWh - 1) / quarterWh;
+        load.shortOfQuarters = needed > count;
+        for (int i = 0; i < min(needed, count); i++)
+        {
+            load.plan[candidates[i] / 8] |= 1 << (candidates[i] % 8);
+        }
+        load.plannedQuarters = min(needed, count);
+        LOGI("[LoadScheduler] %s: %d of %d quarters planned before quarter %d", loadName(id), load.plannedQuarters, needed, end);
+    }
+};
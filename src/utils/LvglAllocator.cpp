@@ -0,0 +1,166 @@
+#include "LvglAllocator.h"
+
+#include <string.h>
+#include <esp_heap_caps.h>
+#include <multi_heap.h>
+#include <freertos/FreeRTOS.h>
+
+static uint8_t *pool = nullptr;
+static multi_heap_handle_t poolHeap = nullptr;
+static bool poolInitialized = false;
+static portMUX_TYPE poolLock = portMUX_INITIALIZER_UNLOCKED;
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static lvgl_alloc_stats_t stats = {};
+
+static void initPool()
+{
+    poolInitialized = true;
+    if (LVGL_ALLOC_INTERNAL_POOL_SIZE == 0)
+    {
+        return;
+    }
+    pool = (uint8_t *)heap_caps_malloc(LVGL_ALLOC_INTERNAL_POOL_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (pool == nullptr)
+    {
+        return;
+    }
+    poolHeap = multi_heap_register(pool, LVGL_ALLOC_INTERNAL_POOL_SIZE);
+    if (poolHeap == nullptr)
+    {
+        heap_caps_free(pool);
+        pool = nullptr;
+        return;
+    }
+    multi_heap_set_lock(poolHeap, &poolLock);
+    stats.internalSize = multi_heap_free_size(poolHeap);
+}
+
+static inline bool inPool(const void *ptr)
+{
+    return pool != nullptr && (const uint8_t *)ptr >= pool && (const uint8_t *)ptr < pool + LVGL_ALLOC_INTERNAL_POOL_SIZE;
+}
+
+static void trackPsram(int32_t delta)
+{
+    portENTER_CRITICAL(&statsLock);
+    stats.psramUsed += delta;
+    if (stats.psramUsed > stats.psramPeak)
+    {
+        stats.psramPeak = stats.psramUsed;
+    }
+    if (delta > 0)
+    {
+        stats.psramAllocs++;
+    }
+    portEXIT_CRITICAL(&statsLock);
+}
+
+static void *allocPsram(size_t size)
+{
+    void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (ptr != nullptr)
+    {
+        trackPsram(heap_caps_get_allocated_size(ptr));
+    }
+    return ptr;
+}
+
+extern "C" void *lvgl_alloc(size_t size)
+{
+    if (!poolInitialized)
+    {
+        initPool();
+    }
+    if (poolHeap != nullptr && size <= LVGL_ALLOC_SMALL_MAX)
+    {
+        void *ptr = multi_heap_malloc(poolHeap, size);
+        portENTER_CRITICAL(&statsLock);
+        if (ptr != nullptr)
+        {
+            stats.internalAllocs++;
+        }
+        else
+        {
+            stats.fallbacks++;
+        }
+        portEXIT_CRITICAL(&statsLock);
+        if (ptr != nullptr)
+        {
+            return ptr;
+        }
+    }
+    return allocPsram(size);
+}
+
+extern "C" void lvgl_free(void *ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    if (inPool(ptr))
+    {
+        multi_heap_free(poolHeap, ptr);
+        return;
+    }
+    trackPsram(-(int32_t)heap_caps_get_allocated_size(ptr));
+    heap_caps_free(ptr);
+}
+
+extern "C" void *lvgl_realloc(void *ptr, size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return lvgl_alloc(size);
+    }
+    if (size == 0)
+    {
+        lvgl_free(ptr);
+        return nullptr;
+    }
+
+    size_t oldSize = inPool(ptr) ? multi_heap_get_allocated_size(poolHeap, ptr) : heap_caps_get_allocated_size(ptr);
+    if (!inPool(ptr) && size > LVGL_ALLOC_SMALL_MAX)
+    {
+        // Stays in PSRAM
+        void *result = heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM);
+        if (result != nullptr)
+        {
+            trackPsram(-(int32_t)oldSize);
+            trackPsram(heap_caps_get_allocated_size(result));
+        }
+        return result;
+    }
+    if (inPool(ptr) && size <= LVGL_ALLOC_SMALL_MAX)
+    {
+        void *result = multi_heap_realloc(poolHeap, ptr, size);
+        if (result != nullptr)
+        {
+            return result;
+        }
+    }
+
+    // Moving between regions
+    void *result = lvgl_alloc(size);
+    if (result != nullptr)
+    {
+        memcpy(result, ptr, oldSize < size ? oldSize : size);
+        lvgl_free(ptr);
+    }
+    return result;
+}
+
+extern "C" void lvgl_alloc_get_stats(lvgl_alloc_stats_t *out)
+{
+    portENTER_CRITICAL(&statsLock);
+    *out = stats;
+    portEXIT_CRITICAL(&statsLock);
+    if (poolHeap != nullptr)
+    {
+        multi_heap_info_t info;
+        multi_heap_get_info(poolHeap, &info);
+        out->internalUsed = out->internalSize - info.total_free_bytes;
+        out->internalPeak = out->internalSize - info.minimum_free_bytes;
+        out->internalLargestFree = info.largest_free_block;
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef lvglallocator_h
+#define lvglallocator_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * LVGL memory manager (LV_MEM_CUSTOM_ALLOC & co. in lv_conf.h).
+ *
+ * With LVGL_ALLOC_INTERNAL_POOL_SIZE set, small allocations - style lists,
+ * draw descriptors, masks, label texts - are served from a bounded internal
+ * RAM pool (TLSF multi_heap), everything else and everything that doesn't
+ * fit goes to PSRAM as before. The pool is off by default: its frame time
+ * gain hasn't been measured yet, and the internal heap it takes is the one
+ * the TLS price and rate downloads need.
+ * Plain C interface, LVGL itself is compiled as C.
+ */
+
+/* Internal RAM reserved for LVGL, 0 = all allocations in PSRAM. Opt in for A/B
+ * frame time comparison, e.g. -DLVGL_ALLOC_INTERNAL_POOL_SIZE=32768 */
+#ifndef LVGL_ALLOC_INTERNAL_POOL_SIZE
+#define LVGL_ALLOC_INTERNAL_POOL_SIZE 0
+#endif
+/* Largest allocation served from the internal pool */
+#ifndef LVGL_ALLOC_SMALL_MAX
+#define LVGL_ALLOC_SMALL_MAX 256
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint32_t internalSize;     /* pool size, 0 if not available */
+    uint32_t internalUsed;
+    uint32_t internalPeak;
+    uint32_t internalLargestFree;
+    uint32_t psramUsed;        /* bytes currently allocated by LVGL in PSRAM */
+    uint32_t psramPeak;
+    uint32_t internalAllocs;   /* total number of allocations per region */
+    uint32_t psramAllocs;
+    uint32_t fallbacks;        /* small allocations that didn't fit into the pool */
+} lvgl_alloc_stats_t;
+
+void *lvgl_alloc(size_t size);
+void lvgl_free(void *ptr);
+void *lvgl_realloc(void *ptr, size_t size);
+void lvgl_alloc_get_stats(lvgl_alloc_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
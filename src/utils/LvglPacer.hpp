@@ -0,0 +1,112 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define LVGL_PACER_DEFAULT_FPS 60
+#define LVGL_PACER_IDLE_PERIOD_MS 50      // touch polling rate when nothing is animating
+#define LVGL_PACER_MAX_SLEEP_MS 500       // upper bound for time-to-next-timer
+#define LVGL_PACER_INPUT_HOLD_MS 1000     // keep full rate this long after the last touch
+#define LVGL_PACER_DISPLAY_OFF_POLL_MS 100
+
+/**
+ * Decides how long the LVGL task sleeps between lv_timer_handler() calls.
+ *
+ * While something animates, a touch is in progress or areas are invalidated,
+ * the task follows the time-to-next-timer returned by lv_timer_handler(),
+ * limited by the frame rate cap of the current screen. Otherwise it only
+ * polls the touch panel at LVGL_PACER_IDLE_PERIOD_MS.
+ *
+ * Other tasks call wake() after changing widgets so the change is rendered
+ * right away and not after the idle period.
+ */
+class LvglPacer
+{
+public:
+    static LvglPacer &instance()
+    {
+        static LvglPacer inst;
+        return inst;
+    }
+
+    /**
+     * Register the task running lv_timer_handler(), wake() notifies it.
+     */
+    void attach(TaskHandle_t task)
+    {
+        this->task = task;
+    }
+
+    /**
+     * Render pending changes as soon as possible. Callable from any task.
+     */
+    void wake()
+    {
+        if (task != nullptr)
+        {
+            xTaskNotifyGive(task);
+        }
+    }
+
+    /**
+     * Frame rate cap of the current screen, set by ScreenManager.
+     */
+    void setMaxFrameRate(uint8_t fps)
+    {
+        minFramePeriodMs = 1000 / (fps > 0 ? fps : LVGL_PACER_DEFAULT_FPS);
+    }
+
+    /**
+     * Touch panel is pressed - called from the indev read callback.
+     */
+    void onInput()
+    {
+        lastInputMillis = millis();
+    }
+
+    /**
+     * Sleep period after lv_timer_handler(). Call with lvgl_mutex held.
+     * @param timeToNextTimer return value of lv_timer_handler()
+     */
+    uint32_t nextPeriod(uint32_t timeToNextTimer)
+    {
+        uint32_t period = timeToNextTimer;
+        if (!isBusy())
+        {
+            period = max(period, (uint32_t)LVGL_PACER_IDLE_PERIOD_MS);
+        }
+        period = max(period, minFramePeriodMs);
+        return min(period, (uint32_t)LVGL_PACER_MAX_SLEEP_MS);
+    }
+
+    /**
+     * Block the LVGL task for up to periodMs, returns early on wake().
+     */
+    void sleep(uint32_t periodMs)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(periodMs));
+    }
+
+private:
+    TaskHandle_t task = nullptr;
+    volatile uint32_t minFramePeriodMs = 1000 / LVGL_PACER_DEFAULT_FPS;
+    volatile unsigned long lastInputMillis = 0;
+
+    LvglPacer() {}
+
+    bool isBusy()
+    {
+        if (millis() - lastInputMillis < LVGL_PACER_INPUT_HOLD_MS)
+        {
+            return true;
+        }
+        if (lv_anim_count_running() > 0)
+        {
+            return true;
+        }
+        lv_disp_t *disp = lv_disp_get_default();
+        return disp != nullptr && disp->inv_p > 0;
+    }
+};
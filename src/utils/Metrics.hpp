@@ -0,0 +1,296 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <RemoteLogger.hpp>
+
+/**
+ * Fixed-size registry of counters, gauges and histograms exported in
+ * Prometheus text format (/metrics).
+ *
+ * Metrics are registered lazily by name + labels and never freed, so callers
+ * cache the returned pointer in a function-local static:
+ *
+ *   static MetricHistogram *h = Metrics::instance().histogram("x_us", "help", BUCKETS, n);
+ *   h->observe(elapsedUs);
+ *
+ * Updates take a short spinlock and are safe from any task on either core.
+ */
+
+#define METRICS_MAX_ENTRIES 48
+#define METRICS_MAX_BUCKETS 12
+
+typedef enum
+{
+    METRIC_COUNTER,
+    METRIC_GAUGE,
+    METRIC_HISTOGRAM
+} MetricType_t;
+
+class Metrics;
+
+class MetricCounter
+{
+public:
+    void inc(uint32_t delta = 1);
+    uint32_t get() const { return value; }
+
+private:
+    friend class Metrics;
+    volatile uint32_t value = 0;
+};
+
+class MetricGauge
+{
+public:
+    void set(float v);
+    float get() const { return value; }
+
+private:
+    friend class Metrics;
+    volatile float value = 0;
+};
+
+class MetricHistogram
+{
+public:
+    void observe(float v);
+
+private:
+    friend class Metrics;
+    const float *bounds = nullptr;
+    uint8_t boundsCount = 0;
+    uint32_t buckets[METRICS_MAX_BUCKETS + 1] = {0}; // last one is +Inf
+    uint32_t count = 0;
+    double sum = 0;
+};
+
+// Common bucket layouts
+static const float METRICS_BUCKETS_US[] = {250, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 500000};
+static const float METRICS_BUCKETS_MS[] = {50, 100, 250, 500, 1000, 2000, 5000, 10000, 20000};
+static const float METRICS_BUCKETS_COUNT[] = {1, 2, 4, 8, 16, 32, 64};
+#define METRICS_BUCKETS_LEN(b) (sizeof(b) / sizeof(b[0]))
+
+class Metrics
+{
+public:
+    static Metrics &instance()
+    {
+        static Metrics inst;
+        return inst;
+    }
+
+    MetricCounter *counter(const char *name, const char *help, const char *labels = "")
+    {
+        Entry_t *e = findOrCreate(name, help, labels, METRIC_COUNTER);
+        return e ? &e->counter : &dummyCounter;
+    }
+
+    MetricGauge *gauge(const char *name, const char *help, const char *labels = "")
+    {
+        Entry_t *e = findOrCreate(name, help, labels, METRIC_GAUGE);
+        return e ? &e->gauge : &dummyGauge;
+    }
+
+    MetricHistogram *histogram(const char *name, const char *help, const float *bounds, uint8_t boundsCount, const char *labels = "")
+    {
+        Entry_t *e = findOrCreate(name, help, labels, METRIC_HISTOGRAM);
+        if (e == nullptr)
+        {
+            return &dummyHistogram;
+        }
+        if (e->histogram.bounds == nullptr)
+        {
+            e->histogram.bounds = bounds;
+            e->histogram.boundsCount = boundsCount > METRICS_MAX_BUCKETS ? METRICS_MAX_BUCKETS : boundsCount;
+        }
+        return &e->histogram;
+    }
+
+    /**
+     * Refresh gauges that are sampled on scrape instead of on change.
+     */
+    void updateSystemGauges()
+    {
+        static MetricGauge *heapFree = gauge("heap_free_bytes", "Free heap (all capabilities)");
+        static MetricGauge *heapMinFree = gauge("heap_min_free_bytes", "Minimum free heap since boot");
+        static MetricGauge *internalFree = gauge("heap_internal_free_bytes", "Free internal RAM");
+        static MetricGauge *internalLargest = gauge("heap_internal_largest_block_bytes", "Largest free internal RAM block");
+        static MetricGauge *psramFree = gauge("psram_free_bytes", "Free PSRAM");
+        static MetricGauge *rssi = gauge("wifi_rssi_dbm", "Wi-Fi signal strength");
+        static MetricGauge *uptime = gauge("uptime_seconds", "Time since boot");
+
+        heapFree->set(ESP.getFreeHeap());
+        heapMinFree->set(ESP.getMinFreeHeap());
+        internalFree->set(heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+        internalLargest->set(heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+        psramFree->set(heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+        rssi->set(WiFi.isConnected() ? WiFi.RSSI() : 0);
+        uptime->set(millis() / 1000);
+    }
+
+    /**
+     * Render all metrics in Prometheus text exposition format.
+     * @param write called for every output line (already newline terminated)
+     */
+    template <typename Writer>
+    void render(Writer write)
+    {
+        char line[192];
+        uint8_t n = entryCount;
+        for (uint8_t i = 0; i < n; i++)
+        {
+            if (!isFirstWithName(i))
+            {
+                continue;
+            }
+            // Prometheus requires all samples of one family to be grouped
+            static const char *typeNames[] = {"counter", "gauge", "histogram"};
+            snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s %s\n", entries[i].name, entries[i].help, entries[i].name, typeNames[entries[i].type]);
+            write(line);
+            for (uint8_t j = i; j < n; j++)
+            {
+                if (strcmp(entries[j].name, entries[i].name) == 0)
+                {
+                    renderEntry(entries[j], line, sizeof(line), write);
+                }
+            }
+        }
+    }
+
+private:
+    friend class MetricCounter;
+    friend class MetricGauge;
+    friend class MetricHistogram;
+
+    typedef struct
+    {
+        const char *name;
+        const char *help;
+        const char *labels;
+        MetricType_t type;
+        MetricCounter counter;
+        MetricGauge gauge;
+        MetricHistogram histogram;
+    } Entry_t;
+
+    Entry_t entries[METRICS_MAX_ENTRIES];
+    volatile uint8_t entryCount = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    // Returned when the registry is full, so callers never have to null-check
+    MetricCounter dummyCounter;
+    MetricGauge dummyGauge;
+    MetricHistogram dummyHistogram;
+
+    Metrics() {}
+
+    Entry_t *findOrCreate(const char *name, const char *help, const char *labels, MetricType_t type)
+    {
+        portENTER_CRITICAL(&lock);
+        for (uint8_t i = 0; i < entryCount; i++)
+        {
+            if (strcmp(entries[i].name, name) == 0 && strcmp(entries[i].labels, labels) == 0)
+            {
+                portEXIT_CRITICAL(&lock);
+                return &entries[i];
+            }
+        }
+        if (entryCount >= METRICS_MAX_ENTRIES)
+        {
+            portEXIT_CRITICAL(&lock);
+            LOGW("[Metrics] Registry full, %s{%s} not registered", name, labels);
+            return nullptr;
+        }
+        Entry_t &e = entries[entryCount];
+        e.name = name;
+        e.help = help;
+        e.labels = labels;
+        e.type = type;
+        entryCount = entryCount + 1;
+        portEXIT_CRITICAL(&lock);
+        return &e;
+    }
+
+    bool isFirstWithName(uint8_t index) const
+    {
+        for (uint8_t i = 0; i < index; i++)
+        {
+            if (strcmp(entries[i].name, entries[index].name) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Writer>
+    void renderEntry(Entry_t &e, char *line, size_t lineSize, Writer &write)
+    {
+        const char *open = e.labels[0] ? "{" : "";
+        const char *close = e.labels[0] ? "}" : "";
+        switch (e.type)
+        {
+        case METRIC_COUNTER:
+            snprintf(line, lineSize, "%s%s%s%s %lu\n", e.name, open, e.labels, close, (unsigned long)e.counter.value);
+            write(line);
+            break;
+        case METRIC_GAUGE:
+            snprintf(line, lineSize, "%s%s%s%s %g\n", e.name, open, e.labels, close, (double)e.gauge.value);
+            write(line);
+            break;
+        case METRIC_HISTOGRAM:
+        {
+            // Copy under lock so buckets, count and sum are consistent
+            MetricHistogram h;
+            portENTER_CRITICAL(&lock);
+            h = e.histogram;
+            portEXIT_CRITICAL(&lock);
+
+            const char *sep = e.labels[0] ? "," : "";
+            uint32_t cumulative = 0;
+            for (uint8_t b = 0; b < h.boundsCount; b++)
+            {
+                cumulative += h.buckets[b];
+                snprintf(line, lineSize, "%s_bucket{%s%sle=\"%g\"} %lu\n", e.name, e.labels, sep, (double)h.bounds[b], (unsigned long)cumulative);
+                write(line);
+            }
+            snprintf(line, lineSize, "%s_bucket{%s%sle=\"+Inf\"} %lu\n", e.name, e.labels, sep, (unsigned long)h.count);
+            write(line);
+            snprintf(line, lineSize, "%s_sum%s%s%s %g\n", e.name, open, e.labels, close, h.sum);
+            write(line);
+            snprintf(line, lineSize, "%s_count%s%s%s %lu\n", e.name, open, e.labels, close, (unsigned long)h.count);
+            write(line);
+            break;
+        }
+        }
+    }
+};
+
+inline void MetricCounter::inc(uint32_t delta)
+{
+    portENTER_CRITICAL(&Metrics::instance().lock);
+    value = value + delta;
+    portEXIT_CRITICAL(&Metrics::instance().lock);
+}
+
+inline void MetricGauge::set(float v)
+{
+    value = v;
+}
+
+inline void MetricHistogram::observe(float v)
+{
+    uint8_t b = 0;
+    while (b < boundsCount && v > bounds[b])
+    {
+        b++;
+    }
+    portENTER_CRITICAL(&Metrics::instance().lock);
+    buckets[b]++;
+    count++;
+    sum += v;
+    portEXIT_CRITICAL(&Metrics::instance().lock);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Arduino.h>
+#include <SolarIntelligence.h>
+#include <RemoteLogger.hpp>
+#include "Metrics.hpp"
+
+#define SIMULATION_SOC_TOLERANCE 2 // percent, smaller SOC moves don't change decisions
+
+typedef enum
+{
+    SIMULATION_UNCHANGED,      // skip, the last plan still holds
+    SIMULATION_SOC_DRIFT,      // only SOC moved beyond tolerance
+    SIMULATION_INPUTS_CHANGED  // prices, settings, predictions, quarter or forced
+} SimulationChange_t;
+
+/**
+ * Decides whether runIntelligenceTask() has to re-run the simulation.
+ *
+ * Fingerprints the simulation inputs - SOC, prices, the settings the
+ * simulation uses, predictor generation and the current quarter - and
+ * reports whether anything changed since the last run. That lets the
+ * decision loop check every minute while simulating only when the result
+ * can differ. Run times and skips are exported to /metrics.
+ */
+class SimulationGate
+{
+public:
+    /**
+     * The inputs are remembered as soon as a change is reported, the run
+     * submitted for them is expected to be applied. When it is not (the
+     * worker request was cancelled), call invalidate().
+     * @param forced run regardless of the fingerprint (invalidated by settings, prices, ...)
+     * @param predictorGeneration bumped whenever predictors learned a quarter
+     */
+    SimulationChange_t check(bool forced, int soc, const SolarPriceData_t &prices, const SolarIntelligenceSettings_t &settings,
+                             uint32_t predictorGeneration, int currentQuarter)
+    {
+        uint32_t fingerprint = FNV_OFFSET;
+        hash(fingerprint, &currentQuarter, sizeof(currentQuarter));
+        hash(fingerprint, &predictorGeneration, sizeof(predictorGeneration));
+        hash(fingerprint, &prices.hasTomorrowData, sizeof(prices.hasTomorrowData));
+        hash(fingerprint, prices.prices, sizeof(float) * (prices.hasTomorrowData ? SI_QUARTERS_TWO_DAYS : SI_QUARTERS_PER_DAY));
+        // Field by field, padding of the settings struct is not initialized
+        hash(fingerprint, &settings.enabled, sizeof(settings.enabled));
+        hash(fingerprint, &settings.minSocPercent, sizeof(settings.minSocPercent));
+        hash(fingerprint, &settings.maxSocPercent, sizeof(settings.maxSocPercent));
+        hash(fingerprint, &settings.batteryCapacityKwh, sizeof(settings.batteryCapacityKwh));
+        hash(fingerprint, &settings.batteryCostPerKwh, sizeof(settings.batteryCostPerKwh));
+        hash(fingerprint, &settings.maxChargePowerKw, sizeof(settings.maxChargePowerKw));
+        hash(fingerprint, &settings.maxDischargePowerKw, sizeof(settings.maxDischargePowerKw));
+        hash(fingerprint, &settings.buyK, sizeof(settings.buyK));
+        hash(fingerprint, &settings.buyQ, sizeof(settings.buyQ));
+        hash(fingerprint, &settings.sellK, sizeof(settings.sellK));
+        hash(fingerprint, &settings.sellQ, sizeof(settings.sellQ));
+
+        SimulationChange_t change = SIMULATION_UNCHANGED;
+        if (forced || !hasRun || fingerprint != lastFingerprint)
+        {
+            change = SIMULATION_INPUTS_CHANGED;
+        }
+        else if (abs(soc - lastSoc) >= SIMULATION_SOC_TOLERANCE)
+        {
+            change = SIMULATION_SOC_DRIFT;
+        }
+
+        if (change == SIMULATION_UNCHANGED)
+        {
+            static MetricCounter *skipped = Metrics::instance().counter("intelligence_simulations_total", "Intelligence simulation checks", "result=\"skipped\"");
+            skipped->inc();
+        }
+        else
+        {
+            lastFingerprint = fingerprint;
+            lastSoc = soc;
+            hasRun = true;
+        }
+        return change;
+    }
+
+    /**
+     * Forget the last inputs, the next check() reports a change. For runs
+     * that were cancelled before their plan was applied.
+     */
+    void invalidate()
+    {
+        hasRun = false;
+    }
+
+    /**
+     * Report the cost of a simulation started after check() returned a change.
+     */
+    void recordRun(SimulationChange_t change, unsigned long elapsedMs, uint32_t stackFreeBytes)
+    {
+        static MetricCounter *runs = Metrics::instance().counter("intelligence_simulations_total", "Intelligence simulation checks", "result=\"run\"");
+        static MetricHistogram *runTime = Metrics::instance().histogram("intelligence_simulation_ms", "Intelligence simulation run time", METRICS_BUCKETS_MS, METRICS_BUCKETS_LEN(METRICS_BUCKETS_MS));
+        static MetricGauge *stackFree = Metrics::instance().gauge("intelligence_worker_stack_free_bytes", "Lowest free stack of the intelligence worker");
+        runs->inc();
+        runTime->observe(elapsedMs);
+        stackFree->set(stackFreeBytes);
+        LOGI("Simulation took %lu ms (%s), stack free %lu B", elapsedMs, change == SIMULATION_SOC_DRIFT ? "SOC drift" : "inputs changed",
+             (unsigned long)stackFreeBytes);
+    }
+
+private:
+    static const uint32_t FNV_OFFSET = 2166136261u;
+    static const uint32_t FNV_PRIME = 16777619u;
+
+    uint32_t lastFingerprint = 0;
+    int lastSoc = 0;
+    bool hasRun = false;
+
+    static void hash(uint32_t &h, const void *data, size_t length)
+    {
+        const uint8_t *bytes = (const uint8_t *)data;
+        for (size_t i = 0; i < length; i++)
+        {
+            h = (h ^ bytes[i]) * FNV_PRIME;
+        }
+    }
+};
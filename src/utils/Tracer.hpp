@@ -0,0 +1,186 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <RemoteLogger.hpp>
+#include "../consts.h"
+
+/**
+ * Scoped span tracing, exported as Chrome/Perfetto trace JSON (/trace).
+ *
+ * Enable with -DTRACING=1. When disabled, TRACE_SCOPE() expands to nothing
+ * and no buffers are allocated.
+ *
+ * Each core has its own ring of completed spans in PSRAM. A slot is reserved
+ * with an atomic increment and written once when the span ends, so recording
+ * never takes a lock. Readers may see a span that is being overwritten - the
+ * trace is diagnostic, so such a slot is simply skipped.
+ */
+
+#define TRACE_EVENTS_PER_CORE 2048
+
+#if TRACING
+
+typedef struct
+{
+    const char *name;
+    TaskHandle_t task;
+    char taskName[configMAX_TASK_NAME_LEN]; // copied, the task may be gone at export time
+    int64_t startUs;
+    uint32_t durationUs;
+    uint32_t seq; // 0 = slot being written
+} TraceEvent_t;
+
+class Tracer
+{
+public:
+    static Tracer &instance()
+    {
+        static Tracer inst;
+        return inst;
+    }
+
+    bool begin()
+    {
+        if (events[0] != nullptr)
+        {
+            return true;
+        }
+        for (int core = 0; core < portNUM_PROCESSORS; core++)
+        {
+            events[core] = (TraceEvent_t *)heap_caps_calloc(TRACE_EVENTS_PER_CORE, sizeof(TraceEvent_t), MALLOC_CAP_SPIRAM);
+            if (events[core] == nullptr)
+            {
+                LOGE("[Tracer] Failed to allocate ring for core %d", core);
+                return false;
+            }
+        }
+        LOGI("[Tracer] Enabled, %d events per core", TRACE_EVENTS_PER_CORE);
+        return true;
+    }
+
+    inline void record(const char *name, int64_t startUs, uint32_t durationUs)
+    {
+        int core = xPortGetCoreID();
+        TraceEvent_t *ring = events[core];
+        if (ring == nullptr)
+        {
+            return;
+        }
+        uint32_t seq = __atomic_add_fetch(&writeIndex[core], 1, __ATOMIC_RELAXED);
+        TraceEvent_t &e = ring[seq % TRACE_EVENTS_PER_CORE];
+        e.seq = 0;
+        e.name = name;
+        e.task = xTaskGetCurrentTaskHandle();
+        strlcpy(e.taskName, pcTaskGetName(NULL), sizeof(e.taskName));
+        e.startUs = startUs;
+        e.durationUs = durationUs;
+        __atomic_store_n(&e.seq, seq, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * Write all buffered spans as Chrome trace JSON.
+     * @param write called with consecutive pieces of the document
+     */
+    template <typename Writer>
+    void exportJson(Writer write)
+    {
+        char line[200];
+        bool first = true;
+        write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+        // Thread names - one metadata event per task seen in the rings
+        TaskHandle_t seen[24];
+        int seenCount = 0;
+        for (int core = 0; core < portNUM_PROCESSORS; core++)
+        {
+            if (events[core] == nullptr)
+            {
+                continue;
+            }
+            for (int i = 0; i < TRACE_EVENTS_PER_CORE; i++)
+            {
+                TraceEvent_t e = events[core][i];
+                if (e.seq == 0 || e.task == nullptr)
+                {
+                    continue;
+                }
+                bool known = false;
+                for (int s = 0; s < seenCount; s++)
+                {
+                    known |= seen[s] == e.task;
+                }
+                if (known || seenCount >= 24)
+                {
+                    continue;
+                }
+                seen[seenCount++] = e.task;
+                snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                         first ? "" : ",", (unsigned long)(uintptr_t)e.task, e.taskName);
+                write(line);
+                first = false;
+            }
+        }
+
+        for (int core = 0; core < portNUM_PROCESSORS; core++)
+        {
+            if (events[core] == nullptr)
+            {
+                continue;
+            }
+            for (int i = 0; i < TRACE_EVENTS_PER_CORE; i++)
+            {
+                TraceEvent_t e = events[core][i];
+                if (e.seq == 0 || e.name == nullptr)
+                {
+                    continue;
+                }
+                snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%lld,\"dur\":%lu,\"args\":{\"core\":%d}}",
+                         first ? "" : ",", e.name, (unsigned long)(uintptr_t)e.task, (long long)e.startUs, (unsigned long)e.durationUs, core);
+                write(line);
+                first = false;
+            }
+        }
+        write("]}");
+    }
+
+private:
+    Tracer() {}
+
+    TraceEvent_t *events[portNUM_PROCESSORS] = {nullptr};
+    uint32_t writeIndex[portNUM_PROCESSORS] = {0};
+};
+
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char *name) : name(name), startUs(esp_timer_get_time()) {}
+    ~TraceSpan()
+    {
+        Tracer::instance().record(name, startUs, (uint32_t)(esp_timer_get_time() - startUs));
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+    const char *name;
+    int64_t startUs;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+// name must be a string literal (or otherwise outlive the trace buffer)
+#define TRACE_SCOPE(name) TraceSpan TRACE_CONCAT(_traceSpan, __LINE__)(name)
+
+#else
+
+#define TRACE_SCOPE(name) \
+    do                    \
+    {                     \
+    } while (0)
+
+#endif
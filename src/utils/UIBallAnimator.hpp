@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <lvgl.h>
 #include "ui/ui.h"
+#include "FrameProfiler.hpp"
 
 #define BALLS_RADIUS 8
 #define MAX_BALLS_COUNT 6
@@ -10,47 +11,36 @@
 // Pre-computed style selector to avoid enum bitwise warning
 static const lv_style_selector_t LV_STYLE_SELECTOR_DEFAULT = (lv_style_selector_t)((int)LV_PART_MAIN | (int)LV_STATE_DEFAULT);
 
-typedef struct UIBallAnimationItem
-{
-    lv_obj_t *ball;
-    lv_anim_t posXAnimation;
-    lv_anim_t posYAnimation;
-} UIBallAnimationItem_t;
-
+/**
+ * Power flow animation between two containers.
+ *
+ * All balls of one flow are particles of a single custom-drawn object driven
+ * by one lv_anim_t. Each tick invalidates one area per path leg covering the
+ * particles that moved, instead of every ball invalidating its own old and
+ * new position. Balls travel along the first leg, then the second one, each
+ * ball delayed after the previous, and stay at the destination behind its
+ * container.
+ */
 class UIBallAnimator
 {
 public:
     void setup(lv_obj_t *parent, const ui_theme_variable_t *color)
     {
         this->parent = parent;
-        for (int i = 0; i < MAX_BALLS_COUNT; i++)
-        {
-            items[i].ball = lv_obj_create(parent);
-            lv_obj_remove_style_all(items[i].ball);
-
-            int radius = BALLS_RADIUS; // - i * (BALLS_RADIUS / ballsCount);
-            int opa = 255;             // - i * (128 / ballsCount);
-            lv_obj_set_width(items[i].ball, radius);
-            lv_obj_set_height(items[i].ball, radius);
-            lv_obj_clear_flag(items[i].ball, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE); /// Flags
-            lv_obj_set_style_radius(items[i].ball, radius / 2, LV_STYLE_SELECTOR_DEFAULT);
-            ui_object_set_themeable_style_property(items[i].ball, LV_STYLE_SELECTOR_DEFAULT, LV_STYLE_BG_COLOR, color);
-            // Shadows disabled for performance - they are very CPU intensive
-            // ui_object_set_themeable_style_property(items[i].ball, LV_STYLE_SELECTOR_DEFAULT, LV_STYLE_SHADOW_COLOR, color);
-            // lv_obj_set_style_shadow_width(items[i].ball, 16, LV_STYLE_SELECTOR_DEFAULT);
-
-            // ui_object_set_themeable_style_property(items[i].ball, LV_STYLE_SELECTOR_DEFAULT, LV_STYLE_BG_OPA, _ui_theme_alpha_pvColor);
-            lv_obj_set_style_bg_opa(items[i].ball, opa, LV_STYLE_SELECTOR_DEFAULT);
-            lv_obj_move_background(items[i].ball);
-
-            lv_anim_init(&items[i].posXAnimation);
-            lv_anim_set_exec_cb(&items[i].posXAnimation, (lv_anim_exec_xcb_t)lv_obj_set_x);
-            lv_anim_set_var(&items[i].posXAnimation, items[i].ball);
-
-            lv_anim_init(&items[i].posYAnimation);
-            lv_anim_set_exec_cb(&items[i].posYAnimation, (lv_anim_exec_xcb_t)lv_obj_set_y);
-            lv_anim_set_var(&items[i].posYAnimation, items[i].ball);
-        }
+
+        // Particles take the themeable bg color of this object, its own background is not drawn
+        flow = lv_obj_create(parent);
+        lv_obj_remove_style_all(flow);
+        lv_obj_clear_flag(flow, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        ui_object_set_themeable_style_property(flow, LV_STYLE_SELECTOR_DEFAULT, LV_STYLE_BG_COLOR, color);
+        lv_obj_set_user_data(flow, this);
+        lv_obj_add_event_cb(flow, onDraw, LV_EVENT_DRAW_MAIN, this);
+        lv_obj_add_flag(flow, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_move_background(flow);
+
+        lv_anim_init(&animation);
+        lv_anim_set_exec_cb(&animation, onAnimation);
+        lv_anim_set_var(&animation, flow);
 
         hLine = lv_obj_create(parent);
         lv_obj_set_style_bg_color(hLine, lv_color_black(), LV_STYLE_SELECTOR_DEFAULT);
@@ -66,14 +56,18 @@ public:
         lv_obj_move_background(vLine);
     }
 
+    /**
+     * Register the flow with the frame profiler under given group name.
+     */
+    void trackWithProfiler(const char *group)
+    {
+        FrameProfiler::instance().track(flow, group);
+    }
+
     ~UIBallAnimator()
     {
-        for (int i = 0; i < MAX_BALLS_COUNT; i++)
-        {
-            lv_anim_del(&items[i].posXAnimation, (lv_anim_exec_xcb_t)lv_obj_set_x);
-            lv_anim_del(&items[i].posYAnimation, (lv_anim_exec_xcb_t)lv_obj_set_y);
-            lv_obj_del(items[i].ball);
-        }
+        lv_anim_del(flow, onAnimation);
+        lv_obj_del(flow);
         lv_obj_del(vLine);
         lv_obj_del(hLine);
     }
@@ -91,9 +85,6 @@ public:
         int distanceX = centerDestinationX - centerStartX;
         int distanceY = centerDestinationY - centerStartY;
 
-        int xDelay = direction ? 0 : duration / 2;
-        int yDelay = direction ? duration / 2 : 0;
-        int ballDelay = duration / MAX_BALLS_COUNT / 2; // duration / ballsCount / 2;
         int lineWidth = 3;
         lv_obj_set_pos(vLine, (direction == 0 ? centerStartX : centerDestinationX) - lineWidth / 2 + xOffset, (distanceY > 0 ? centerStartY : centerDestinationY) + yOffset - lineWidth / 2);
         lv_obj_set_size(vLine, 3, abs(distanceY) + 3);
@@ -104,42 +95,147 @@ public:
         lv_obj_clear_flag(vLine, LV_OBJ_FLAG_HIDDEN);
         lv_obj_clear_flag(hLine, LV_OBJ_FLAG_HIDDEN);
 
-        for (int i = 0; i < MAX_BALLS_COUNT; i++)
-        {
-            if(i >= ballsCount)
-            {
-                lv_obj_add_flag(items[i].ball, LV_OBJ_FLAG_HIDDEN);
-                continue;
-            }
-            lv_obj_clear_flag(items[i].ball, LV_OBJ_FLAG_HIDDEN);
-
-            int radius = BALLS_RADIUS; // - i * (BALLS_RADIUS / ballsCount);
-            lv_obj_set_pos(items[i].ball, centerStartX - radius / 2 + xOffset, centerStartY - radius / 2 + yOffset);
-            lv_anim_set_time(&items[i].posXAnimation, duration / 2);
-            lv_anim_set_values(&items[i].posXAnimation, centerStartX - radius / 2 + xOffset, centerStartX + distanceX - radius / 2 + xOffset);
-            lv_anim_set_delay(&items[i].posXAnimation, delay + i * ballDelay + xDelay);
-            lv_anim_start(&items[i].posXAnimation);
-
-            lv_anim_set_time(&items[i].posYAnimation, duration / 2);
-            lv_anim_set_values(&items[i].posYAnimation, centerStartY - radius / 2 + yOffset, centerStartY + distanceY - radius / 2 + yOffset);
-            lv_anim_set_delay(&items[i].posYAnimation, delay + i * ballDelay + yDelay);
-            lv_anim_start(&items[i].posYAnimation);
-        }
+        // Balls restart from the source, redraw where they were
+        lv_obj_invalidate(flow);
+
+        path.startX = centerStartX - BALLS_RADIUS / 2 + xOffset;
+        path.startY = centerStartY - BALLS_RADIUS / 2 + yOffset;
+        path.distanceX = distanceX;
+        path.distanceY = distanceY;
+        path.legTime = LV_MAX(duration / 2, 1);
+        path.xDelay = direction ? 0 : duration / 2;
+        path.yDelay = direction ? duration / 2 : 0;
+        path.delay = delay;
+        path.ballDelay = duration / MAX_BALLS_COUNT / 2;
+        path.ballsCount = ballsCount;
+        elapsed = 0;
+
+        originX = LV_MIN(path.startX, path.startX + distanceX);
+        originY = LV_MIN(path.startY, path.startY + distanceY);
+        lv_obj_set_pos(flow, originX, originY);
+        lv_obj_set_size(flow, abs(distanceX) + BALLS_RADIUS, abs(distanceY) + BALLS_RADIUS);
+        lv_obj_clear_flag(flow, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_invalidate(flow);
+
+        // Time runs until the last ball finishes its second leg
+        int32_t totalTime = delay + (ballsCount - 1) * path.ballDelay + 2 * path.legTime;
+        lv_anim_set_time(&animation, totalTime);
+        lv_anim_set_values(&animation, 0, totalTime);
+        lv_anim_start(&animation);
     }
 
     void hide()
     {
-        for (int i = 0; i < MAX_BALLS_COUNT; i++)
-        {
-            lv_obj_add_flag(items[i].ball, LV_OBJ_FLAG_HIDDEN);
-        }
+        lv_anim_del(flow, onAnimation);
+        lv_obj_add_flag(flow, LV_OBJ_FLAG_HIDDEN);
         lv_obj_add_flag(vLine, LV_OBJ_FLAG_HIDDEN);
         lv_obj_add_flag(hLine, LV_OBJ_FLAG_HIDDEN);
     }
 
 private:
-    UIBallAnimationItem_t items[MAX_BALLS_COUNT];
+    typedef struct
+    {
+        lv_coord_t startX; // ball top-left at the source, relative to parent
+        lv_coord_t startY;
+        lv_coord_t distanceX;
+        lv_coord_t distanceY;
+        int32_t legTime;   // ms per leg
+        int32_t xDelay;    // leg start offsets, one of them is 0
+        int32_t yDelay;
+        int32_t delay;
+        int32_t ballDelay; // between consecutive balls
+        int ballsCount;
+    } Path_t;
+
+    Path_t path = {};
+    int32_t elapsed = 0;
+    lv_coord_t originX = 0; // flow object position, relative to parent
+    lv_coord_t originY = 0;
+    lv_anim_t animation;
     lv_obj_t *parent;
+    lv_obj_t *flow;
     lv_obj_t *vLine;
     lv_obj_t *hLine;
+
+    /**
+     * Absolute area of ball i at time t. Returns the leg (0/1) it is on.
+     */
+    int ballArea(int i, int32_t t, lv_area_t *area) const
+    {
+        int32_t local = t - (path.delay + i * path.ballDelay);
+        int32_t tx = LV_CLAMP(0, local - path.xDelay, path.legTime);
+        int32_t ty = LV_CLAMP(0, local - path.yDelay, path.legTime);
+        lv_coord_t x = path.startX + path.distanceX * tx / path.legTime;
+        lv_coord_t y = path.startY + path.distanceY * ty / path.legTime;
+        area->x1 = flow->coords.x1 + x - originX;
+        area->y1 = flow->coords.y1 + y - originY;
+        area->x2 = area->x1 + BALLS_RADIUS - 1;
+        area->y2 = area->y1 + BALLS_RADIUS - 1;
+        return local >= path.legTime ? 1 : 0;
+    }
+
+    static void onAnimation(void *var, int32_t value)
+    {
+        lv_obj_t *flow = (lv_obj_t *)var;
+        UIBallAnimator *self = (UIBallAnimator *)lv_obj_get_user_data(flow);
+        if (value == self->elapsed)
+        {
+            return;
+        }
+
+        // One dirty area per leg, covering old and new position of moved balls
+        lv_area_t dirty[2];
+        bool hasDirty[2] = {false, false};
+        for (int i = 0; i < self->path.ballsCount; i++)
+        {
+            lv_area_t before, after;
+            self->ballArea(i, self->elapsed, &before);
+            int leg = self->ballArea(i, value, &after);
+            if (memcmp(&before, &after, sizeof(lv_area_t)) == 0)
+            {
+                continue;
+            }
+            _lv_area_join(&after, &after, &before);
+            if (hasDirty[leg])
+            {
+                _lv_area_join(&dirty[leg], &dirty[leg], &after);
+            }
+            else
+            {
+                dirty[leg] = after;
+                hasDirty[leg] = true;
+            }
+        }
+        self->elapsed = value;
+
+        for (int leg = 0; leg < 2; leg++)
+        {
+            if (hasDirty[leg])
+            {
+                lv_obj_invalidate_area(flow, &dirty[leg]);
+            }
+        }
+    }
+
+    static void onDraw(lv_event_t *e)
+    {
+        UIBallAnimator *self = (UIBallAnimator *)lv_event_get_user_data(e);
+        lv_draw_ctx_t *drawCtx = lv_event_get_draw_ctx(e);
+
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = lv_obj_get_style_bg_color(self->flow, LV_PART_MAIN);
+        dsc.bg_opa = LV_OPA_COVER;
+        dsc.radius = BALLS_RADIUS / 2;
+
+        for (int i = 0; i < self->path.ballsCount; i++)
+        {
+            lv_area_t area;
+            self->ballArea(i, self->elapsed, &area);
+            if (_lv_area_is_on(&area, drawCtx->clip_area))
+            {
+                lv_draw_rect(drawCtx, &dsc, &area);
+            }
+        }
+    }
 };
@@ -10,6 +10,7 @@ struct UITextChangeAnimatorVariables {
     Unit_t unit;
     int32_t from = -1;
     int32_t to = -1;
+    int32_t shown = INT32_MIN; // last quantised value written to the label
 };
 
 void animation_set_text(UITextChangeAnimatorVariables *variables, int32_t value) {
@@ -22,11 +23,16 @@ void animation_set_text(UITextChangeAnimatorVariables *variables, int32_t value)
     if(v != variables->to && step > 0) {
         v = (v / step) * step;
     }
-    String text = format(variables->unit, v).value;
-    if(!strcmp(lv_label_get_text(variables->label), text.c_str())) {
+    if(v == variables->shown) {
         return;
     }
-    lv_label_set_text(variables->label, text.c_str());
+    variables->shown = v;
+    char text[16];
+    formatUnitValue(text, sizeof(text), variables->unit, v);
+    if(!strcmp(lv_label_get_text(variables->label), text)) {
+        return;
+    }
+    lv_label_set_text(variables->label, text);
 }
 
 // Callback to null out label pointer when LVGL deletes the object
@@ -82,6 +88,7 @@ class UITextChangeAnimator {
             }
             
             variables.label = label;
+            variables.shown = INT32_MIN; // label may have been recreated or changed elsewhere
             variables.from = from;
             variables.to = to;
             lv_anim_set_values(&anim, from, to);
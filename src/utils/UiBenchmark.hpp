@@ -0,0 +1,186 @@
+#pragma once
+
+#include <Arduino.h>
+#include <RemoteLogger.hpp>
+#include "../Inverters/InverterResult.hpp"
+#include "FrameProfiler.hpp"
+
+extern SemaphoreHandle_t lvgl_mutex;
+
+#define UI_BENCHMARK_STEP_MS 1000       // dashboard update period while running, 5x the normal rate
+#define UI_BENCHMARK_MAX_SECONDS 600
+
+/**
+ * Scripted dashboard scenario for comparing UI rendering changes.
+ *
+ * While running, the main loop feeds the dashboard synthetic inverter data
+ * from step() instead of the real poll, and FrameProfiler collects per-frame
+ * render time, invalidated area and LVGL allocations. The scenario is
+ * deterministic (same seed, same sequence of values), so reports of two
+ * firmware builds are comparable. It cycles through phases that exercise
+ * different parts of the UI:
+ *  - steady: small noise, mostly text changes
+ *  - ramp: production and load sweep their full range, bars and balls speed
+ *  - flip: grid and battery change direction every step, balls re-route
+ *
+ * Start with /profile?bench=<seconds>, the report is logged at the end and
+ * stays available at /profile.
+ */
+class UiBenchmark
+{
+public:
+    static UiBenchmark &instance()
+    {
+        static UiBenchmark inst;
+        return inst;
+    }
+
+    /**
+     * Request a run, callable from any task. Picked up by the main loop.
+     */
+    void start(uint32_t seconds)
+    {
+        requestedSeconds = min(seconds, (uint32_t)UI_BENCHMARK_MAX_SECONDS);
+    }
+
+    bool isRunning() const
+    {
+        return running;
+    }
+
+    /**
+     * Call from the main loop. Returns true when the dashboard should be
+     * updated with data (next step of the scenario), previous holds the
+     * preceding step for the change animations.
+     */
+    bool step(InverterData_t &data, InverterData_t &previous)
+    {
+        if (requestedSeconds > 0)
+        {
+            begin(requestedSeconds);
+            requestedSeconds = 0;
+        }
+        if (!running || millis() - lastStepMillis < UI_BENCHMARK_STEP_MS)
+        {
+            return false;
+        }
+        if (millis() - startMillis > durationMs)
+        {
+            finish();
+            return false;
+        }
+        lastStepMillis = millis();
+        previous = current;
+        generate(stepIndex++);
+        data = current;
+        return true;
+    }
+
+private:
+    volatile uint32_t requestedSeconds = 0;
+    volatile bool running = false;
+    unsigned long startMillis = 0;
+    unsigned long lastStepMillis = 0;
+    uint32_t durationMs = 0;
+    uint32_t stepIndex = 0;
+    uint32_t seed = 1;
+    InverterData_t current;
+
+    UiBenchmark() {}
+
+    void begin(uint32_t seconds)
+    {
+        LOGI("[UiBenchmark] Running %lu s", (unsigned long)seconds);
+        durationMs = seconds * 1000;
+        stepIndex = 0;
+        seed = 1;
+        generate(stepIndex++);
+        startMillis = millis();
+        lastStepMillis = 0;
+        // Profiler state is written by monitor_cb on the LVGL task
+        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+        FrameProfiler::instance().setEnabled(true);
+        FrameProfiler::instance().reset();
+        xSemaphoreGive(lvgl_mutex);
+        running = true;
+    }
+
+    void finish()
+    {
+        running = false;
+        LOGI("[UiBenchmark] Done, %lu steps", (unsigned long)stepIndex);
+        FrameProfiler::instance().report([](const char *line) {
+            LOGI("[UiBenchmark] %s", line);
+        });
+    }
+
+    /**
+     * Deterministic pseudo random number in [low, high), independent of random().
+     */
+    int next(int low, int high)
+    {
+        seed = seed * 1103515245 + 12345;
+        return low + (int)((seed >> 16) % (uint32_t)(high - low));
+    }
+
+    void generate(uint32_t index)
+    {
+        InverterData_t d;
+        d.millis = millis();
+        d.status = DONGLE_STATUS_OK;
+        d.dongleFWVersion = "bench";
+        d.sn = "BENCHMARK";
+        d.hasBattery = true;
+        d.batteryCapacityWh = 10000;
+        d.minSoc = 10;
+        d.maxSoc = 100;
+
+        uint32_t phase = (index / 20) % 3;
+        uint32_t t = index % 20;
+        int pv = 0;
+        int load = 0;
+        int battery = 0;
+        int grid = 0;
+        switch (phase)
+        {
+        case 0: // steady
+            pv = 4000 + next(-100, 100);
+            load = 1000 + next(-50, 50);
+            battery = 1500 + next(-50, 50);
+            break;
+        case 1: // ramp
+            pv = t * 500;
+            load = 300 + (19 - t) * 300;
+            battery = (int)(t * 250) - 2500;
+            break;
+        default: // flip
+            pv = 3000 + next(-500, 500);
+            load = 1500 + next(-500, 500);
+            battery = (t % 2 == 0) ? 2000 : -2000;
+            break;
+        }
+        grid = pv - load - battery;
+
+        d.pv1Power = pv / 2;
+        d.pv2Power = pv - d.pv1Power;
+        d.loadPower = load;
+        d.batteryPower = battery;
+        d.gridPowerL1 = grid / 3;
+        d.gridPowerL2 = grid / 3;
+        d.gridPowerL3 = grid - 2 * (grid / 3);
+        d.inverterOutpuPowerL1 = (pv - battery) / 3;
+        d.inverterOutpuPowerL2 = (pv - battery) / 3;
+        d.inverterOutpuPowerL3 = (pv - battery) - 2 * ((pv - battery) / 3);
+        d.soc = 20 + (index % 80);
+        d.batteryTemperature = 20 + next(0, 6);
+        d.inverterTemperature = 40 + next(0, 12);
+        d.pvToday = 10 + index * 0.1;
+        d.pvTotal = 1500 + index * 0.1;
+        d.loadToday = 5 + index * 0.05;
+        d.batteryChargedToday = 3 + index * 0.02;
+        d.batteryDischargedToday = 2 + index * 0.02;
+        d.gridBuyToday = 1 + index * 0.01;
+        d.gridSellToday = 4 + index * 0.03;
+        current = d;
+    }
+};
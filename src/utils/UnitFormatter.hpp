@@ -10,48 +10,121 @@ typedef struct FormattedUnit
     String formatted;
 } FormattedUnit_t;
 
+/**
+ * Writes |value| / divisor with 0 or 1 decimals (decimal comma) into buf,
+ * rounding half away from zero. Integer only, no heap.
+ */
+static size_t formatScaled(char *buf, size_t size, int32_t value, uint32_t divisor, uint8_t decimals)
+{
+    uint32_t magnitude = value < 0 ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+    uint32_t step = decimals > 0 ? divisor / 10 : divisor;
+    uint32_t scaled = step > 1 ? (magnitude + step / 2) / step : magnitude;
+
+    // Digits in reverse order
+    char tmp[16];
+    size_t n = 0;
+    if (decimals > 0)
+    {
+        tmp[n++] = '0' + scaled % 10;
+        scaled /= 10;
+        tmp[n++] = ',';
+    }
+    do
+    {
+        tmp[n++] = '0' + scaled % 10;
+        scaled /= 10;
+    } while (scaled > 0);
+    bool zero = true;
+    for (size_t i = 0; i < n; i++)
+    {
+        zero &= tmp[i] == '0' || tmp[i] == ',';
+    }
+    if (value < 0 && !zero)
+    {
+        tmp[n++] = '-';
+    }
+
+    size_t length = 0;
+    while (n > 0 && length + 1 < size)
+    {
+        buf[length++] = tmp[--n];
+    }
+    if (size > 0)
+    {
+        buf[length] = '\0';
+    }
+    return length;
+}
+
+/**
+ * Allocation-free format(): writes the number into value (decimal comma) and
+ * returns the unit. Same thresholds and precision as format().
+ */
+const char *formatUnitValue(char *value, size_t size, Unit_t unit, int32_t v, float limitingFactor = 1.0f)
+{
+    float magnitude = abs((float)v);
+    switch (unit)
+    {
+    case POWER:
+        if (magnitude >= limitingFactor * 10 * 1000 * 1000)
+        {
+            formatScaled(value, size, v, 1000 * 1000, 0);
+            return "MW";
+        }
+        else if (magnitude >= limitingFactor * 1 * 1000 * 1000)
+        {
+            formatScaled(value, size, v, 1000 * 1000, 1);
+            return "MW";
+        }
+        else if (magnitude >= limitingFactor * 10 * 1000)
+        {
+            formatScaled(value, size, v, 1000, 1);
+            return "kW";
+        }
+        formatScaled(value, size, v, 1, 0);
+        return "W";
+    case ENERGY:
+        if (magnitude >= limitingFactor * 10 * 1000 * 1000)
+        {
+            formatScaled(value, size, v, 1000 * 1000, 0);
+            return "MWh";
+        }
+        else if (magnitude >= limitingFactor * 1 * 1000 * 1000)
+        {
+            formatScaled(value, size, v, 1000 * 1000, 1);
+            return "MWh";
+        }
+        else if (magnitude >= limitingFactor * 10 * 1000)
+        {
+            formatScaled(value, size, v, 1000, 0);
+            return "kWh";
+        }
+        formatScaled(value, size, v, 1000, 1);
+        return "kWh";
+    case PERCENT:
+    default:
+        formatScaled(value, size, v, 1, 0);
+        return "%";
+    }
+}
+
+/**
+ * Allocation-free format().formatted - "value unit" into buf.
+ */
+size_t formatUnitText(char *buf, size_t size, Unit_t unit, int32_t v, float limitingFactor = 1.0f, bool compact = false)
+{
+    char value[16];
+    const char *unitText = formatUnitValue(value, sizeof(value), unit, v, limitingFactor);
+    int length = snprintf(buf, size, compact ? "%s%s" : "%s %s", value, unitText);
+    return length < 0 ? 0 : min((size_t)length, size > 0 ? size - 1 : 0);
+}
+
 FormattedUnit_t format(Unit_t unit, float value, float limitingFactor = 1.0f, bool compact = false, int padLeft = 0) {
     FormattedUnit_t formattedUnit;
-    String space = compact ? "" : " ";
-    switch(unit) {
-        case POWER:
-            if (abs(value) >= limitingFactor * 10 * 1000 * 1000) {
-                formattedUnit.value = String(value / (1000.0f * 1000.0f),0);
-                formattedUnit.unit = "MW";
-            } else if (abs(value) >= limitingFactor * 1 * 1000 * 1000) {
-                formattedUnit.value = String(value / (1000.0f * 1000.0f),1);
-                formattedUnit.unit = "MW";
-            } else if (abs(value) >= limitingFactor * 10 * 1000) {
-                formattedUnit.value = String(value / 1000.0f,1);
-                formattedUnit.unit = "kW";
-            } 
-            else {
-                formattedUnit.value = String(value,0);
-                formattedUnit.unit = "W";
-            }
-            break;
-        case ENERGY:
-            if (abs(value) >= limitingFactor * 10 * 1000 * 1000) {
-                formattedUnit.value = String(value / (1000.0f * 1000.0f),0);
-                formattedUnit.unit = "MWh";
-            } else if (abs(value) >= limitingFactor * 1 * 1000 * 1000) {
-                formattedUnit.value = String(value / (1000.0f * 1000.0f),1);
-                formattedUnit.unit = "MWh";
-            } else if (abs(value) >= limitingFactor * 10 * 1000) {
-                formattedUnit.value = String(value / 1000.0f,0);
-                formattedUnit.unit = "kWh";
-            } else {
-                formattedUnit.value = String(value / 1000.0f,1);
-                formattedUnit.unit = "kWh";
-            }
-            break;
-        case PERCENT:
-            formattedUnit.value = String(value,0);
-            formattedUnit.unit = "%";
-            break;
-    }
-    formattedUnit.value.replace(".", ",");
-    formattedUnit.formatted = formattedUnit.value + space + formattedUnit.unit;
+    char buf[16];
+    formattedUnit.unit = formatUnitValue(buf, sizeof(buf), unit, lroundf(value), limitingFactor);
+    formattedUnit.value = buf;
+    formattedUnit.formatted = formattedUnit.value + (compact ? "" : " ") + formattedUnit.unit;
     return formattedUnit;
 }
 
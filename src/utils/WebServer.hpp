@@ -8,7 +8,17 @@
 #include "../gfx_conf.h"
 #include "../Inverters/InverterResult.hpp"
 #include "../Spot/ElectricityPriceResult.hpp"
+#include "../Spot/ElectricityPriceCache.hpp"
+#include "../Spot/PriceArchive.hpp"
 #include "../webserver/icons.h"
+#include "LiveStream.hpp"
+#include "Metrics.hpp"
+#include "Tracer.hpp"
+#include "FrameProfiler.hpp"
+#include "UiBenchmark.hpp"
+#include "LoadScheduler.hpp"
+#include "DayRecorder.hpp"
+#include "AsyncHttpWorkers.hpp"
 #include <RemoteLogger.hpp>
 
 // Forward declarations
@@ -19,6 +29,7 @@ extern SemaphoreHandle_t lvgl_mutex;
 extern const char INDEX_HTML[];
 extern const char STYLE_CSS[];
 extern const char APP_JS[];
+extern const char LIVE_HTML[];
 
 class WebServer
 {
@@ -38,8 +49,11 @@ public:
         httpd_config_t config = HTTPD_DEFAULT_CONFIG();
         config.server_port = 80;
         config.stack_size = 4096;  // Reduced from 8192 to save internal RAM
-        config.max_uri_handlers = 8;  // Reduced from 16
+        config.max_uri_handlers = 15;
         config.uri_match_fn = httpd_uri_match_wildcard;
+
+        // Long-running handlers are served by a worker pool, see AsyncHttpWorkers
+        AsyncHttpWorkers::instance().begin();
         
         esp_err_t err = httpd_start(&server, &config);
         if (err == ESP_OK)
@@ -89,14 +103,75 @@ public:
             };
             httpd_register_uri_handler(server, &iconUri);
 
-            // Screenshot endpoint
-            httpd_uri_t screenshotUri = {
-                .uri = "/screenshot.bmp",
+            // Screenshot endpoint - takes seconds, async with a single slot
+            httpd_uri_t screenshotUri = AsyncHttpWorkers::uri("/screenshot.bmp", &screenshotRoute, "screenshot",
+                                                              screenshotHandler, this, 1, 8 * 1024);
+            httpd_register_uri_handler(server, &screenshotUri);
+
+            // Live screen mirroring - viewer page and delta stream
+            httpd_uri_t liveUri = {
+                .uri = "/live",
                 .method = HTTP_GET,
-                .handler = screenshotHandler,
+                .handler = liveHandler,
                 .user_ctx = this
             };
-            httpd_register_uri_handler(server, &screenshotUri);
+            httpd_register_uri_handler(server, &liveUri);
+
+            httpd_uri_t liveStreamUri = AsyncHttpWorkers::uri("/live/stream", &liveStreamRoute, "live_stream",
+                                                              liveStreamHandler, this, 2, 8 * 1024);
+            httpd_register_uri_handler(server, &liveStreamUri);
+
+            // Prometheus metrics
+            httpd_uri_t metricsUri = {
+                .uri = "/metrics",
+                .method = HTTP_GET,
+                .handler = metricsHandler,
+                .user_ctx = this
+            };
+            httpd_register_uri_handler(server, &metricsUri);
+
+            // LVGL frame/invalidation profiler report and control
+            httpd_uri_t profileUri = {
+                .uri = "/profile",
+                .method = HTTP_GET,
+                .handler = profileHandler,
+                .user_ctx = this
+            };
+            httpd_register_uri_handler(server, &profileUri);
+
+            // Cheapest-window load scheduling requests and plans
+            httpd_uri_t scheduleUri = {
+                .uri = "/schedule",
+                .method = HTTP_GET,
+                .handler = scheduleHandler,
+                .user_ctx = this
+            };
+            httpd_register_uri_handler(server, &scheduleUri);
+
+            // Recorded quarters of today/yesterday for offline backtesting
+            httpd_uri_t historyUri = {
+                .uri = "/history.csv",
+                .method = HTTP_GET,
+                .handler = historyHandler,
+                .user_ctx = this
+            };
+            httpd_register_uri_handler(server, &historyUri);
+
+            // Archived day-ahead prices of past days
+            httpd_uri_t pricesUri = {
+                .uri = "/prices.csv",
+                .method = HTTP_GET,
+                .handler = pricesHandler,
+                .user_ctx = this
+            };
+            httpd_register_uri_handler(server, &pricesUri);
+
+#if TRACING
+            // Chrome/Perfetto trace of recent spans
+            httpd_uri_t traceUri = AsyncHttpWorkers::uri("/trace.json", &traceRoute, "trace",
+                                                         traceHandler, this, 1, 4 * 1024);
+            httpd_register_uri_handler(server, &traceUri);
+#endif
 
             LOGI("Web server started on port 80");
         }
@@ -110,6 +185,8 @@ public:
     {
         if (server)
         {
+            // Workers hold detached requests of this server
+            AsyncHttpWorkers::instance().drain(3000);
             httpd_stop(server);
             server = nullptr;
             LOGI("Web server stopped");
@@ -131,6 +208,51 @@ private:
     SemaphoreHandle_t lvglMutex;
     InverterData_t *inverterData;
     ElectricityPriceTwoDays_t *priceData;
+    AsyncHttpRoute_t screenshotRoute = {};
+    AsyncHttpRoute_t liveStreamRoute = {};
+    AsyncHttpRoute_t traceRoute = {};
+
+    /**
+     * Strict decimal query value: digits only (no sign, spaces or suffix), at most max.
+     */
+    static bool parseUnsigned(const char *value, unsigned long max, unsigned long &out)
+    {
+        if (value[0] < '0' || value[0] > '9')
+        {
+            return false;
+        }
+        char *end = nullptr;
+        unsigned long long parsed = strtoull(value, &end, 10);
+        if (*end != '\0' || parsed > max)
+        {
+            return false;
+        }
+        out = (unsigned long)parsed;
+        return true;
+    }
+
+    /**
+     * HH:MM with hour 0-23 and minute 0-59.
+     */
+    static bool parseClock(const char *value, int &hour, int &minute)
+    {
+        const char *colon = strchr(value, ':');
+        if (colon == nullptr || colon == value || colon - value > 2 || strlen(colon + 1) != 2)
+        {
+            return false;
+        }
+        char hourText[3] = {};
+        memcpy(hourText, value, colon - value);
+        unsigned long h = 0;
+        unsigned long m = 0;
+        if (!parseUnsigned(hourText, 23, h) || !parseUnsigned(colon + 1, 59, m))
+        {
+            return false;
+        }
+        hour = h;
+        minute = m;
+        return true;
+    }
 
     static esp_err_t indexHandler(httpd_req_t *req)
     {
@@ -324,6 +446,419 @@ private:
         return ESP_OK;
     }
 
+    static esp_err_t metricsHandler(httpd_req_t *req)
+    {
+        Metrics::instance().updateSystemGauges();
+
+        httpd_resp_set_type(req, "text/plain; version=0.0.4");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+        // Lines are batched into a small buffer to keep the number of chunks low
+        const size_t bufferSize = 1024;
+        char *buffer = (char *)heap_caps_malloc(bufferSize, MALLOC_CAP_DEFAULT);
+        if (!buffer)
+        {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        size_t used = 0;
+        bool ok = true;
+        Metrics::instance().render([&](const char *line) {
+            size_t len = strlen(line);
+            if (!ok)
+            {
+                return;
+            }
+            if (used + len > bufferSize)
+            {
+                ok = httpd_resp_send_chunk(req, buffer, used) == ESP_OK;
+                used = 0;
+            }
+            memcpy(buffer + used, line, len);
+            used += len;
+        });
+        if (ok && used > 0)
+        {
+            ok = httpd_resp_send_chunk(req, buffer, used) == ESP_OK;
+        }
+        free(buffer);
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+
+#if TRACING
+    static esp_err_t traceHandler(httpd_req_t *req)
+    {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+        httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"trace.json\"");
+
+        const size_t bufferSize = 2048;
+        char *buffer = (char *)heap_caps_malloc(bufferSize, MALLOC_CAP_DEFAULT);
+        if (!buffer)
+        {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        size_t used = 0;
+        bool ok = true;
+        Tracer::instance().exportJson([&](const char *piece) {
+            size_t len = strlen(piece);
+            if (!ok)
+            {
+                return;
+            }
+            if (used + len > bufferSize)
+            {
+                ok = httpd_resp_send_chunk(req, buffer, used) == ESP_OK;
+                used = 0;
+            }
+            memcpy(buffer + used, piece, len);
+            used += len;
+        });
+        if (ok && used > 0)
+        {
+            ok = httpd_resp_send_chunk(req, buffer, used) == ESP_OK;
+        }
+        free(buffer);
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+#endif
+
+    /**
+     * /profile[?enable=0|1][&overlay=0|1][&reset=1][&bench=seconds] - plain text report
+     */
+    static esp_err_t profileHandler(httpd_req_t *req)
+    {
+        WebServer *self = (WebServer *)req->user_ctx;
+        FrameProfiler &profiler = FrameProfiler::instance();
+
+        char query[64];
+        char value[12];
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+        {
+            esp_err_t bench = httpd_query_key_value(query, "bench", value, sizeof(value));
+            if (bench != ESP_ERR_NOT_FOUND)
+            {
+                char *end = nullptr;
+                unsigned long seconds = bench == ESP_OK ? strtoul(value, &end, 10) : 0;
+                if (bench != ESP_OK || end == value || *end != '\0' || seconds == 0)
+                {
+                    httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "bench=<seconds> expected");
+                    return ESP_FAIL;
+                }
+                UiBenchmark::instance().start(seconds);
+            }
+            // Profiler state is written by monitor_cb on the LVGL task
+            bool hasEnable = httpd_query_key_value(query, "enable", value, sizeof(value)) == ESP_OK;
+            bool enable = hasEnable && value[0] == '1';
+            bool reset = httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK && value[0] == '1';
+            bool hasOverlay = httpd_query_key_value(query, "overlay", value, sizeof(value)) == ESP_OK;
+            bool overlay = hasOverlay && value[0] == '1';
+            if (hasEnable || reset || hasOverlay)
+            {
+                if (self->lvglMutex && xSemaphoreTake(self->lvglMutex, pdMS_TO_TICKS(1000)) == pdTRUE)
+                {
+                    if (hasEnable)
+                    {
+                        profiler.setEnabled(enable);
+                    }
+                    if (reset)
+                    {
+                        profiler.reset();
+                    }
+                    if (hasOverlay)
+                    {
+                        profiler.setOverlay(overlay);
+                    }
+                    xSemaphoreGive(self->lvglMutex);
+                }
+                else
+                {
+                    LOGW("[FrameProfiler] Could not take LVGL mutex");
+                    httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "LVGL busy");
+                    return ESP_FAIL;
+                }
+            }
+        }
+
+        httpd_resp_set_type(req, "text/plain");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+        bool ok = true;
+        profiler.report([&](const char *line) {
+            if (ok)
+            {
+                ok = httpd_resp_send_chunk(req, line, strlen(line)) == ESP_OK;
+            }
+        });
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+
+    /**
+     * /schedule[?load=shelly|wallbox&wh=energy&power=watts&deadline=HH:MM] - plain text plans,
+     * with a query declares the need of a load (wh=0 cancels, power and deadline are
+     * required otherwise), deadline is the next HH:MM
+     */
+    static esp_err_t scheduleHandler(httpd_req_t *req)
+    {
+        char query[96];
+        char value[16];
+        esp_err_t hasLoad = ESP_ERR_NOT_FOUND;
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+        {
+            hasLoad = httpd_query_key_value(query, "load", value, sizeof(value));
+        }
+        if (hasLoad != ESP_ERR_NOT_FOUND)
+        {
+            ScheduledLoad_t load;
+            if (hasLoad == ESP_OK && strcmp(value, "shelly") == 0)
+            {
+                load = SCHEDULED_LOAD_SHELLY;
+            }
+            else if (hasLoad == ESP_OK && strcmp(value, "wallbox") == 0)
+            {
+                load = SCHEDULED_LOAD_WALLBOX;
+            }
+            else
+            {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "load=shelly|wallbox expected");
+                return ESP_FAIL;
+            }
+
+            unsigned long energyWh = 0;
+            if (httpd_query_key_value(query, "wh", value, sizeof(value)) != ESP_OK ||
+                !parseUnsigned(value, LOAD_SCHEDULER_MAX_ENERGY_WH, energyWh))
+            {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "wh=<watt-hours> expected");
+                return ESP_FAIL;
+            }
+            unsigned long powerW = 0;
+            esp_err_t power = httpd_query_key_value(query, "power", value, sizeof(value));
+            if ((power != ESP_ERR_NOT_FOUND && (power != ESP_OK || !parseUnsigned(value, UINT16_MAX, powerW))) ||
+                (energyWh > 0 && powerW == 0))
+            {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "power=<1-65535> expected");
+                return ESP_FAIL;
+            }
+
+            int hour = 0;
+            int minute = 0;
+            esp_err_t hasDeadline = httpd_query_key_value(query, "deadline", value, sizeof(value));
+            if ((hasDeadline != ESP_ERR_NOT_FOUND && (hasDeadline != ESP_OK || !parseClock(value, hour, minute))) ||
+                (energyWh > 0 && hasDeadline == ESP_ERR_NOT_FOUND))
+            {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "deadline=HH:MM expected");
+                return ESP_FAIL;
+            }
+            time_t now = time(nullptr);
+            struct tm t;
+            localtime_r(&now, &t);
+            t.tm_hour = hour;
+            t.tm_min = minute;
+            t.tm_sec = 0;
+            t.tm_isdst = -1;
+            time_t deadline = mktime(&t);
+            if (deadline <= now)
+            {
+                t.tm_mday++;
+                t.tm_isdst = -1;
+                deadline = mktime(&t);
+            }
+            LoadScheduler::instance().request(load, energyWh, deadline, powerW);
+            httpd_resp_set_type(req, "text/plain");
+            httpd_resp_sendstr(req, "Request accepted\n");
+            return ESP_OK;
+        }
+
+        httpd_resp_set_type(req, "text/plain");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+        bool ok = true;
+        LoadScheduler::instance().report([&](const char *line) {
+            if (ok)
+            {
+                ok = httpd_resp_send_chunk(req, line, strlen(line)) == ESP_OK;
+            }
+        });
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+
+    /**
+     * /history.csv[?day=1] - recorded quarters of today, or yesterday with day=1
+     */
+    static esp_err_t historyHandler(httpd_req_t *req)
+    {
+        char query[32];
+        char value[8];
+        unsigned long daysAgo = 0;
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+        {
+            esp_err_t day = httpd_query_key_value(query, "day", value, sizeof(value));
+            if (day != ESP_ERR_NOT_FOUND && (day != ESP_OK || !parseUnsigned(value, 1, daysAgo)))
+            {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "day=0|1 expected");
+                return ESP_FAIL;
+            }
+        }
+
+        httpd_resp_set_type(req, "text/csv");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+        bool ok = true;
+        DayRecorder::instance().exportCsv(daysAgo, [&](const char *line) {
+            if (ok)
+            {
+                ok = httpd_resp_send_chunk(req, line, strlen(line)) == ESP_OK;
+            }
+        });
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+
+    /**
+     * /prices.csv?date=YYYYMMDD - archived raw prices (EUR/MWh) of a day, yesterday by default.
+     * The zone column is the ElectricityPriceProvider_t number the day was fetched for.
+     */
+    static esp_err_t pricesHandler(httpd_req_t *req)
+    {
+        char query[32];
+        char value[12];
+        uint32_t date = ElectricityPriceCache::dateKey(-1);
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+            httpd_query_key_value(query, "date", value, sizeof(value)) == ESP_OK)
+        {
+            date = strtoul(value, nullptr, 10);
+        }
+
+        float *prices = (float *)heap_caps_malloc(QUARTERS_OF_DAY * sizeof(float), MALLOC_CAP_SPIRAM);
+        if (prices == nullptr)
+        {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        uint8_t zone = 0;
+        if (!PriceArchive::instance().get(date, zone, prices))
+        {
+            free(prices);
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "date not archived");
+            return ESP_FAIL;
+        }
+
+        httpd_resp_set_type(req, "text/csv");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+        char line[64];
+        bool ok = httpd_resp_sendstr_chunk(req, "date,zone,quarter,time,eur_mwh\n") == ESP_OK;
+        for (int q = 0; q < QUARTERS_OF_DAY && ok; q++)
+        {
+            snprintf(line, sizeof(line), "%lu,%d,%d,%02d:%02d,%.2f\n", (unsigned long)date, zone, q, q / 4, (q % 4) * 15, prices[q]);
+            ok = httpd_resp_sendstr_chunk(req, line) == ESP_OK;
+        }
+        free(prices);
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+
+    static esp_err_t liveHandler(httpd_req_t *req)
+    {
+        httpd_resp_set_type(req, "text/html");
+        httpd_resp_set_hdr(req, "Cache-Control", "max-age=3600");
+        return httpd_resp_send(req, LIVE_HTML, strlen(LIVE_HTML));
+    }
+
+    /**
+     * Streams captured dirty rectangles newer than ?since=N for a short window.
+     * The viewer reconnects right away with the next seq, so an async worker
+     * is never held for long. Unknown or overwritten seq forces a full
+     * screen invalidation (keyframe).
+     */
+    static esp_err_t liveStreamHandler(httpd_req_t *req)
+    {
+        WebServer *self = (WebServer *)req->user_ctx;
+        LiveStream &live = LiveStream::instance();
+
+        if (!live.touchClient())
+        {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+
+        uint32_t since = 0;
+        char query[32];
+        char value[12];
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+            httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK)
+        {
+            since = strtoul(value, nullptr, 10);
+        }
+
+        uint32_t next = live.getNextSeq();
+        if (since == 0 || since > next || (since < next && !live.isAvailable(since)))
+        {
+            // Keyframe: let LVGL redraw the whole screen into the capture ring
+            if (self->lvglMutex && xSemaphoreTake(self->lvglMutex, pdMS_TO_TICKS(500)) == pdTRUE)
+            {
+                lv_obj_invalidate(lv_scr_act());
+                since = live.getNextSeq();
+                xSemaphoreGive(self->lvglMutex);
+                LOGD("[LiveStream] Keyframe requested, starting at seq %lu", (unsigned long)since);
+            }
+            else
+            {
+                LOGW("[LiveStream] Could not take LVGL mutex for keyframe");
+                since = live.getNextSeq();
+            }
+        }
+
+        httpd_resp_set_type(req, "application/octet-stream");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+        const uint32_t chunkSize = 4096;
+        uint8_t *chunk = (uint8_t *)heap_caps_malloc(chunkSize, MALLOC_CAP_DEFAULT);
+        if (!chunk)
+        {
+            httpd_resp_send_chunk(req, NULL, 0);
+            return ESP_FAIL;
+        }
+
+        unsigned long windowStart = millis();
+        bool ok = true;
+        while (ok && millis() - windowStart < LIVE_STREAM_WINDOW_MS)
+        {
+            if (since >= live.getNextSeq())
+            {
+                vTaskDelay(pdMS_TO_TICKS(30));
+                continue;
+            }
+
+            uint32_t offset = 0;
+            uint32_t recordLength = 0;
+            do
+            {
+                int32_t len = live.read(since, offset, chunk, chunkSize, &recordLength);
+                if (len < 0)
+                {
+                    // Viewer too slow, record overwritten - it will resync on reconnect
+                    LOGD("[LiveStream] Record %lu overwritten, closing stream", (unsigned long)since);
+                    ok = false;
+                    break;
+                }
+                if (httpd_resp_send_chunk(req, (const char *)chunk, len) != ESP_OK)
+                {
+                    ok = false;
+                    break;
+                }
+                offset += len;
+            } while (offset < recordLength);
+
+            since++;
+        }
+
+        free(chunk);
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ESP_OK;
+    }
+
     static esp_err_t iconHandler(httpd_req_t *req)
     {
         // Extract icon name from URI: /icons/name.png
@@ -487,6 +1022,7 @@ const char INDEX_HTML[] = R"rawliteral(<!DOCTYPE html>
                     <span id="statusText">Connecting...</span>
                 </div>
                 <a href="/screenshot.bmp" class="btn btn-screenshot" download="screenshot.bmp">📷</a>
+                <a href="/live" class="btn btn-screenshot" target="_blank">🖥</a>
             </div>
         </div>
     </div>
@@ -617,3 +1153,39 @@ function upd(e,v){if(!e)return;const t=String(v);if(e.textContent!==t){e.textCon
 function setStatus(s,t){el.statusIndicator.className='status-indicator '+s;el.statusText.textContent=t;}
 window.addEventListener('resize',function(){if(lastPrices)drawSpotChart(lastPrices,-1,'');});
 fetchData();setInterval(fetchData,REFRESH_INTERVAL);})();)rawliteral";
+
+const char LIVE_HTML[] = R"rawliteral(<!DOCTYPE html>
+<html lang="cs">
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0">
+    <title>Solar Station Live - Screen</title>
+    <style>body{margin:0;background:#222;color:#aaa;font:12px sans-serif;display:flex;flex-direction:column;align-items:center;justify-content:center;min-height:100vh}canvas{max-width:100%;image-rendering:pixelated;box-shadow:0 8px 32px rgba(0,0,0,.5)}#stats{margin-top:6px}</style>
+</head>
+<body>
+    <canvas id="screen" width="800" height="480"></canvas>
+    <div id="stats">Connecting...</div>
+<script>
+(function(){'use strict';
+const cv=document.getElementById('screen'),ctx=cv.getContext('2d'),st=document.getElementById('stats');
+let since=0,bytes=0,rects=0,t0=performance.now();
+function paint(x,y,w,h,p){const img=ctx.createImageData(w,h),d=img.data,n=w*h;let i=0,o=0;
+const put=v=>{d[o++]=((v>>11)&31)*255/31|0;d[o++]=((v>>5)&63)*255/63|0;d[o++]=(v&31)*255/31|0;d[o++]=255;};
+while(i+1<p.length&&o<n*4){const c=p[i]|(p[i+1]<<8);i+=2;
+if(c&0x8000){const v=p[i]|(p[i+1]<<8);i+=2;for(let k=c&0x7FFF;k>0;k--)put(v);}
+else{for(let k=0;k<c;k++){put(p[i]|(p[i+1]<<8));i+=2;}}}
+ctx.putImageData(img,x,y);}
+async function pump(){try{const r=await fetch('/live/stream?since='+since);if(!r.ok)throw new Error('HTTP '+r.status);
+const rd=r.body.getReader();let buf=new Uint8Array(0);
+for(;;){const{done,value}=await rd.read();if(done)break;bytes+=value.length;
+const nb=new Uint8Array(buf.length+value.length);nb.set(buf);nb.set(value,buf.length);buf=nb;
+while(buf.length>=16){const dv=new DataView(buf.buffer,buf.byteOffset,16);const len=dv.getUint32(12,true);
+if(buf.length<16+len)break;const seq=dv.getUint32(0,true);
+paint(dv.getUint16(4,true),dv.getUint16(6,true),dv.getUint16(8,true),dv.getUint16(10,true),buf.subarray(16,16+len));
+since=seq+1;rects++;buf=buf.subarray(16+len);}}
+setTimeout(pump,0);}catch(e){st.textContent='Connection error, retrying...';setTimeout(pump,2000);}}
+setInterval(()=>{const s=(performance.now()-t0)/1000;st.textContent=rects+' rects, '+(bytes/1024/s).toFixed(1)+' KB/s';bytes=0;rects=0;t0=performance.now();},2000);
+pump();})();
+</script>
+</body>
+</html>)rawliteral";